@@ -0,0 +1,61 @@
+// Sorting numbers with the default order, with a comparer that just subtracts
+// (which engines can recognize and skip calling), and with one that does
+// something else. The rate is elements sorted per second.
+'use strict';
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  type: [
+    'Array',
+    'Int8Array',
+    'Uint16Array',
+    'Int32Array',
+    'Uint32Array',
+    'Float32Array',
+    'Float64Array'
+  ],
+  elements: ['int', 'double'],
+  compare: ['none', 'subtract', 'custom'],
+  size: [1e3, 1e5, 1e7]
+});
+
+// At least this many elements are sorted for each configuration
+const minElements = 1e6;
+
+function subtract(a, b) {
+  return a - b;
+}
+
+function custom(a, b) {
+  return a < b ? -1 : a > b ? 1 : 0;
+}
+
+function createArray(type, elements, size) {
+  const arr = type === 'Array' ? [] : new global[type](size);
+  var seed = 1;
+  for (var i = 0; i < size; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    const value = (seed % 2000000) - 1000000;
+    arr[i] = elements === 'int' ? value : value / 7;
+  }
+  return arr;
+}
+
+function main({ type, elements, compare, size }) {
+  var comparer;
+  if (compare === 'subtract')
+    comparer = subtract;
+  else if (compare === 'custom')
+    comparer = custom;
+  const rounds = Math.max(1, Math.ceil(minElements / size));
+
+  const source = createArray(type, elements, size);
+  const arrays = [];
+  for (var i = 0; i < rounds; i++)
+    arrays.push(source.slice());
+
+  bench.start();
+  for (i = 0; i < rounds; i++)
+    arrays[i].sort(comparer);
+  bench.end(rounds * size);
+}
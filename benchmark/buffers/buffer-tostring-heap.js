@@ -0,0 +1,26 @@
+// Memory cost of strings decoded from large buffers, as with
+// `fs.readFileSync(file).toString()`. The reported rate is the number of
+// retained strings per megabyte of heap and external memory growth, so
+// decoding that doesn't widen the text to two bytes per character shows up as
+// a higher rate.
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  encoding: ['utf8', 'latin1'],
+  len: [64 * 1024, 4 * 1024 * 1024],
+  n: [32]
+}, { flags: ['--expose-gc'] });
+
+function main({ encoding, len, n }) {
+  const buf = Buffer.alloc(len, 'abcdefghijklmnopqrstuvwxyz\n');
+  const retained = new Array(n);
+
+  bench.startMemory();
+  for (var i = 0; i < n; i++)
+    retained[i] = buf.toString(encoding);
+  bench.endMemory(n);
+
+  return retained;
+}
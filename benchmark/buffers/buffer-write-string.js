@@ -5,7 +5,7 @@ const bench = common.createBenchmark(main, {
   encoding: [
     '', 'utf8', 'ascii', 'hex', 'UCS-2', 'utf16le', 'latin1', 'binary'
   ],
-  args: [ '', 'offset', 'offset+length' ],
+  args: [ '', 'offset', 'offset+length', 'partial' ],
   len: [10, 2048],
   n: [1e7]
 });
@@ -47,6 +47,22 @@ function main({ len, n, encoding, args }) {
         bench.end(n);
       }
       break;
+    case 'partial':
+      // Only part of the string fits, as in a streaming encoder
+      if (encoding) {
+        bench.start();
+        for (i = 0; i < n; ++i) {
+          buf.write(string, 0, len >> 1, encoding);
+        }
+        bench.end(n);
+      } else {
+        bench.start();
+        for (i = 0; i < n; ++i) {
+          buf.write(string, 0, len >> 1);
+        }
+        bench.end(n);
+      }
+      break;
     default:
       if (encoding) {
         bench.start();
@@ -27,6 +27,8 @@ function Benchmark(fn, configs, options) {
   this._time = [0, 0];
   // Used to make sure a benchmark only start a timer once
   this._started = false;
+  // Memory in use when startMemory was called
+  this._memory = 0;
 
   // this._run will use fork() to create a new process for each configuration
   // combination.
@@ -209,6 +211,38 @@ Benchmark.prototype.end = function(operations) {
   this.report(rate, elapsed);
 };
 
+// Memory benchmarks retain what they allocate between startMemory() and
+// endMemory(count). The reported rate is count per megabyte of heap and
+// external memory growth, so a more compact representation shows up as a
+// higher rate. Requires the --expose-gc flag.
+function getMemoryInUse() {
+  if (typeof global.gc !== 'function') {
+    throw new Error('memory benchmarks need the --expose-gc flag');
+  }
+  global.gc();
+  const usage = process.memoryUsage();
+  return usage.heapUsed + usage.external;
+}
+
+Benchmark.prototype.startMemory = function() {
+  this._memory = getMemoryInUse();
+  this.start();
+};
+
+Benchmark.prototype.endMemory = function(count) {
+  const elapsed = process.hrtime(this._time);
+
+  if (!this._started) {
+    throw new Error('called endMemory without startMemory');
+  }
+  if (typeof count !== 'number') {
+    throw new Error('called endMemory() without specifying the count');
+  }
+
+  const growth = Math.max(getMemoryInUse() - this._memory, 1);
+  this.report(count / (growth / (1024 * 1024)), elapsed);
+};
+
 function formatResult(data) {
   // Construct configuration string, " A=a, B=b, ..."
   let conf = '';
@@ -0,0 +1,91 @@
+// Map and Set operations at sizes from small to very large collections. For
+// op=memory the reported rate is the number of entries per megabyte of heap
+// growth, so a more compact representation shows up as a higher rate; for the
+// other operations it is operations per second.
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  type: ['Map', 'Set'],
+  op: ['insert', 'get', 'delete', 'iterate', 'memory'],
+  key: ['int', 'string'],
+  size: [1e3, 1e5, 1e7]
+}, { flags: ['--expose-gc'] });
+
+function createKeys(key, size) {
+  const keys = new Array(size);
+  for (var i = 0; i < size; i++)
+    keys[i] = key === 'int' ? i : `key${i}`;
+  return keys;
+}
+
+function fill(type, keys) {
+  var i;
+  if (type === 'Map') {
+    const map = new Map();
+    for (i = 0; i < keys.length; i++)
+      map.set(keys[i], i);
+    return map;
+  }
+  const set = new Set();
+  for (i = 0; i < keys.length; i++)
+    set.add(keys[i]);
+  return set;
+}
+
+function main({ type, op, key, size }) {
+  const keys = createKeys(key, size);
+  var collection, i;
+
+  switch (op) {
+    case 'insert':
+      bench.start();
+      collection = fill(type, keys);
+      bench.end(size);
+      break;
+    case 'get':
+      collection = fill(type, keys);
+      var found = 0;
+      bench.start();
+      if (type === 'Map') {
+        for (i = 0; i < size; i++)
+          found += collection.get(keys[i]) === i ? 1 : 0;
+      } else {
+        for (i = 0; i < size; i++)
+          found += collection.has(keys[i]) ? 1 : 0;
+      }
+      bench.end(size);
+      if (found !== size)
+        throw new Error('Missing entries');
+      break;
+    case 'delete':
+      collection = fill(type, keys);
+      bench.start();
+      for (i = 0; i < size; i++)
+        collection.delete(keys[i]);
+      bench.end(size);
+      break;
+    case 'iterate':
+      collection = fill(type, keys);
+      var count = 0;
+      bench.start();
+      for (const entry of collection) {
+        if (entry !== undefined)
+          count++;
+      }
+      bench.end(size);
+      if (count !== size)
+        throw new Error('Missing entries');
+      break;
+    case 'memory':
+      bench.startMemory();
+      collection = fill(type, keys);
+      bench.endMemory(size);
+      break;
+    default:
+      throw new Error(`Unexpected op: ${op}`);
+  }
+
+  return collection;
+}
@@ -0,0 +1,67 @@
+// Heap cost of the header names the HTTP parser hands to JS land. Every parsed
+// request keeps its raw headers, as a server with many requests in flight
+// would. The reported rate is the number of retained requests per megabyte of
+// heap growth, so header names that are shared across requests show up as a
+// higher rate.
+'use strict';
+
+const common = require('../common');
+const HTTPParser = process.binding('http_parser').HTTPParser;
+const REQUEST = HTTPParser.REQUEST;
+const kOnHeaders = HTTPParser.kOnHeaders | 0;
+const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+const kOnBody = HTTPParser.kOnBody | 0;
+const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+const CRLF = '\r\n';
+
+const bench = common.createBenchmark(main, {
+  names: ['known', 'custom'],
+  n: [1e4]
+}, { flags: ['--expose-gc'] });
+
+const knownHeaders = [
+  'Host: example.com',
+  'User-Agent: Mozilla/5.0 (X11; Linux x86_64)',
+  'Accept: text/html,application/xhtml+xml',
+  'Accept-Encoding: gzip, deflate',
+  'Accept-Language: en-US,en;q=0.5',
+  'Connection: keep-alive',
+  'Cache-Control: max-age=0',
+  'Cookie: session=0123456789abcdef',
+  'If-None-Match: "abcdef"',
+  'X-Forwarded-For: 10.0.0.1'
+];
+
+function createRequest(names) {
+  var request = `GET /hello HTTP/1.1${CRLF}`;
+  for (var i = 0; i < knownHeaders.length; i++) {
+    const header = names === 'known' ?
+      knownHeaders[i] :
+      `X-Custom-${i}${knownHeaders[i].slice(knownHeaders[i].indexOf(':'))}`;
+    request += header + CRLF;
+  }
+  return Buffer.from(request + CRLF);
+}
+
+function main({ names, n }) {
+  const request = createRequest(names);
+  const retained = new Array(n);
+  const parser = new HTTPParser(REQUEST);
+  var count = 0;
+
+  parser[kOnHeaders] = function() { };
+  parser[kOnHeadersComplete] = function(versionMajor, versionMinor, headers) {
+    retained[count++] = headers;
+  };
+  parser[kOnBody] = function() { };
+  parser[kOnMessageComplete] = function() { };
+
+  bench.startMemory();
+  for (var i = 0; i < n; i++) {
+    parser.execute(request, 0, request.length);
+    parser.reinitialize(REQUEST);
+  }
+  bench.endMemory(count);
+
+  return retained;
+}
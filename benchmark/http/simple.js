@@ -5,7 +5,7 @@ const bench = common.createBenchmark(main, {
   // unicode confuses ab on os x.
   type: ['bytes', 'buffer'],
   len: [4, 1024, 102400],
-  chunks: [1, 4],
+  chunks: [1, 4, 16],
   c: [50, 500],
   chunkedEnc: [1, 0]
 });
@@ -0,0 +1,47 @@
+// Mutator pauses while the garbage collector is busy. A large retained heap
+// keeps every collection (and its sweep) expensive, while the benchmark
+// allocates short-lived objects in small batches, as a request handler would.
+// The reported rate is the number of batches per second at the given
+// percentile of batch latency, so long pauses after a collection show up as
+// a lower rate.
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  retained: [1e6],
+  percentile: [50, 99, 99.9],
+  n: [2e4]
+});
+
+const kBatchSize = 100;
+
+function allocateBatch(live) {
+  for (var i = 0; i < kBatchSize; i++) {
+    const obj = { index: i, name: `item${i}`, values: [i, i + 1, i + 2] };
+    // Keep a few objects alive a little longer, replacing older ones.
+    live[(i * 7919) % live.length] = obj;
+  }
+}
+
+function main({ retained, percentile, n }) {
+  const heap = new Array(retained);
+  for (var i = 0; i < retained; i++)
+    heap[i] = { index: i, next: i > 0 ? heap[i - 1] : null };
+
+  const live = new Array(1024);
+  const latencies = new Float64Array(n);
+
+  for (i = 0; i < n; i++) {
+    const start = process.hrtime();
+    allocateBatch(live);
+    const elapsed = process.hrtime(start);
+    latencies[i] = elapsed[0] * 1e9 + elapsed[1];
+  }
+
+  latencies.sort();
+  const index = Math.min(n - 1, Math.floor(n * percentile / 100));
+  const latency = Math.max(latencies[index], 1);
+  bench.report(1e9 / latency, [0, latency]);
+  return heap;
+}
@@ -0,0 +1,35 @@
+// Heap cost of strings decoded from JSON text, as a cache of response bodies
+// would keep them. The reported rate is the number of retained strings per
+// megabyte of heap growth, so a more compact string representation shows up
+// as a higher rate.
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  encoding: ['utf8', 'latin1'],
+  size: [64, 1024, 16384],
+  n: [1e4]
+}, { flags: ['--expose-gc'] });
+
+function createPayload(size) {
+  const items = [];
+  var json = '[]';
+  for (var i = 0; json.length < size; i++) {
+    items.push({ id: i, name: `item ${i}`, tags: ['a', 'b'], active: true });
+    json = JSON.stringify(items);
+  }
+  return Buffer.from(json.slice(0, size));
+}
+
+function main({ encoding, size, n }) {
+  const payload = createPayload(size);
+  const retained = new Array(n);
+
+  bench.startMemory();
+  for (var i = 0; i < n; i++)
+    retained[i] = payload.toString(encoding);
+  bench.endMemory(n);
+
+  return retained;
+}
@@ -0,0 +1,115 @@
+// Time to peak throughput of a fresh process. Each child process runs the
+// same workload in rounds and reports how long the first rounds took, which is
+// mostly spent in the interpreter and waiting for the JIT when nothing is
+// known about the script yet. With a warm --chakra-profile-cache the hot
+// functions are optimized as soon as they are compiled.
+'use strict';
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const spawnSync = require('child_process').spawnSync;
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  rounds: [20],
+  cache: ['none', 'cold', 'warm']
+});
+
+// Prints the time spent in the first `rounds` rounds, in nanoseconds.
+const workloadSource = `'use strict';
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function distance(points) {
+  var sum = 0;
+  for (var i = 1; i < points.length; i++) {
+    const dx = points[i].x - points[i - 1].x;
+    const dy = points[i].y - points[i - 1].y;
+    sum += Math.sqrt(dx * dx + dy * dy);
+  }
+  return sum;
+}
+
+function checksum(values) {
+  var hash = 0;
+  for (var i = 0; i < values.length; i++)
+    hash = (hash * 31 + (values[i] | 0)) | 0;
+  return hash;
+}
+
+function round() {
+  const points = [];
+  for (var i = 0; i < 1000; i++)
+    points.push(new Point(i % 17, (i * 7) % 23));
+  const values = [];
+  for (i = 0; i < 100; i++)
+    values.push(distance(points));
+  return checksum(values);
+}
+
+const rounds = +process.argv[2];
+const start = process.hrtime();
+var result = 0;
+for (var i = 0; i < rounds; i++)
+  result ^= round();
+const elapsed = process.hrtime(start);
+console.log(elapsed[0] * 1e9 + elapsed[1], result);
+`;
+
+function main({ n, rounds, cache }) {
+  const tmpdir = fs.mkdtempSync(path.join(os.tmpdir(), 'nodejs-benchmark-'));
+  const workloadFile = path.join(tmpdir, 'workload.js');
+  const cacheDirectory = path.join(tmpdir, 'profiles');
+  fs.writeFileSync(workloadFile, workloadSource);
+
+  // Populate the cache before measuring warm starts.
+  if (cache === 'warm')
+    run(workloadFile, rounds, cacheDirectory);
+
+  var total = 0;
+  for (var i = 0; i < n; i++) {
+    switch (cache) {
+      case 'none':
+        total += run(workloadFile, rounds);
+        break;
+      case 'cold':
+        total += run(workloadFile, rounds, `${cacheDirectory}${i}`);
+        break;
+      case 'warm':
+        total += run(workloadFile, rounds, cacheDirectory);
+        break;
+    }
+  }
+
+  // Rate is warm-up windows per second, so higher is better.
+  bench.report(n * 1e9 / total, [Math.floor(total / 1e9), total % 1e9]);
+
+  removeDirectory(tmpdir);
+}
+
+function removeDirectory(dir) {
+  for (const entry of fs.readdirSync(dir)) {
+    const entryPath = path.join(dir, entry);
+    if (fs.statSync(entryPath).isDirectory())
+      removeDirectory(entryPath);
+    else
+      fs.unlinkSync(entryPath);
+  }
+  fs.rmdirSync(dir);
+}
+
+// --chakra-profile-cache is only available on ChakraCore, other engines
+// always start without a cache.
+function run(workloadFile, rounds, cacheDir) {
+  const args = [workloadFile, rounds];
+  if (cacheDir !== undefined && process.jsEngine === 'chakracore')
+    args.unshift(`--chakra-profile-cache=${cacheDir}`);
+
+  const child = spawnSync(process.execPath, args);
+  if (child.status !== 0)
+    throw new Error(`Error during node startup: ${child.stderr}`);
+  return +child.stdout.toString().split(' ')[0];
+}
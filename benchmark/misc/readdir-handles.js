@@ -0,0 +1,30 @@
+// Cost of native bindings that create many handles in one call. Reading a
+// directory creates a string handle for every entry before the array of names
+// is returned, so the rate is dominated by how cheaply locals are kept alive.
+'use strict';
+
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+
+const tmpdir = require('../../test/common/tmpdir');
+const benchmarkDirectory = path.join(tmpdir.path, 'nodejs-benchmark-readdir');
+
+const bench = common.createBenchmark(main, {
+  files: [10, 1e4],
+  n: [100]
+});
+
+function main({ files, n }) {
+  tmpdir.refresh();
+  fs.mkdirSync(benchmarkDirectory);
+  for (var i = 0; i < files; i++)
+    fs.writeFileSync(path.join(benchmarkDirectory, `file-${i}`), '');
+
+  bench.start();
+  for (i = 0; i < n; i++)
+    fs.readdirSync(benchmarkDirectory);
+  bench.end(n * files);
+
+  tmpdir.refresh();
+}
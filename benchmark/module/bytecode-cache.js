@@ -0,0 +1,77 @@
+'use strict';
+const fs = require('fs');
+const path = require('path');
+const spawnSync = require('child_process').spawnSync;
+const common = require('../common.js');
+
+const tmpdir = require('../../test/common/tmpdir');
+const benchmarkDirectory = path.join(tmpdir.path, 'nodejs-benchmark-module');
+const cacheDirectory = path.join(tmpdir.path, 'nodejs-benchmark-cache');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  modules: [500],
+  cache: ['none', 'cold', 'warm']
+});
+
+// Modules with enough functions for compilation to show up in startup time.
+function moduleSource(i) {
+  var source = '';
+  for (var j = 0; j < 20; j++) {
+    source += `exports.fn${j} = function fn${j}(a, b) {\n` +
+              '  var result = [];\n' +
+              '  for (var k = 0; k < a.length; k++)\n' +
+              `    result.push(typeof a[k] === 'string' ? a[k] + b : ${i});\n` +
+              '  return result;\n' +
+              '};\n';
+  }
+  return source;
+}
+
+function main({ n, modules, cache }) {
+  tmpdir.refresh();
+  fs.mkdirSync(benchmarkDirectory);
+
+  var entry = '';
+  for (var i = 0; i < modules; i++) {
+    fs.writeFileSync(path.join(benchmarkDirectory, `${i}.js`),
+                     moduleSource(i));
+    entry += `require('./${i}.js');\n`;
+  }
+  const entryFile = path.join(benchmarkDirectory, 'index.js');
+  fs.writeFileSync(entryFile, entry);
+
+  // Populate the cache before measuring warm starts.
+  if (cache === 'warm')
+    run(entryFile, cacheDirectory);
+
+  bench.start();
+  for (i = 0; i < n; i++) {
+    switch (cache) {
+      case 'none':
+        run(entryFile);
+        break;
+      case 'cold':
+        run(entryFile, `${cacheDirectory}${i}`);
+        break;
+      case 'warm':
+        run(entryFile, cacheDirectory);
+        break;
+    }
+  }
+  bench.end(n);
+
+  tmpdir.refresh();
+}
+
+// --chakra-bytecode-cache is only available on ChakraCore, other engines
+// always start without a cache.
+function run(entryFile, cacheDir) {
+  const args = [entryFile];
+  if (cacheDir !== undefined && process.jsEngine === 'chakracore')
+    args.unshift(`--chakra-bytecode-cache=${cacheDir}`);
+
+  const child = spawnSync(process.execPath, args);
+  if (child.status !== 0)
+    throw new Error(`Error during node startup: ${child.stderr}`);
+}
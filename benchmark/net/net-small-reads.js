@@ -0,0 +1,71 @@
+// Request/response traffic with small messages, so that every message is a
+// separate read on both ends and the cost of allocating read buffers shows up
+// in the number of round trips per second.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  len: [16, 512, 4096],
+  connections: [1, 50],
+  dur: [5]
+});
+
+// Calls `onMessage` for every complete message of `len` bytes received on
+// `socket`.
+function onMessages(socket, len, onMessage) {
+  var received = 0;
+  socket.on('data', function(chunk) {
+    received += chunk.length;
+    while (received >= len) {
+      received -= len;
+      onMessage();
+    }
+  });
+}
+
+function main({ dur, len, connections }) {
+  const message = Buffer.alloc(len, 'x');
+  const clients = [];
+  var roundTrips = 0;
+  var running = true;
+
+  const server = net.createServer(function(socket) {
+    onMessages(socket, len, function() {
+      socket.write(message);
+    });
+  });
+
+  server.listen(PORT, function() {
+    for (var i = 0; i < connections; i++)
+      clients.push(createClient());
+  });
+
+  function createClient() {
+    const socket = net.connect(PORT);
+    socket.on('connect', function() {
+      if (clients.every((client) => !client.connecting))
+        start();
+    });
+    onMessages(socket, len, function() {
+      roundTrips++;
+      if (running)
+        socket.write(message);
+    });
+    return socket;
+  }
+
+  function start() {
+    bench.start();
+    for (const socket of clients)
+      socket.write(message);
+
+    setTimeout(function() {
+      running = false;
+      bench.end(roundTrips);
+      process.exit(0);
+    }, dur * 1000);
+  }
+}
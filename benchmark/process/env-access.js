@@ -0,0 +1,51 @@
+'use strict';
+
+const common = require('../common.js');
+
+const bench = common.createBenchmark(main, {
+  n: [1e5],
+  operation: ['get', 'set', 'has', 'delete', 'enumerate']
+});
+
+function main({ n, operation }) {
+  process.env.BENCHMARK_ENV_ACCESS = 'value';
+
+  switch (operation) {
+    case 'get':
+      bench.start();
+      for (var i = 0; i < n; i++)
+        process.env.BENCHMARK_ENV_ACCESS;
+      bench.end(n);
+      break;
+    case 'set':
+      bench.start();
+      for (var j = 0; j < n; j++)
+        process.env.BENCHMARK_ENV_ACCESS = 'value';
+      bench.end(n);
+      break;
+    case 'has':
+      bench.start();
+      for (var k = 0; k < n; k++)
+        'BENCHMARK_ENV_ACCESS' in process.env;
+      bench.end(n);
+      break;
+    case 'delete':
+      bench.start();
+      for (var m = 0; m < n; m++)
+        delete process.env.BENCHMARK_ENV_ACCESS_MISSING;
+      bench.end(n);
+      break;
+    case 'enumerate':
+      bench.start();
+      for (var l = 0; l < n; l++) {
+        for (var key in process.env)
+          key;
+      }
+      bench.end(n);
+      break;
+    default:
+      throw new Error(`Unexpected operation: ${operation}`);
+  }
+
+  delete process.env.BENCHMARK_ENV_ACCESS;
+}
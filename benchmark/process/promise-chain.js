@@ -0,0 +1,64 @@
+'use strict';
+
+// Throughput of promise reactions, which run as microtasks.
+const common = require('../common.js');
+const bench = common.createBenchmark(main, {
+  // depth: every reaction queues the next one.
+  // breadth: all of the reactions are queued at once.
+  // await: an async function awaiting in a loop.
+  method: ['depth', 'breadth', 'await'],
+  millions: [2]
+});
+
+function main({ method, millions }) {
+  const N = millions * 1e6;
+
+  switch (method) {
+    case 'depth':
+      bench.start();
+      depth(N);
+      break;
+    case 'breadth':
+      bench.start();
+      breadth(N);
+      break;
+    case 'await':
+      bench.start();
+      loop(N);
+      break;
+    default:
+      throw new Error(`Unexpected method "${method}"`);
+  }
+
+  function done() {
+    bench.end(millions);
+  }
+
+  function depth(n) {
+    var i = 0;
+    function step() {
+      if (++i === n)
+        done();
+      else
+        Promise.resolve().then(step);
+    }
+    Promise.resolve().then(step);
+  }
+
+  function breadth(n) {
+    const resolved = Promise.resolve();
+    var i = 0;
+    function step() {
+      if (++i === n)
+        done();
+    }
+    for (var j = 0; j < n; j++)
+      resolved.then(step);
+  }
+
+  async function loop(n) {
+    for (var i = 0; i < n; i++)
+      await i;
+    done();
+  }
+}
@@ -102,12 +102,16 @@
         'src/jsrtcontextcachedobj.inc',
         'src/jsrtcontextshim.cc',
         'src/jsrtcontextshim.h',
+        'src/jsrthandlestack.cc',
+        'src/jsrthandlestack.h',
         'src/jsrtinspector.cc',
         'src/jsrtinspector.h',
         'src/jsrtinspectorhelpers.cc',
         'src/jsrtinspectorhelpers.h',
         'src/jsrtisolateshim.cc',
         'src/jsrtisolateshim.h',
+        'src/jsrtmicrotaskqueue.cc',
+        'src/jsrtmicrotaskqueue.h',
         'src/jsrtpromise.cc',
         'src/jsrtproxyutils.cc',
         'src/jsrtproxyutils.h',
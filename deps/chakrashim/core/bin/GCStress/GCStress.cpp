@@ -68,6 +68,18 @@ WeightedTable<Operation> operationTable;
 // Not used currently, but keep for now
 bool verbose = false;
 
+// Run the mark time benchmark instead of the stress test
+bool markBenchmark = false;
+
+// Run the huge page benchmark instead of the stress test
+bool hugePageBenchmark = false;
+
+// Run the MEM_RESET test instead of the stress test
+bool memResetTest = false;
+
+// Run the global handle table test instead of the stress test
+bool handleTableTest = false;
+
 
 RecyclerTestObject * CreateNewObject()
 {
@@ -345,6 +357,430 @@ void SimpleRecyclerTest()
     wprintf(_u("==== Test completed.\n"));
 }
 
+#if ENABLE_CONCURRENT_GC
+// Mark time benchmark.  Builds the same heap once per parallel mark thread count
+// and reports the average time spent marking it in forced in-thread collections.
+
+static const unsigned int markBenchThreadCounts[] = { 1, 2, 4, 8, 16 };
+static const unsigned int markBenchCollectCount = 10;
+
+class MarkTimeCollectionWrapper : public DefaultRecyclerCollectionWrapper
+{
+public:
+    MarkTimeCollectionWrapper() : markStart(0), totalMarkTicks(0), markCount(0)
+    {
+    }
+
+    virtual void PreCollectionCallBack(CollectionFlags flags) override
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        markStart = now.QuadPart;
+    }
+
+    virtual void EndMarkCallback() override
+    {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        totalMarkTicks += now.QuadPart - markStart;
+        markCount++;
+    }
+
+    double GetAverageMarkMilliseconds() const
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return markCount == 0 ? 0 : (totalMarkTicks * 1000.0) / frequency.QuadPart / markCount;
+    }
+
+private:
+    LONGLONG markStart;
+    LONGLONG totalMarkTicks;
+    unsigned int markCount;
+};
+
+void MarkBenchmark()
+{
+    BuildObjectCreationTable();
+
+    for (unsigned int t = 0; t < _countof(markBenchThreadCounts); t++)
+    {
+        Js::Configuration::Global.flags.ParallelMarkThreads = markBenchThreadCounts[t];
+
+#if ENABLE_BACKGROUND_PAGE_FREEING
+        PageAllocator::BackgroundPageQueue backgroundPageQueue;
+#endif
+        IdleDecommitPageAllocator pageAllocator(nullptr,
+            PageAllocatorType::PageAllocatorType_Thread,
+            Js::Configuration::Global.flags,
+            0 /* maxFreePageCount */, PageAllocator::DefaultMaxFreePageCount /* maxIdleFreePageCount */,
+            false /* zero pages */
+#if ENABLE_BACKGROUND_PAGE_FREEING
+            , &backgroundPageQueue
+#endif
+            );
+
+        MarkTimeCollectionWrapper collectionWrapper;
+
+        try
+        {
+#ifdef EXCEPTION_CHECK
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_DisableCheck);
+#endif
+
+            recyclerInstance = HeapNewZ(Recycler, nullptr, &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags);
+            recyclerInstance->Initialize(false /* forceInThread */, nullptr /* threadService */);
+            recyclerInstance->SetCollectionWrapper(&collectionWrapper);
+
+            // Use the same object graph for every thread count
+            srand(0);
+
+            RecyclerTestObject * stackRoots[stackRootCount];
+            for (unsigned int i = 0; i < stackRootCount; i++)
+            {
+                stackRoots[i] = nullptr;
+                roots.AddWeightedEntry(Location::Scanned(&stackRoots[i]), 1);
+            }
+
+            for (unsigned int i = 0; i < initializeCount * 10; i++)
+            {
+                InsertObject();
+            }
+
+            for (unsigned int i = 0; i < markBenchCollectCount; i++)
+            {
+                recyclerInstance->CollectNow<CollectNowForceInThread>();
+            }
+
+            wprintf(_u("%2u mark thread(s): %8.3f ms average mark time\n"),
+                markBenchThreadCounts[t], collectionWrapper.GetAverageMarkMilliseconds());
+
+            roots.Clear();
+            recyclerInstance->ShutdownThread();
+            HeapDelete(recyclerInstance);
+            recyclerInstance = nullptr;
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            printf("Error: OOM\n");
+            return;
+        }
+    }
+}
+#endif
+
+#if ENABLE_CONCURRENT_GC && defined(__linux__)
+// Huge page benchmark.  Builds the same heap with -RecyclerHugePages and -IdleDecommitResetPages
+// on and off, and reports the average mark time and how much memory the heap keeps resident,
+// first while it is alive and then after it died and went through idle decommit.
+
+static const unsigned int hugePageBenchCollectCount = 10;
+
+struct MemoryUsage
+{
+    long rss;               // kB
+    long anonHugePages;     // kB
+    long lazyFree;          // kB, resident but reclaimable (MADV_FREE)
+};
+
+MemoryUsage GetMemoryUsage()
+{
+    MemoryUsage usage = { 0, 0, 0 };
+    FILE * file = fopen("/proc/self/smaps_rollup", "r");
+    if (file == nullptr)
+    {
+        return usage;
+    }
+
+    char line[256];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        long value;
+        if (sscanf(line, "Rss: %ld kB", &value) == 1)
+        {
+            usage.rss = value;
+        }
+        else if (sscanf(line, "AnonHugePages: %ld kB", &value) == 1)
+        {
+            usage.anonHugePages = value;
+        }
+        else if (sscanf(line, "LazyFree: %ld kB", &value) == 1)
+        {
+            usage.lazyFree = value;
+        }
+    }
+    fclose(file);
+    return usage;
+}
+
+void HugePageBenchmark()
+{
+    BuildObjectCreationTable();
+
+    for (unsigned int config = 0; config < 4; config++)
+    {
+        bool hugePages = (config & 1) != 0;
+        bool resetPages = (config & 2) != 0;
+        Js::Configuration::Global.flags.RecyclerHugePages = hugePages;
+        Js::Configuration::Global.flags.IdleDecommitResetPages = resetPages;
+
+        MemoryUsage before = GetMemoryUsage();
+
+#if ENABLE_BACKGROUND_PAGE_FREEING
+        PageAllocator::BackgroundPageQueue backgroundPageQueue;
+#endif
+        IdleDecommitPageAllocator pageAllocator(nullptr,
+            PageAllocatorType::PageAllocatorType_Thread,
+            Js::Configuration::Global.flags,
+            0 /* maxFreePageCount */, PageAllocator::DefaultMaxFreePageCount /* maxIdleFreePageCount */,
+            false /* zero pages */
+#if ENABLE_BACKGROUND_PAGE_FREEING
+            , &backgroundPageQueue
+#endif
+            );
+
+        MarkTimeCollectionWrapper collectionWrapper;
+
+        try
+        {
+#ifdef EXCEPTION_CHECK
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_DisableCheck);
+#endif
+
+            recyclerInstance = HeapNewZ(Recycler, nullptr, &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags);
+            recyclerInstance->Initialize(false /* forceInThread */, nullptr /* threadService */);
+            recyclerInstance->SetCollectionWrapper(&collectionWrapper);
+
+            // Use the same object graph for every configuration
+            srand(0);
+
+            RecyclerTestObject * stackRoots[stackRootCount];
+            for (unsigned int i = 0; i < stackRootCount; i++)
+            {
+                stackRoots[i] = nullptr;
+                roots.AddWeightedEntry(Location::Scanned(&stackRoots[i]), 1);
+            }
+
+            for (unsigned int i = 0; i < initializeCount * 10; i++)
+            {
+                InsertObject();
+            }
+
+            for (unsigned int i = 0; i < hugePageBenchCollectCount; i++)
+            {
+                recyclerInstance->CollectNow<CollectNowForceInThread>();
+            }
+
+            MemoryUsage live = GetMemoryUsage();
+
+            // Drop the heap, then go through idle decommit without waiting for its timer
+            for (unsigned int i = 0; i < stackRootCount; i++)
+            {
+                stackRoots[i] = nullptr;
+            }
+            roots.Clear();
+            recyclerInstance->CollectNow<CollectNowForceInThread>();
+            recyclerInstance->CollectNow<CollectNowForceInThread>();
+            recyclerInstance->ForEachPageAllocator([](IdleDecommitPageAllocator * idlePageAllocator)
+            {
+                idlePageAllocator->EnterIdleDecommit();
+                idlePageAllocator->LeaveIdleDecommit(false /* allowTimer */);
+            });
+
+            MemoryUsage idle = GetMemoryUsage();
+
+            wprintf(_u("huge pages %-3s reset pages %-3s: %8.3f ms average mark time\n"),
+                hugePages ? _u("on") : _u("off"), resetPages ? _u("on") : _u("off"),
+                collectionWrapper.GetAverageMarkMilliseconds());
+            wprintf(_u("    live heap: %8ld kB RSS, %8ld kB in huge pages\n"),
+                live.rss - before.rss, live.anonHugePages - before.anonHugePages);
+            wprintf(_u("    after idle decommit: %8ld kB RSS, %8ld kB of it lazily freed\n"),
+                idle.rss - before.rss, idle.lazyFree - before.lazyFree);
+
+            recyclerInstance->ShutdownThread();
+            HeapDelete(recyclerInstance);
+            recyclerInstance = nullptr;
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            printf("Error: OOM\n");
+            return;
+        }
+    }
+}
+#endif
+
+#ifndef _WIN32
+// MEM_RESET test.  The PAL implements MEM_RESET with madvise, which must only be applied to committed
+// pages of a single reservation, and must leave them committed and accessible.
+
+static const size_t memResetTestPageCount = 16;
+
+bool CheckMemReset(const char * description, LPVOID address, SIZE_T size, DWORD type, bool expectSuccess, DWORD expectedError)
+{
+    SetLastError(ERROR_SUCCESS);
+    LPVOID result = VirtualAlloc(address, size, type, PAGE_READWRITE);
+    bool succeeded = result != nullptr;
+    bool passed = succeeded == expectSuccess && (succeeded ? result == address : GetLastError() == expectedError);
+
+    wprintf(_u("%s: %S\n"), passed ? _u("PASS") : _u("FAIL"), description);
+    return passed;
+}
+
+bool MemResetTest()
+{
+    const size_t pageSize = AutoSystemInfo::PageSize;
+    const size_t committedPageCount = memResetTestPageCount / 2;
+
+    char * region = (char *)VirtualAlloc(nullptr, memResetTestPageCount * pageSize, MEM_RESERVE, PAGE_READWRITE);
+    if (region == nullptr || VirtualAlloc(region, committedPageCount * pageSize, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+    {
+        printf("Error: failed to allocate the test region\n");
+        return false;
+    }
+
+    // A region that is no longer reserved
+    char * released = (char *)VirtualAlloc(nullptr, pageSize, MEM_RESERVE, PAGE_READWRITE);
+    if (released == nullptr || !VirtualFree(released, 0, MEM_RELEASE))
+    {
+        printf("Error: failed to allocate the released region\n");
+        return false;
+    }
+
+    memset(region, 0xAB, committedPageCount * pageSize);
+
+    bool passed = true;
+    passed &= CheckMemReset("reset committed pages", region, committedPageCount * pageSize, MEM_RESET, true, ERROR_SUCCESS);
+    passed &= CheckMemReset("reset part of a page", region + 1, 16, MEM_RESET, true, ERROR_SUCCESS);
+    passed &= CheckMemReset("reset uncommitted pages", region + committedPageCount * pageSize, pageSize, MEM_RESET, false, ERROR_INVALID_ADDRESS);
+    passed &= CheckMemReset("reset committed and uncommitted pages", region + (committedPageCount - 1) * pageSize, 2 * pageSize, MEM_RESET, false, ERROR_INVALID_ADDRESS);
+    passed &= CheckMemReset("reset past the end of the region", region + (memResetTestPageCount - 1) * pageSize, 2 * pageSize, MEM_RESET, false, ERROR_INVALID_ADDRESS);
+    passed &= CheckMemReset("reset a released region", released, pageSize, MEM_RESET, false, ERROR_INVALID_ADDRESS);
+
+    // Reset pages stay committed, and read back as their old contents or as zeros
+    bool contentsKept = true;
+    for (size_t i = 0; i < committedPageCount * pageSize; i++)
+    {
+        contentsKept &= (region[i] == (char)0xAB || region[i] == 0);
+    }
+    memset(region, 0xCD, committedPageCount * pageSize);
+    for (size_t i = 0; i < committedPageCount * pageSize; i++)
+    {
+        contentsKept &= region[i] == (char)0xCD;
+    }
+    wprintf(_u("%s: reset pages are still committed\n"), contentsKept ? _u("PASS") : _u("FAIL"));
+    passed &= contentsKept;
+
+    VirtualFree(region, 0, MEM_RELEASE);
+    return passed;
+}
+#endif
+
+// Global handle table test.  Checks the bookkeeping of strong, weak and pinned handles, that freed nodes
+// are reused and that blocks are released once all their nodes are free.
+
+static const unsigned int handleTableTestCount = 1000;
+
+bool CheckHandleTable(const char * description, bool condition)
+{
+    wprintf(_u("%s: %S\n"), condition ? _u("PASS") : _u("FAIL"), description);
+    return condition;
+}
+
+bool HandleTableTest()
+{
+    static int values[handleTableTestCount];
+    GlobalHandleTable * table = HeapNewNoThrow(GlobalHandleTable);
+    if (table == nullptr)
+    {
+        printf("Error: OOM\n");
+        return false;
+    }
+
+    bool passed = true;
+
+    GlobalHandleTable::Node * strong = table->Allocate(&values[0], false /* weak */, false /* isPinned */);
+    GlobalHandleTable::Node * weak = table->Allocate(&values[1], true /* weak */, false /* isPinned */);
+    GlobalHandleTable::Node * pinnedStrong = table->Allocate(&values[2], false /* weak */, true /* isPinned */);
+    GlobalHandleTable::Node * pinnedWeak = table->Allocate(&values[3], true /* weak */, true /* isPinned */);
+    if (strong == nullptr || weak == nullptr || pinnedStrong == nullptr || pinnedWeak == nullptr)
+    {
+        printf("Error: OOM\n");
+        HeapDelete(table);
+        return false;
+    }
+    passed &= CheckHandleTable("allocate counts strong and weak handles",
+        table->GetStrongCount() == 2 && table->GetWeakCount() == 2);
+
+    // Only the strong handles that aren't pinned are roots
+    unsigned int strongRoots = 0;
+    table->MapStrong([&](void * value) { strongRoots++; passed &= (value == &values[0]); });
+    passed &= CheckHandleTable("pinned handles aren't roots", strongRoots == 1);
+
+    // Only the weak handles that aren't pinned are cleared
+    table->ClearWeak([](void *) { return true; });
+    passed &= CheckHandleTable("dead weak handles are cleared",
+        weak->value == nullptr && pinnedWeak->value == &values[3] && strong->value == &values[0]);
+
+    table->SetWeak(strong, true);
+    passed &= CheckHandleTable("a strong handle made weak is counted as weak",
+        strong->kind == GlobalHandleTable::NodeKind::Weak && table->GetStrongCount() == 1 && table->GetWeakCount() == 3);
+    table->SetWeak(strong, true);
+    passed &= CheckHandleTable("making a weak handle weak again doesn't change the counts",
+        table->GetStrongCount() == 1 && table->GetWeakCount() == 3);
+    table->ClearWeak([](void *) { return false; });
+    passed &= CheckHandleTable("live weak handles are kept", strong->value == &values[0]);
+    table->SetWeak(strong, false);
+    passed &= CheckHandleTable("a weak handle made strong is counted as strong",
+        strong->kind == GlobalHandleTable::NodeKind::Strong && table->GetStrongCount() == 2 && table->GetWeakCount() == 2);
+
+    table->Free(weak);
+    passed &= CheckHandleTable("free counts the handle out", table->GetStrongCount() == 2 && table->GetWeakCount() == 1);
+    GlobalHandleTable::Node * reused = table->Allocate(&values[4], false /* weak */, false /* isPinned */);
+    passed &= CheckHandleTable("a freed node is reused", reused == weak && reused->value == &values[4]);
+
+    table->Free(strong);
+    table->Free(pinnedStrong);
+    table->Free(pinnedWeak);
+    table->Free(reused);
+    passed &= CheckHandleTable("all handles are freed", table->GetStrongCount() == 0 && table->GetWeakCount() == 0);
+
+    // Fill several blocks, then free them in an order that empties the blocks one node at a time
+    static GlobalHandleTable::Node * nodes[handleTableTestCount];
+    for (unsigned int i = 0; i < handleTableTestCount; i++)
+    {
+        nodes[i] = table->Allocate(&values[i], (i & 1) != 0, false /* isPinned */);
+        if (nodes[i] == nullptr)
+        {
+            printf("Error: OOM\n");
+            HeapDelete(table);
+            return false;
+        }
+    }
+    const size_t blockCount = table->GetBlockCount();
+    passed &= CheckHandleTable("handles are spread over several blocks", blockCount > 1);
+
+    for (unsigned int i = 0; i < handleTableTestCount; i += 2)
+    {
+        table->Free(nodes[i]);
+    }
+    passed &= CheckHandleTable("blocks with handles are kept", table->GetBlockCount() == blockCount);
+    for (unsigned int i = 1; i < handleTableTestCount; i += 2)
+    {
+        table->Free(nodes[i]);
+    }
+    passed &= CheckHandleTable("empty blocks are released except for one",
+        table->GetBlockCount() == 1 && table->GetStrongCount() == 0 && table->GetWeakCount() == 0);
+
+    unsigned int liveHandles = 0;
+    table->MapStrong([&](void *) { liveHandles++; });
+    table->ClearWeak([&](void *) { liveHandles++; return false; });
+    passed &= CheckHandleTable("freed handles aren't visited", liveHandles == 0);
+
+    HeapDelete(table);
+    return passed;
+}
+
 //////////////////// End test implementations ////////////////////
 
 //////////////////// Begin test stubs ////////////////////
@@ -367,8 +803,12 @@ bool GetDeviceFamilyInfo(
 void usage(const WCHAR* self)
 {
     wprintf(
-        _u("usage: %s [-?|-v] [-js <jscript options from here on>]\n")
-        _u("  -v\n\tverbose logging\n"),
+        _u("usage: %s [-?|-v|-markbench|-hugepagebench|-memresettest|-handletabletest] [-js <jscript options from here on>]\n")
+        _u("  -v\n\tverbose logging\n")
+        _u("  -markbench\n\treport mark time for 1 to 16 parallel mark threads instead of running the stress test\n")
+        _u("  -hugepagebench\n\treport mark time and resident memory with and without huge pages and idle page resets (Linux only)\n")
+        _u("  -memresettest\n\tcheck that the PAL only resets committed pages with MEM_RESET, exits with 1 on failure (not on Windows)\n")
+        _u("  -handletabletest\n\tcheck the bookkeeping of the global handle table, exits with 1 on failure\n"),
         self);
 }
 
@@ -389,6 +829,22 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
             {
                 verbose = true;
             }
+            else if (wcscmp(argv[i], _u("-markbench")) == 0)
+            {
+                markBenchmark = true;
+            }
+            else if (wcscmp(argv[i], _u("-hugepagebench")) == 0)
+            {
+                hugePageBenchmark = true;
+            }
+            else if (wcscmp(argv[i], _u("-memresettest")) == 0)
+            {
+                memResetTest = true;
+            }
+            else if (wcscmp(argv[i], _u("-handletabletest")) == 0)
+            {
+                handleTableTest = true;
+            }
             else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
             {
                 jscriptOptions = i;
@@ -417,6 +873,30 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
     }
 
     // Run the actual test
+#if ENABLE_CONCURRENT_GC
+    if (markBenchmark)
+    {
+        MarkBenchmark();
+        return 0;
+    }
+#endif
+#if ENABLE_CONCURRENT_GC && defined(__linux__)
+    if (hugePageBenchmark)
+    {
+        HugePageBenchmark();
+        return 0;
+    }
+#endif
+#ifndef _WIN32
+    if (memResetTest)
+    {
+        return MemResetTest() ? 0 : 1;
+    }
+#endif
+    if (handleTableTest)
+    {
+        return HandleTableTest() ? 0 : 1;
+    }
     SimpleRecyclerTest();
 
     return 0;
@@ -63,7 +63,14 @@ class WeightedTable
         
         return entries[index];
     }
-    
+
+    void Clear()
+    {
+        free(entries);
+        entries = nullptr;
+        size = 0;
+    }
+
 private:
     T * entries;
     unsigned int size;
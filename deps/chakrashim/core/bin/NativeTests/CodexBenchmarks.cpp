@@ -0,0 +1,100 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#include "catch.hpp"
+#include <chrono>
+#include <vector>
+#include "Codex\Utf8Codex.h"
+
+#pragma warning(disable:6262) // CATCH is using stack variables to report errors, suppressing the preFAST warning.
+
+namespace CodexBenchmark
+{
+    //
+    // Throughput of UTF-8 <-> UTF-16 transcoding at each SIMD level. Hidden from the default run; use
+    //     NativeTests.exe [CodexBenchmark]
+    // to run it.
+    //
+    const charcount_t textLength = 1024 * 1024;
+    const int iterations = 32;
+
+    // Fills text with characters from alphabet, with every period-th character replaced by nonAscii (when period is not 0)
+    void FillText(std::vector<char16>& text, char16 nonAscii, charcount_t period)
+    {
+        text.resize(textLength);
+        for (charcount_t i = 0; i < textLength; i++)
+        {
+            text[i] = (period != 0 && i % period == 0) ? (char16)(nonAscii + i % 64) : (char16)('a' + i % 26);
+        }
+    }
+
+    template <typename TFunc>
+    double MegabytesPerSecond(size_t bytes, const TFunc func)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            func();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+        return (double)bytes * iterations / (1024 * 1024) / elapsed.count();
+    }
+
+    void RunTranscodingBenchmark(const char* name, const std::vector<char16>& text)
+    {
+        const char* levelNames[] = { "scalar", "sse2", "avx2" };
+        const utf8::SimdLevel levels[] = { utf8::SimdLevel::Scalar, utf8::SimdLevel::Sse2, utf8::SimdLevel::Avx2 };
+        const utf8::SimdLevel originalLevel = utf8::GetSimdLevel();
+
+        std::vector<utf8char_t> encoded(textLength * 3 + 1);
+        std::vector<char16> decoded(textLength);
+        const size_t encodedLength = utf8::EncodeTrueUtf8IntoAndNullTerminate(encoded.data(), text.data(), textLength);
+
+        for (size_t l = 0; l < _countof(levels); l++)
+        {
+            utf8::SetSimdLevel(levels[l]);
+            if (utf8::GetSimdLevel() != levels[l])
+            {
+                printf("%-8s %-6s not supported\n", name, levelNames[l]);
+                continue;
+            }
+
+            const double encodeRate = MegabytesPerSecond(encodedLength, [&]()
+            {
+                utf8::EncodeTrueUtf8IntoAndNullTerminate(encoded.data(), text.data(), textLength);
+            });
+            const double decodeRate = MegabytesPerSecond(encodedLength, [&]()
+            {
+                LPCUTF8 pch = encoded.data();
+                REQUIRE(utf8::DecodeUnitsInto(decoded.data(), pch, encoded.data() + encodedLength) == textLength);
+            });
+
+            printf("%-8s %-6s encode %8.1f MB/s  decode %8.1f MB/s\n", name, levelNames[l], encodeRate, decodeRate);
+            CHECK(memcmp(decoded.data(), text.data(), textLength * sizeof(char16)) == 0);
+        }
+
+        utf8::SetSimdLevel(originalLevel);
+    }
+
+    TEST_CASE("CodexBenchmark_Transcoding", "[.][CodexBenchmark]")
+    {
+        std::vector<char16> text;
+
+        FillText(text, 0, 0);
+        RunTranscodingBenchmark("ascii", text);
+
+        // Accented letters every few characters, as in most European languages
+        FillText(text, 0x00C0, 6);
+        RunTranscodingBenchmark("latin1", text);
+
+        // Mostly ideographs, with the occasional ASCII character
+        FillText(text, 0x4E00, 1);
+        for (charcount_t i = 0; i < textLength; i += 16)
+        {
+            text[i] = ' ';
+        }
+        RunTranscodingBenchmark("cjk", text);
+    }
+};
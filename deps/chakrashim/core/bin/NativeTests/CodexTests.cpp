@@ -280,4 +280,56 @@ namespace CodexTest
         
         RunUtf8DecodeTestCase(testCases, utf8::DecodeUnitsIntoAndNullTerminateNoAdvance);
     }
+
+    //
+    // Runs of ASCII characters are transcoded a block at a time, depending on the instruction sets the
+    // processor supports. Verify that every level gives the same results as the scalar code, with a
+    // non-ASCII character at every position within and around a block.
+    //
+    TEST_CASE("CodexTest_SimdLevels_MatchScalar", "[CodexTest]")
+    {
+        const charcount_t charCount = 80;
+        const char16 nonAsciiChars[] = { 0x00E9, 0x4E2D, 0xD83D };
+        const utf8::SimdLevel levels[] = { utf8::SimdLevel::Sse2, utf8::SimdLevel::Avx2 };
+        const utf8::SimdLevel originalLevel = utf8::GetSimdLevel();
+
+        for (size_t c = 0; c < _countof(nonAsciiChars); c++)
+        {
+            for (charcount_t position = 0; position < charCount; position++)
+            {
+                char16 source[charCount];
+                for (charcount_t i = 0; i < charCount; i++)
+                {
+                    source[i] = (char16)('a' + i % 26);
+                }
+                source[position] = nonAsciiChars[c];
+
+                utf8::SetSimdLevel(utf8::SimdLevel::Scalar);
+                utf8char_t expectedEncoding[charCount * 3 + 1];
+                const size_t expectedBytes = utf8::EncodeTrueUtf8IntoAndNullTerminate(expectedEncoding, source, charCount);
+                char16 expectedDecoding[charCount];
+                LPCUTF8 expectedEnd = expectedEncoding;
+                const size_t expectedChars = utf8::DecodeUnitsInto(expectedDecoding, expectedEnd, expectedEncoding + expectedBytes);
+
+                for (size_t l = 0; l < _countof(levels); l++)
+                {
+                    utf8::SetSimdLevel(levels[l]);
+
+                    utf8char_t encoding[charCount * 3 + 1];
+                    CHECK(utf8::CountTrueUtf8(source, charCount) == expectedBytes);
+                    REQUIRE(utf8::EncodeTrueUtf8IntoAndNullTerminate(encoding, source, charCount) == expectedBytes);
+                    CHECK(memcmp(encoding, expectedEncoding, expectedBytes) == 0);
+
+                    char16 decoding[charCount];
+                    LPCUTF8 end = encoding;
+                    REQUIRE(utf8::DecodeUnitsInto(decoding, end, encoding + expectedBytes) == expectedChars);
+                    CHECK(memcmp(decoding, expectedDecoding, expectedChars * sizeof(char16)) == 0);
+
+                    CHECK(utf8::ByteIndexIntoCharacterIndex(encoding, expectedBytes) == expectedChars);
+                }
+            }
+        }
+
+        utf8::SetSimdLevel(originalLevel);
+    }
 };
\ No newline at end of file
@@ -133,6 +133,120 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::WeakReferenceTest);
     }
 
+    void GlobalHandleTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef strongValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&strongValue) == JsNoError);
+        JsValueRef weakValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&weakValue) == JsNoError);
+
+        JsGlobalHandle strongHandle = nullptr;
+        REQUIRE(JsCreateGlobalHandle(strongValue, false, &strongHandle) == JsNoError);
+        JsGlobalHandle weakHandle = nullptr;
+        REQUIRE(JsCreateGlobalHandle(weakValue, true, &weakHandle) == JsNoError);
+
+        // Values that aren't recycler objects are pinned by the handle.
+        JsValueRef number = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(1, &number) == JsNoError);
+        JsGlobalHandle numberHandle = nullptr;
+        REQUIRE(JsCreateGlobalHandle(number, false, &numberHandle) == JsNoError);
+        CHECK(JsSetGlobalHandleWeak(numberHandle, true) == JsNoError);
+        CHECK(JsSetGlobalHandleWeak(numberHandle, false) == JsNoError);
+
+        JsValueRef valueFromHandle = JS_INVALID_REFERENCE;
+        CHECK(JsGetGlobalHandleValue(strongHandle, &valueFromHandle) == JsNoError);
+        CHECK(valueFromHandle == strongValue);
+        CHECK(JsGetGlobalHandleValue(weakHandle, &valueFromHandle) == JsNoError);
+        CHECK(valueFromHandle == weakValue);
+
+        // Clear the references on the stack, so that only the handles refer to the values.
+        strongValue = JS_INVALID_REFERENCE;
+        weakValue = JS_INVALID_REFERENCE;
+        valueFromHandle = JS_INVALID_REFERENCE;
+
+        CHECK(JsCollectGarbage(runtime) == JsNoError);
+
+        // The strong handle kept its value alive, the weak handle was cleared.
+        CHECK(JsGetGlobalHandleValue(strongHandle, &valueFromHandle) == JsNoError);
+        CHECK(valueFromHandle != JS_INVALID_REFERENCE);
+        JsValueType type;
+        CHECK(JsGetValueType(valueFromHandle, &type) == JsNoError);
+        CHECK(type == JsObject);
+        JsValueRef clearedValue = JS_INVALID_REFERENCE;
+        CHECK(JsGetGlobalHandleValue(weakHandle, &clearedValue) == JsNoError);
+        CHECK(clearedValue == JS_INVALID_REFERENCE);
+
+        // A cleared weak handle can't be made strong again.
+        CHECK(JsSetGlobalHandleWeak(weakHandle, false) == JsErrorInvalidArgument);
+
+        // Once made weak, the value of the strong handle is collected too.
+        CHECK(JsSetGlobalHandleWeak(strongHandle, true) == JsNoError);
+        valueFromHandle = JS_INVALID_REFERENCE;
+        CHECK(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(JsGetGlobalHandleValue(strongHandle, &valueFromHandle) == JsNoError);
+        CHECK(valueFromHandle == JS_INVALID_REFERENCE);
+
+        CHECK(JsReleaseGlobalHandle(strongHandle) == JsNoError);
+        CHECK(JsReleaseGlobalHandle(weakHandle) == JsNoError);
+        CHECK(JsReleaseGlobalHandle(numberHandle) == JsNoError);
+
+        // Released handles are reused.
+        JsGlobalHandle reusedHandle = nullptr;
+        REQUIRE(JsCreateGlobalHandle(number, false, &reusedHandle) == JsNoError);
+        CHECK(reusedHandle == numberHandle);
+        CHECK(JsReleaseGlobalHandle(reusedHandle) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_GlobalHandleTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::GlobalHandleTest);
+    }
+
+    void JsonUtf8ReaderTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ a: [1, 'caf\\u00e9', null], b: { c: '\\u0001\"' } })"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        JsValueRef space = JS_INVALID_REFERENCE;
+        REQUIRE(JsIntToNumber(1, &space) == JsNoError);
+
+        JsJsonUtf8Reader reader = nullptr;
+        REQUIRE(JsCreateJsonUtf8Reader(value, space, &reader) == JsNoError);
+        REQUIRE(reader != nullptr);
+
+        // The reader keeps what it serializes alive.
+        value = JS_INVALID_REFERENCE;
+        CHECK(JsCollectGarbage(runtime) == JsNoError);
+
+        uint8_t buffer[4];
+        size_t written = 0;
+        CHECK(JsReadJsonUtf8(reader, buffer, 3, &written) == JsErrorInvalidArgument);
+
+        // The text is read a few bytes at a time, without splitting characters.
+        std::string text;
+        do
+        {
+            REQUIRE(JsReadJsonUtf8(reader, buffer, sizeof(buffer), &written) == JsNoError);
+            CHECK(written <= sizeof(buffer));
+            text.append(reinterpret_cast<char *>(buffer), written);
+        } while (written > 0);
+        CHECK(text == "{\n \"a\": [\n  1,\n  \"caf\xc3\xa9\",\n  null\n ],\n \"b\": {\n  \"c\": \"\\u0001\\\"\"\n }\n}");
+
+        CHECK(JsReadJsonUtf8(reader, buffer, sizeof(buffer), &written) == JsNoError);
+        CHECK(written == 0);
+        CHECK(JsReleaseJsonUtf8Reader(reader) == JsNoError);
+
+        // There is nothing to read when JSON.stringify would return undefined.
+        JsValueRef undefined = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetUndefinedValue(&undefined) == JsNoError);
+        CHECK(JsCreateJsonUtf8Reader(undefined, JS_INVALID_REFERENCE, &reader) == JsNoError);
+        CHECK(reader == nullptr);
+    }
+
+    TEST_CASE("ApiTest_JsonUtf8ReaderTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsonUtf8ReaderTest);
+    }
+
     void ObjectsAndPropertiesTest1(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef object = JS_INVALID_REFERENCE;
@@ -359,6 +473,212 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalDataOnJsrtContextTest);
     }
 
+    // Backing store for the interceptor object: the named property "x" and the
+    // indexed property 7 are provided by the callbacks, everything else falls
+    // back to the object's own properties.
+    struct InterceptorState
+    {
+        bool hasNamed;
+        int named;
+        bool hasIndexed;
+        int indexed;
+    };
+
+    // Returns whether the interceptor handles key and, if so, the slot for it.
+    bool GetInterceptorSlot(JsValueRef object, JsValueRef key, bool **present, int **value)
+    {
+        InterceptorState *state = nullptr;
+        if (JsGetExternalData(object, reinterpret_cast<void **>(&state)) != JsNoError || state == nullptr)
+        {
+            return false;
+        }
+
+        JsValueType type;
+        if (JsGetValueType(key, &type) != JsNoError)
+        {
+            return false;
+        }
+
+        if (type == JsNumber)
+        {
+            int index;
+            if (JsNumberToInt(key, &index) != JsNoError || index != 7)
+            {
+                return false;
+            }
+            *present = &state->hasIndexed;
+            *value = &state->indexed;
+            return true;
+        }
+
+        char name[2];
+        size_t length = 0;
+        if (type != JsString ||
+            JsCopyString(key, name, sizeof(name), &length) != JsNoError ||
+            length != 1 || name[0] != 'x')
+        {
+            return false;
+        }
+        *present = &state->hasNamed;
+        *value = &state->named;
+        return true;
+    }
+
+    bool CALLBACK InterceptorGet(JsValueRef object, JsValueRef key, JsValueRef *value)
+    {
+        bool *present;
+        int *slot;
+        if (!GetInterceptorSlot(object, key, &present, &slot) || !*present)
+        {
+            return false;
+        }
+        return JsIntToNumber(*slot, value) == JsNoError;
+    }
+
+    bool CALLBACK InterceptorSet(JsValueRef object, JsValueRef key, JsValueRef value)
+    {
+        bool *present;
+        int *slot;
+        if (!GetInterceptorSlot(object, key, &present, &slot))
+        {
+            return false;
+        }
+        *present = true;
+        return JsNumberToInt(value, slot) == JsNoError;
+    }
+
+    bool CALLBACK InterceptorQuery(JsValueRef object, JsValueRef key, int *attributes)
+    {
+        bool *present;
+        int *slot;
+        if (!GetInterceptorSlot(object, key, &present, &slot) || !*present)
+        {
+            return false;
+        }
+
+        JsValueType type;
+        JsGetValueType(key, &type);
+        *attributes = type == JsNumber ?
+            JsInterceptorPropertyAttributes_ReadOnly :
+            JsInterceptorPropertyAttributes_None;
+        return true;
+    }
+
+    bool CALLBACK InterceptorDelete(JsValueRef object, JsValueRef key, bool *result)
+    {
+        bool *present;
+        int *slot;
+        if (!GetInterceptorSlot(object, key, &present, &slot))
+        {
+            return false;
+        }
+        *present = false;
+        *result = true;
+        return true;
+    }
+
+    bool CALLBACK InterceptorOwnKeys(JsValueRef object, JsValueRef *keys)
+    {
+        InterceptorState *state = nullptr;
+        if (JsGetExternalData(object, reinterpret_cast<void **>(&state)) != JsNoError ||
+            JsCreateArray(0, keys) != JsNoError)
+        {
+            return false;
+        }
+
+        int count = 0;
+        JsValueRef key = JS_INVALID_REFERENCE;
+        JsValueRef index = JS_INVALID_REFERENCE;
+        if (state->hasNamed)
+        {
+            JsCreateString("x", 1, &key);
+            JsIntToNumber(count++, &index);
+            JsSetIndexedProperty(*keys, index, key);
+        }
+        if (state->hasIndexed)
+        {
+            JsIntToNumber(7, &key);
+            JsIntToNumber(count++, &index);
+            JsSetIndexedProperty(*keys, index, key);
+        }
+        return true;
+    }
+
+    void InterceptorObjectTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        static const JsInterceptorCallbacks callbacks =
+        {
+            InterceptorGet,
+            InterceptorSet,
+            InterceptorQuery,
+            InterceptorDelete,
+            InterceptorOwnKeys
+        };
+
+        InterceptorState state = {};
+        JsValueRef object = JS_INVALID_REFERENCE;
+        CHECK(JsCreateInterceptorObject(&state, nullptr, JS_INVALID_REFERENCE, nullptr, &object) == JsErrorNullArgument);
+        REQUIRE(JsCreateInterceptorObject(&state, nullptr, JS_INVALID_REFERENCE, &callbacks, &object) == JsNoError);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("o"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, object, true) == JsNoError);
+
+        auto evaluate = [](const char16 *script) -> bool
+        {
+            JsValueRef result = JS_INVALID_REFERENCE;
+            bool value = false;
+            REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsBooleanToBool(result, &value) == JsNoError);
+            return value;
+        };
+
+        // Nothing is intercepted yet.
+        CHECK(evaluate(_u("o.x === undefined && !('x' in o) && o[7] === undefined && !(7 in o)")));
+
+        // Set and get, named and indexed. The values end up in the interceptor, not on the object.
+        CHECK(evaluate(_u("o.x = 5; o[7] = 9; o.x === 5 && o[7] === 9 && o['7'] === 9")));
+        CHECK(state.hasNamed);
+        CHECK(state.named == 5);
+        CHECK(state.hasIndexed);
+        CHECK(state.indexed == 9);
+        state.named = 6;
+        CHECK(evaluate(_u("o.x === 6")));
+
+        // Query: presence and attributes.
+        CHECK(evaluate(_u("'x' in o && o.hasOwnProperty('x') && 7 in o && o.hasOwnProperty(7)")));
+        CHECK(evaluate(_u("var d = Object.getOwnPropertyDescriptor(o, 'x'); d.value === 6 && d.writable && d.enumerable && d.configurable")));
+        CHECK(evaluate(_u("var d = Object.getOwnPropertyDescriptor(o, 7); d.value === 9 && !d.writable && d.enumerable && d.configurable")));
+
+        // Keys that are not intercepted fall back to the object's own properties.
+        CHECK(evaluate(_u("o.y = 1; o[8] = 2; o.y === 1 && o[8] === 2 && o.hasOwnProperty('y') && o.hasOwnProperty(8)")));
+        CHECK(state.named == 6);
+        CHECK(state.indexed == 9);
+
+        // Enumeration lists the intercepted keys along with the own properties.
+        CHECK(evaluate(_u("var k = []; for (var p in o) k.push(p); k.sort().join() === '7,8,x,y'")));
+        CHECK(evaluate(_u("Object.keys(o).sort().join() === '7,8,x,y'")));
+
+        // Delete, named and indexed, intercepted and not.
+        CHECK(evaluate(_u("delete o.x && delete o[7] && !('x' in o) && !(7 in o) && o.x === undefined && o[7] === undefined")));
+        CHECK(!state.hasNamed);
+        CHECK(!state.hasIndexed);
+        CHECK(evaluate(_u("delete o.y && delete o[8] && !('y' in o) && !(8 in o)")));
+        CHECK(evaluate(_u("Object.keys(o).length === 0")));
+
+        // Accesses from a loop, which may be jitted, keep going through the interceptor.
+        CHECK(evaluate(_u("var ok = true; for (var i = 0; i < 1000; i++) { o.x = i; o[7] = i; ok = ok && o.x === i && o[7] === i; } ok")));
+        CHECK(state.named == 999);
+        CHECK(state.indexed == 999);
+    }
+
+    TEST_CASE("ApiTest_InterceptorObjectTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::InterceptorObjectTest);
+    }
+
     void ArrayAndItemTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         // Create some arrays
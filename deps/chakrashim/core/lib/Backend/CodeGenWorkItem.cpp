@@ -53,6 +53,15 @@ bool CodeGenWorkItem::ShouldSpeculativelyJit(uint byteCodeSizeGenerated) const
         return false;
     }
 
+#ifdef ENABLE_PROFILE_CACHE
+    // Functions that were full JIT'd in the run that saved the profile cache don't need to wait for
+    // the interpreter and simple JIT to warm up, so don't hold them to the speculation caps either.
+    if(this->IsHotInProfileCache())
+    {
+        return true;
+    }
+#endif
+
     byteCodeSizeGenerated += this->GetByteCodeCount();
     if(CONFIG_FLAG(ProfileBasedSpeculativeJit))
     {
@@ -102,6 +111,20 @@ bool CodeGenWorkItem::ShouldSpeculativelyJitBasedOnProfile() const
     return false;
 }
 
+#ifdef ENABLE_PROFILE_CACHE
+bool CodeGenWorkItem::IsHotInProfileCache() const
+{
+    Js::FunctionBody* functionBody = this->GetFunctionBody();
+    Js::SourceDynamicProfileManager* profileManager = functionBody->GetSourceContextInfo()->sourceDynamicProfileManager;
+
+    // Only with the profile that made it hot; without one the full JIT code would just bail out.
+    return
+        profileManager != nullptr &&
+        functionBody->HasDynamicProfileInfo() &&
+        profileManager->IsFunctionHot(functionBody->GetLocalFunctionId());
+}
+#endif
+
 /*
     A comment about how to cause certain phases to only be on:
 
@@ -168,6 +168,9 @@ struct CodeGenWorkItem : public JsUtil::Job
     bool ShouldSpeculativelyJit(uint byteCodeSizeGenerated) const;
 private:
     bool ShouldSpeculativelyJitBasedOnProfile() const;
+#ifdef ENABLE_PROFILE_CACHE
+    bool IsHotInProfileCache() const;
+#endif
 
 public:
     bool IsInJitQueue() const
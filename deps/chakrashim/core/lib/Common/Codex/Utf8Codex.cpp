@@ -19,6 +19,19 @@
 #pragma warning(disable: 4127)  // constant expression for template parameter
 #endif
 
+#if defined(_M_X64) || defined(_M_IX86)
+#define CODEX_SIMD 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// Intrinsics of any instruction set can be used in any function
+#define CODEX_TARGET_AVX2
+#else
+#define CODEX_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
 namespace utf8
 {
     const unsigned int mAlignmentMask = 0x3;
@@ -38,6 +51,272 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+    SimdLevel simdLevelLimit = SimdLevel::Avx2;
+
+#ifdef CODEX_SIMD
+    static bool IsAvx2Supported()
+    {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // The OS must save the AVX registers (OSXSAVE, and XMM and YMM state in XCR0)
+        __cpuid(info, 1);
+        const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+        if ((info[2] & osxsaveAndAvx) != osxsaveAndAvx || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        // Also checks that the OS saves the AVX registers
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+
+    static SimdLevel GetSupportedSimdLevel()
+    {
+        // SSE2 is part of the baseline of both x86 and x64 builds
+        static const SimdLevel supported = IsAvx2Supported() ? SimdLevel::Avx2 : SimdLevel::Sse2;
+        return supported;
+    }
+#else
+    static SimdLevel GetSupportedSimdLevel()
+    {
+        return SimdLevel::Scalar;
+    }
+#endif
+
+    SimdLevel GetSimdLevel()
+    {
+        const SimdLevel supported = GetSupportedSimdLevel();
+        return simdLevelLimit < supported ? simdLevelLimit : supported;
+    }
+
+    void SetSimdLevel(SimdLevel level)
+    {
+        simdLevelLimit = level;
+    }
+
+#ifdef CODEX_SIMD
+    inline size_t CountTrailingZeros(uint32 value)
+    {
+        CodexAssert(value != 0);
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return index;
+#else
+        return __builtin_ctz(value);
+#endif
+    }
+
+    // The kernels below return the length of the run of ASCII characters at the start of their input, within
+    // the whole blocks of 16 code units (or 32 for AVX2) it contains, and widen or narrow that run into dest.
+    // The caller handles the rest one code unit at a time, and calls them again after the next ASCII characters.
+    // Only the run is written, as callers may size dest to the exact result.
+    //
+    // The AVX2 kernels don't call the SSE2 ones for the last block, which would mix VEX and legacy SSE
+    // encodings while the upper halves of the registers are in use.
+
+    inline size_t WidenAsciiPrefix(char16 *dest, LPCUTF8 src, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            dest[i] = src[i];
+        }
+        return length;
+    }
+
+    // dest is null when only counting
+    inline size_t NarrowAsciiPrefix(LPUTF8 dest, const char16 *src, size_t length)
+    {
+        if (dest != nullptr)
+        {
+            for (size_t i = 0; i < length; i++)
+            {
+                dest[i] = static_cast<utf8char_t>(src[i]);
+            }
+        }
+        return length;
+    }
+
+    static size_t WidenAsciiSse2(char16 *dest, LPCUTF8 src, size_t count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const uint32 nonAscii = _mm_movemask_epi8(bytes);
+            if (nonAscii != 0)
+            {
+                return i + WidenAsciiPrefix(dest + i, src + i, CountTrailingZeros(nonAscii));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+        return i;
+    }
+
+    CODEX_TARGET_AVX2
+    static size_t WidenAsciiAvx2(char16 *dest, LPCUTF8 src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+            const uint32 nonAscii = _mm256_movemask_epi8(bytes);
+            if (nonAscii != 0)
+            {
+                return i + WidenAsciiPrefix(dest + i, src + i, CountTrailingZeros(nonAscii));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+        }
+        if (i + 16 <= count)
+        {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const uint32 nonAscii = _mm_movemask_epi8(bytes);
+            if (nonAscii != 0)
+            {
+                return i + WidenAsciiPrefix(dest + i, src + i, CountTrailingZeros(nonAscii));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + i), _mm256_cvtepu8_epi16(bytes));
+            i += 16;
+        }
+        return i;
+    }
+
+    static size_t NarrowAsciiSse2(LPUTF8 dest, const char16 *src, size_t count)
+    {
+        const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+
+            // Two bits (one per byte) for every code unit that isn't ASCII
+            const uint32 nonAscii = ~(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(low, nonAsciiBits), zero)) |
+                (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(high, nonAsciiBits), zero)) << 16));
+            if (nonAscii != 0)
+            {
+                return i + NarrowAsciiPrefix(dest == nullptr ? nullptr : dest + i, src + i, CountTrailingZeros(nonAscii) / 2);
+            }
+            if (dest != nullptr)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(low, high));
+            }
+        }
+        return i;
+    }
+
+    CODEX_TARGET_AVX2
+    static size_t NarrowAsciiAvx2(LPUTF8 dest, const char16 *src, size_t count)
+    {
+        const __m256i nonAsciiBits = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+            if (!_mm256_testz_si256(units, nonAsciiBits))
+            {
+                const uint32 nonAscii = ~_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(units, nonAsciiBits), zero));
+                return i + NarrowAsciiPrefix(dest == nullptr ? nullptr : dest + i, src + i, CountTrailingZeros(nonAscii) / 2);
+            }
+            if (dest != nullptr)
+            {
+                const __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(units), _mm256_extracti128_si256(units, 1));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), packed);
+            }
+        }
+        return i;
+    }
+
+    static size_t SkipAsciiSse2(LPCUTF8 src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            const uint32 nonAscii = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+            if (nonAscii != 0)
+            {
+                return i + CountTrailingZeros(nonAscii);
+            }
+        }
+        return i;
+    }
+
+    CODEX_TARGET_AVX2
+    static size_t SkipAsciiAvx2(LPCUTF8 src, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32)
+        {
+            const uint32 nonAscii = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)));
+            if (nonAscii != 0)
+            {
+                return i + CountTrailingZeros(nonAscii);
+            }
+        }
+        if (i + 16 <= count)
+        {
+            const uint32 nonAscii = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i)));
+            return i + (nonAscii != 0 ? CountTrailingZeros(nonAscii) : 16);
+        }
+        return i;
+    }
+
+    static size_t WidenAscii(char16 *dest, LPCUTF8 src, size_t count)
+    {
+        switch (GetSimdLevel())
+        {
+        case SimdLevel::Avx2:
+            return WidenAsciiAvx2(dest, src, count);
+        case SimdLevel::Sse2:
+            return WidenAsciiSse2(dest, src, count);
+        default:
+            return 0;
+        }
+    }
+
+    static size_t NarrowAscii(LPUTF8 dest, const char16 *src, size_t count)
+    {
+        switch (GetSimdLevel())
+        {
+        case SimdLevel::Avx2:
+            return NarrowAsciiAvx2(dest, src, count);
+        case SimdLevel::Sse2:
+            return NarrowAsciiSse2(dest, src, count);
+        default:
+            return 0;
+        }
+    }
+
+    static size_t SkipAscii(LPCUTF8 src, size_t count)
+    {
+        switch (GetSimdLevel())
+        {
+        case SimdLevel::Avx2:
+            return SkipAsciiAvx2(src, count);
+        case SimdLevel::Sse2:
+            return SkipAsciiSse2(src, count);
+        default:
+            return 0;
+        }
+    }
+#endif
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -366,6 +645,15 @@ namespace utf8
         LPCUTF8 p = pbUtf8;
         char16 *dest = buffer;
 
+#ifdef CODEX_SIMD
+LSimdPath:
+        {
+            const size_t widened = WidenAscii(dest, p, pbEnd - p);
+            p += widened;
+            dest += widened;
+        }
+#endif
+
         if (!ShouldFastPath(p, dest)) goto LSlowPath;
 
 LFastPath:
@@ -396,6 +684,10 @@ namespace utf8
                 break;
             }
 
+#ifdef CODEX_SIMD
+            // Possibly the start of a run of ASCII characters
+            if (chDest < 0x80 && p < pbEnd && *p < 0x80) goto LSimdPath;
+#endif
             if (ShouldFastPath(p, dest)) goto LFastPath;
         }
 
@@ -440,6 +732,19 @@ namespace utf8
 
         CodexAssertOrFailFast(dest <= bufferEnd);
 
+#ifdef CODEX_SIMD
+LSimdPath:
+        {
+            // Don't write past bufferEnd, the slow path fails fast if the buffer is too small
+            const size_t available = countBytesOnly ? cch : static_cast<LPCUTF8>(bufferEnd) - dest;
+            const size_t count = cch < available ? cch : available;
+            const size_t narrowed = NarrowAscii(countBytesOnly ? nullptr : dest, source, count);
+            dest += narrowed;
+            source += narrowed;
+            cch -= static_cast<charcount_t>(narrowed);
+        }
+#endif
+
         if (!ShouldFastPath(dest, source)) goto LSlowPath;
 
 LFastPath:
@@ -467,6 +772,9 @@ namespace utf8
             while (cch-- > 0)
             {
                 dest = Encode<countBytesOnly>(*source++, dest, bufferEnd);
+#ifdef CODEX_SIMD
+                if (source[-1] < 0x80 && cch > 0 && *source < 0x80) goto LSimdPath;
+#endif
                 if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
@@ -479,6 +787,9 @@ namespace utf8
                 // EncodeTrueUtf8 will consume the low surrogate code unit too by decrementing cch
                 // and incrementing source
                 dest = EncodeTrueUtf8<countBytesOnly>(*source++, &source, &cch, dest, bufferEnd);
+#ifdef CODEX_SIMD
+                if (source[-1] < 0x80 && cch > 0 && *source < 0x80) goto LSimdPath;
+#endif
                 if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
@@ -515,6 +826,63 @@ namespace utf8
         return result;
     }
 
+    __range(0, cbBuffer)
+        size_t EncodeTrueUtf8IntoTruncated(__out_ecount(cbBuffer) utf8char_t *buffer, size_t cbBuffer, __in_ecount(cch) const char16 *source, charcount_t cch, _Out_ charcount_t *cchEncoded)
+    {
+        const char16 *const sourceStart = source;
+        const LPUTF8 bufferEnd = buffer + cbBuffer;
+        LPUTF8 dest = buffer;
+
+        while (cch > 0)
+        {
+            const size_t available = bufferEnd - dest;
+
+            // A code unit takes at most 3 bytes (a surrogate pair takes 4), so the first available / 3 code units
+            // always fit. Encoding them in one go keeps this a single pass over the source; the remaining space
+            // shrinks geometrically.
+            charcount_t count = available / 3 < cch ? static_cast<charcount_t>(available / 3) : cch;
+            if (count > 0 && count < cch &&
+                (source[count - 1] >= 0xD800 && source[count - 1] <= 0xDBFF) &&
+                (source[count] >= 0xDC00 && source[count] <= 0xDFFF))
+            {
+                count--;
+            }
+
+            if (count == 0)
+            {
+                // Fewer bytes left than the next code point may take; encode it only if it fits
+                const char16 ch = *source;
+                size_t needed = 3;
+                count = 1;
+                if (ch < 0x80)
+                {
+                    needed = 1;
+                }
+                else if (ch < 0x800)
+                {
+                    needed = 2;
+                }
+                else if (cch > 1 && (ch >= 0xD800 && ch <= 0xDBFF) && (source[1] >= 0xDC00 && source[1] <= 0xDFFF))
+                {
+                    needed = 4;
+                    count = 2;
+                }
+
+                if (needed > available)
+                {
+                    break;
+                }
+            }
+
+            dest += EncodeIntoImpl<false, false>(dest, source, count, bufferEnd);
+            source += count;
+            cch -= count;
+        }
+
+        *cchEncoded = static_cast<charcount_t>(source - sourceStart);
+        return dest - buffer;
+    }
+
     __range(0, cch * 3)
         size_t CountTrueUtf8(__in_ecount(cch) const char16 *source, charcount_t cch)
     {
@@ -538,6 +906,14 @@ namespace utf8
         // Avoid using a reinterpret_cast to start a misaligned read.
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 LFastPath:
+#ifdef CODEX_SIMD
+        {
+            const size_t available = pchEnd - pchCurrent;
+            const size_t skipped = SkipAscii(pchCurrent, i < available ? i : available);
+            pchCurrent += skipped;
+            i -= static_cast<charcount_t>(skipped);
+        }
+#endif
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4 && i > 4)
         {
@@ -575,6 +951,13 @@ namespace utf8
         if (!IsAligned(pchCurrent)) goto LSlowPath;
 
 LFastPath:
+#ifdef CODEX_SIMD
+        {
+            const size_t skipped = SkipAscii(pchCurrent, pchEnd - pchCurrent);
+            pchCurrent += skipped;
+            i += static_cast<charcount_t>(skipped);
+        }
+#endif
         // Skip 4 bytes at a time.
         while (pchCurrent < pchEndMinus4)
         {
@@ -422,6 +422,12 @@ namespace utf8
     __range(0, cch * 3)
     size_t EncodeTrueUtf8IntoBoundsChecked(__out_ecount(cch * 3 + 1) utf8char_t *buffer, __in_ecount(cch) const char16 *source, charcount_t cch, const void * bufferEnd);
 
+    // Like EncodeTrueUtf8IntoBoundsChecked but, instead of failing when the buffer is too small, stops before the
+    // first code point that doesn't fit, so that buffer holds whole code points only. A surrogate pair is never split.
+    // Returns the number of bytes written; cchEncoded receives the number of UTF16 code units they encode.
+    __range(0, cbBuffer)
+    size_t EncodeTrueUtf8IntoTruncated(__out_ecount(cbBuffer) utf8char_t *buffer, size_t cbBuffer, __in_ecount(cch) const char16 *source, charcount_t cch, _Out_ charcount_t *cchEncoded);
+
     // Determine the number of bytes that a UTF-8 sequence representing a UTF16-LE sequence of cch words
     __range(0, cch * 3)
     size_t CountTrueUtf8(__in_ecount(cch) const char16 *source, charcount_t cch);
@@ -435,6 +441,18 @@ namespace utf8
 
     // Convert byte index into character index
     charcount_t ByteIndexIntoCharacterIndex(__in_ecount(cbIndex) LPCUTF8 pch, size_t cbIndex, DecodeOptions options = doDefault);
+
+    // Instruction sets the functions above use for runs of ASCII characters. By default the best one the
+    // processor supports is used; SetSimdLevel lowers it (e.g. to compare the kernels in tests and benchmarks).
+    enum class SimdLevel
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    SimdLevel GetSimdLevel();
+    void SetSimdLevel(SimdLevel level);   // Capped to what the processor supports
 }
 
 #ifdef _MSC_VER
@@ -173,12 +173,8 @@
 
 #ifndef ENABLE_VALGRIND
 #define ENABLE_CONCURRENT_GC 1
-#ifdef _WIN32
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 1 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #else
-#define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
-#endif
-#else
 #define ENABLE_CONCURRENT_GC 0
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #endif
@@ -298,6 +294,9 @@
 #if defined(_WIN32) && defined(TARGET_64) && !defined(_M_ARM64)
 #define ENABLE_FAST_ARRAYBUFFER 1
 #endif
+
+// Persist dynamic profiles across processes (JsSetProfileCacheDirectory)
+#define ENABLE_PROFILE_CACHE
 #endif
 
 // Other features
@@ -37,6 +37,7 @@ class FinalizableObject;
 #include "Memory/HeapBlockMap.h"
 #include "Memory/RecyclerObjectDumper.h"
 #include "Memory/RecyclerWeakReference.h"
+#include "Memory/GlobalHandleTable.h"
 #include "Memory/RecyclerSweep.h"
 #include "Memory/RecyclerHeuristic.h"
 #include "Memory/MarkContext.h"
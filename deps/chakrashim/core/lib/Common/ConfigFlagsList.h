@@ -745,6 +745,9 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_ParallelMarkThreads  (0)
+#define DEFAULT_CONFIG_RecyclerHugePages    (false)
+#define DEFAULT_CONFIG_IdleDecommitResetPages (false)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -1379,9 +1382,12 @@ FLAGNR(Boolean, RecyclerTrackStress, "Stress tracked object handling by simulati
 FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false positive object marks", false)
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
+FLAGR (Boolean, RecyclerHugePages, "Hint the OS to back recycler segments with transparent huge pages (Linux only)", DEFAULT_CONFIG_RecyclerHugePages)
+FLAGR (Boolean, IdleDecommitResetPages, "After idle decommit, let the OS reclaim the free pages that are kept for reuse (MEM_RESET / MADV_FREE)", DEFAULT_CONFIG_IdleDecommitResetPages)
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
+FLAGR (Number,  ParallelMarkThreads, "Number of threads used for parallel mark, including the collecting thread (0 = up to 4, depending on processor count; max 16)", DEFAULT_CONFIG_ParallelMarkThreads)
 FLAGRA(Boolean, EnableConcurrentSweepAlloc, ecsa, "Turns off the feature to allow allocations during concurrent sweep.", true)
 #endif
 #ifdef RECYCLER_PAGE_HEAP
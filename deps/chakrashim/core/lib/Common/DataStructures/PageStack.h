@@ -25,6 +25,7 @@ class PageStack
     bool Push(T item);
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
+    uint TransferChunks(PageStack<T> * targetStack, uint maxChunkCount);
 
     void Abort();
     void Release();
@@ -44,7 +45,7 @@ class PageStack
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 15;    // Not counting original stack, so this supports 16-way parallel
 
 private:
     Chunk * CreateChunk();
@@ -356,6 +357,64 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+uint PageStack<T>::TransferChunks(PageStack<T> * targetStack, uint maxChunkCount)
+{
+    // Move up to [maxChunkCount] chunks from this stack to [targetStack].
+    // Only the full chunks below the current chunk are moved, so this never touches the entries
+    // the owner of the stack is currently working on.
+    // The chunks end up below the current chunk of the target stack, or become its current chunk
+    // if the target stack doesn't have one.
+
+    Assert(maxChunkCount > 0);
+    Assert(targetStack != this);
+
+    if (this->currentChunk == nullptr || this->currentChunk->nextChunk == nullptr)
+    {
+        return 0;
+    }
+
+    Chunk * firstChunk = this->currentChunk->nextChunk;
+    Chunk * lastChunk = firstChunk;
+    uint chunkCount = 1;
+    while (chunkCount < maxChunkCount && lastChunk->nextChunk != nullptr)
+    {
+        lastChunk = lastChunk->nextChunk;
+        chunkCount++;
+    }
+
+    // Unlink the chunks from this stack
+    this->currentChunk->nextChunk = lastChunk->nextChunk;
+
+    if (targetStack->currentChunk == nullptr)
+    {
+        // The first chunk becomes the current chunk of the target stack.
+        // It is full, so the target stack starts popping from the end of it.
+        lastChunk->nextChunk = nullptr;
+        targetStack->currentChunk = firstChunk;
+        targetStack->chunkStart = firstChunk->entries;
+        targetStack->chunkEnd = &firstChunk->entries[EntriesPerChunk];
+        targetStack->nextEntry = targetStack->chunkEnd;
+    }
+    else
+    {
+        lastChunk->nextChunk = targetStack->currentChunk->nextChunk;
+        targetStack->currentChunk->nextChunk = firstChunk;
+    }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount -= chunkCount;
+    targetStack->pageCount += chunkCount;
+#endif
+#if DBG
+    this->count -= chunkCount * EntriesPerChunk;
+    targetStack->count += chunkCount * EntriesPerChunk;
+#endif
+
+    return chunkCount;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+namespace JsUtil
+{
+    // Maps numbers to unsigned keys that sort in the same order as the numbers. Signed integers have their
+    // sign bit flipped. Floating point numbers have their sign bit flipped if positive and all of their bits
+    // flipped if negative, which also puts -0 before +0. NaNs don't have a place in that order, so they must
+    // be moved out of the way before sorting.
+    template <typename T> struct RadixSortKey;
+
+#define RADIX_SORT_INTEGER_KEY(T, TKey, flip)                                       \
+    template <> struct RadixSortKey<T>                                              \
+    {                                                                               \
+        typedef TKey Type;                                                          \
+        static Type ToKey(T value) { return (Type)value ^ (Type)(flip); }           \
+        static T FromKey(Type key) { return (T)(Type)(key ^ (Type)(flip)); }        \
+    };
+
+    RADIX_SORT_INTEGER_KEY(bool, uint8, 0)
+    RADIX_SORT_INTEGER_KEY(int8, uint8, 0x80)
+    RADIX_SORT_INTEGER_KEY(uint8, uint8, 0)
+    RADIX_SORT_INTEGER_KEY(int16, uint16, 0x8000)
+    RADIX_SORT_INTEGER_KEY(uint16, uint16, 0)
+    RADIX_SORT_INTEGER_KEY(int32, uint32, 0x80000000)
+    RADIX_SORT_INTEGER_KEY(uint32, uint32, 0)
+    RADIX_SORT_INTEGER_KEY(int64, uint64, 0x8000000000000000ull)
+    RADIX_SORT_INTEGER_KEY(uint64, uint64, 0)
+#undef RADIX_SORT_INTEGER_KEY
+
+#define RADIX_SORT_FLOAT_KEY(T, TKey, signBit)                                      \
+    template <> struct RadixSortKey<T>                                              \
+    {                                                                               \
+        typedef TKey Type;                                                          \
+        static Type ToKey(T value)                                                  \
+        {                                                                           \
+            Type bits = *reinterpret_cast<Type *>(&value);                          \
+            return (bits & (signBit)) ? ~bits : bits | (signBit);                   \
+        }                                                                           \
+        static T FromKey(Type key)                                                  \
+        {                                                                           \
+            Type bits = (key & (signBit)) ? key & ~(signBit) : ~key;                \
+            return *reinterpret_cast<T *>(&bits);                                   \
+        }                                                                           \
+    };
+
+    RADIX_SORT_FLOAT_KEY(float, uint32, 0x80000000ul)
+    RADIX_SORT_FLOAT_KEY(double, uint64, 0x8000000000000000ull)
+#undef RADIX_SORT_FLOAT_KEY
+
+    // Stable LSD radix sort of numbers in ascending order, one byte of the key per pass. Passes over bytes
+    // that are the same in every element are skipped, so small integers in wide types sort in fewer passes.
+    template <typename T>
+    class RadixSort
+    {
+    private:
+        typedef typename RadixSortKey<T>::Type Key;
+        static const uint KeyBytes = sizeof(Key);
+        static const uint RadixBits = 8;
+        static const uint RadixSize = 1 << RadixBits;
+
+        // Below this many elements, the counting passes cost more than they save
+        static const uint32 InsertionSortThreshold = 64;
+
+        static uint GetDigit(Key key, uint pass)
+        {
+            return (uint)(key >> (pass * RadixBits)) & (RadixSize - 1);
+        }
+
+        static void InsertionSort(Key* keys, uint32 count)
+        {
+            for (uint32 i = 1; i < count; i++)
+            {
+                Key key = keys[i];
+                uint32 j = i;
+                for (; j > 0 && keys[j - 1] > key; j--)
+                {
+                    keys[j] = keys[j - 1];
+                }
+                keys[j] = key;
+            }
+        }
+
+    public:
+        // Returns false, without changing the elements, if the temporary buffer couldn't be allocated.
+        static bool Sort(__inout_ecount(count) T* elements, uint32 count)
+        {
+            if (count < 2)
+            {
+                return true;
+            }
+
+            Key* buffer = nullptr;
+            if (count >= InsertionSortThreshold)
+            {
+                buffer = HeapNewNoThrowArray(Key, count);
+                if (buffer == nullptr)
+                {
+                    return false;
+                }
+            }
+
+            // Sort the keys in place of the elements
+            Key* keys = reinterpret_cast<Key*>(elements);
+            for (uint32 i = 0; i < count; i++)
+            {
+                keys[i] = RadixSortKey<T>::ToKey(elements[i]);
+            }
+
+            if (buffer == nullptr)
+            {
+                InsertionSort(keys, count);
+            }
+            else
+            {
+                uint32 counts[KeyBytes][RadixSize];
+                memset(counts, 0, sizeof(counts));
+                for (uint32 i = 0; i < count; i++)
+                {
+                    for (uint pass = 0; pass < KeyBytes; pass++)
+                    {
+                        counts[pass][GetDigit(keys[i], pass)]++;
+                    }
+                }
+
+                Key* source = keys;
+                Key* destination = buffer;
+                for (uint pass = 0; pass < KeyBytes; pass++)
+                {
+                    uint32* passCounts = counts[pass];
+                    if (passCounts[GetDigit(source[0], pass)] == count)
+                    {
+                        continue;
+                    }
+
+                    // Turn the counts into the start offset of each digit
+                    uint32 offset = 0;
+                    for (uint digit = 0; digit < RadixSize; digit++)
+                    {
+                        uint32 digitCount = passCounts[digit];
+                        passCounts[digit] = offset;
+                        offset += digitCount;
+                    }
+
+                    for (uint32 i = 0; i < count; i++)
+                    {
+                        destination[passCounts[GetDigit(source[i], pass)]++] = source[i];
+                    }
+
+                    Key* swap = source;
+                    source = destination;
+                    destination = swap;
+                }
+
+                if (source != keys)
+                {
+                    js_memcpy_s(keys, count * sizeof(Key), source, count * sizeof(Key));
+                }
+                HeapDeleteArray(count, buffer);
+            }
+
+            for (uint32 i = 0; i < count; i++)
+            {
+                elements[i] = RadixSortKey<T>::FromKey(keys[i]);
+            }
+            return true;
+        }
+    };
+}
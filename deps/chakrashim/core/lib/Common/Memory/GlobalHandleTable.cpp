@@ -0,0 +1,177 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+GlobalHandleTable::GlobalHandleTable() :
+    availableBlockList(nullptr),
+    fullBlockList(nullptr),
+    blockCount(0),
+    strongCount(0),
+    weakCount(0)
+{
+}
+
+GlobalHandleTable::~GlobalHandleTable()
+{
+    // The host may still hold handles, they are released with the recycler
+    DeleteBlocks(availableBlockList);
+    DeleteBlocks(fullBlockList);
+}
+
+void
+GlobalHandleTable::DeleteBlocks(Block * list)
+{
+    Block * block = list;
+    while (block != nullptr)
+    {
+        Block * next = block->next;
+        HeapDelete(block);
+        block = next;
+    }
+}
+
+GlobalHandleTable::Block *
+GlobalHandleTable::GetBlock(Node * node)
+{
+    Node * firstNode = node - node->index;
+    return reinterpret_cast<Block *>(reinterpret_cast<char *>(firstNode) - offsetof(Block, nodes));
+}
+
+void
+GlobalHandleTable::LinkBlock(Block ** list, Block * block)
+{
+    block->prev = nullptr;
+    block->next = *list;
+    if (*list != nullptr)
+    {
+        (*list)->prev = block;
+    }
+    *list = block;
+}
+
+void
+GlobalHandleTable::UnlinkBlock(Block ** list, Block * block)
+{
+    if (block->prev != nullptr)
+    {
+        block->prev->next = block->next;
+    }
+    else
+    {
+        Assert(*list == block);
+        *list = block->next;
+    }
+
+    if (block->next != nullptr)
+    {
+        block->next->prev = block->prev;
+    }
+    block->prev = nullptr;
+    block->next = nullptr;
+}
+
+bool
+GlobalHandleTable::AddBlock()
+{
+    Block * block = HeapNewNoThrowStruct(Block);
+    if (block == nullptr)
+    {
+        return false;
+    }
+
+    // Thread the new nodes onto the free list in address order
+    for (uint i = 0; i < NodesPerBlock; i++)
+    {
+        Node& node = block->nodes[i];
+        node.value = (i + 1 < NodesPerBlock) ? &block->nodes[i + 1] : nullptr;
+        node.kind = NodeKind::Free;
+        node.isPinned = false;
+        node.index = (uint8)i;
+    }
+
+    block->freeList = &block->nodes[0];
+    block->usedCount = 0;
+    LinkBlock(&availableBlockList, block);
+    blockCount++;
+    return true;
+}
+
+GlobalHandleTable::Node *
+GlobalHandleTable::Allocate(void * value, bool weak, bool isPinned)
+{
+    Assert(value != nullptr);
+
+    if (availableBlockList == nullptr && !AddBlock())
+    {
+        return nullptr;
+    }
+
+    Block * block = availableBlockList;
+    Node * node = block->freeList;
+    Assert(node->kind == NodeKind::Free);
+    block->freeList = static_cast<Node *>(node->value);
+    block->usedCount++;
+    if (block->freeList == nullptr)
+    {
+        UnlinkBlock(&availableBlockList, block);
+        LinkBlock(&fullBlockList, block);
+    }
+
+    node->value = value;
+    node->kind = weak ? NodeKind::Weak : NodeKind::Strong;
+    node->isPinned = isPinned;
+    (weak ? weakCount : strongCount)++;
+    return node;
+}
+
+void
+GlobalHandleTable::Free(Node * node)
+{
+    Assert(node->kind != NodeKind::Free);
+
+    (node->kind == NodeKind::Weak ? weakCount : strongCount)--;
+    node->kind = NodeKind::Free;
+    node->isPinned = false;
+
+    Block * block = GetBlock(node);
+    Assert(block->usedCount > 0);
+    const bool wasFull = (block->freeList == nullptr);
+    node->value = block->freeList;
+    block->freeList = node;
+    block->usedCount--;
+
+    if (wasFull)
+    {
+        // Allocate from this block next, so that the freed node is reused
+        UnlinkBlock(&fullBlockList, block);
+        LinkBlock(&availableBlockList, block);
+    }
+    else if (block->usedCount == 0 && (block->prev != nullptr || block->next != nullptr))
+    {
+        // Keep the last block with free nodes, release the other empty ones
+        UnlinkBlock(&availableBlockList, block);
+        HeapDelete(block);
+        blockCount--;
+    }
+}
+
+void
+GlobalHandleTable::SetWeak(Node * node, bool weak)
+{
+    Assert(node->kind != NodeKind::Free);
+
+    const NodeKind kind = weak ? NodeKind::Weak : NodeKind::Strong;
+    if (node->kind == kind)
+    {
+        return;
+    }
+
+    // A cleared weak handle can't be made strong again
+    Assert(weak || node->value != nullptr);
+
+    (weak ? strongCount : weakCount)--;
+    (weak ? weakCount : strongCount)++;
+    node->kind = kind;
+}
@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+///
+/// Handles through which the host refers to recycler objects for an unbounded amount of time,
+/// e.g. for the lifetime of a native object wrapping a script object.
+/// A strong handle keeps its object alive; a weak handle doesn't, and is cleared when its object
+/// is collected. Pinned handles are ignored by the recycler, their objects are either not recycler
+/// objects or are kept alive by the host through RootAddRef.
+///
+/// Handles are nodes carved from fixed-size blocks and recycled through a free list per block, so creating
+/// and releasing a handle doesn't hash the object the way RootAddRef/RootRelease do, and the strong handles
+/// are marked by walking the blocks. A block is released once all its nodes are free, unless it is the
+/// last block with free nodes, so that a handle going back and forth at a block boundary doesn't allocate.
+///
+class GlobalHandleTable
+{
+public:
+    enum class NodeKind : uint8
+    {
+        Free,
+        Strong,
+        Weak
+    };
+
+    struct Node
+    {
+        void * value;               // Object referenced, nullptr if a weak handle was cleared, next free node if free
+        NodeKind kind;
+        bool isPinned;
+        uint8 index;                // Position in its block
+    };
+
+    GlobalHandleTable();
+    ~GlobalHandleTable();
+
+    // Returns nullptr if out of memory
+    Node * Allocate(void * value, bool weak, bool isPinned);
+    void Free(Node * node);
+    void SetWeak(Node * node, bool weak);
+
+    size_t GetStrongCount() const { return strongCount; }
+    size_t GetWeakCount() const { return weakCount; }
+    size_t GetBlockCount() const { return blockCount; }
+
+    template <typename Fn>
+    void MapStrong(Fn fn) const
+    {
+        if (strongCount == 0)
+        {
+            return;
+        }
+
+        MapNodes([&](Node& node)
+        {
+            if (node.kind == NodeKind::Strong && !node.isPinned)
+            {
+                fn(node.value);
+            }
+        });
+    }
+
+    // Clears the weak handles whose object isDead
+    template <typename Fn>
+    void ClearWeak(Fn isDead)
+    {
+        if (weakCount == 0)
+        {
+            return;
+        }
+
+        MapNodes([&](Node& node)
+        {
+            if (node.kind == NodeKind::Weak && !node.isPinned && node.value != nullptr && isDead(node.value))
+            {
+                node.value = nullptr;
+            }
+        });
+    }
+
+private:
+    // The index of a node fits in a uint8
+    static const uint NodesPerBlock = 255;
+
+    struct Block
+    {
+        Block * prev;
+        Block * next;
+        Node * freeList;
+        uint usedCount;
+        Node nodes[NodesPerBlock];
+    };
+
+    static Block * GetBlock(Node * node);
+    static void LinkBlock(Block ** list, Block * block);
+    static void UnlinkBlock(Block ** list, Block * block);
+    static void DeleteBlocks(Block * list);
+
+    bool AddBlock();
+
+    template <typename Fn>
+    void MapNodes(Fn fn) const
+    {
+        Block * const lists[] = { availableBlockList, fullBlockList };
+        for (Block * list : lists)
+        {
+            for (Block * block = list; block != nullptr; block = block->next)
+            {
+                for (uint i = 0; i < NodesPerBlock; i++)
+                {
+                    fn(block->nodes[i]);
+                }
+            }
+        }
+    }
+
+    // Blocks with at least one free node, allocations come from the first one
+    Block * availableBlockList;
+    Block * fullBlockList;
+    size_t blockCount;
+    size_t strongCount;
+    size_t weakCount;
+};
+}
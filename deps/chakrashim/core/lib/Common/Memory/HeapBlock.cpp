@@ -411,6 +411,7 @@ SmallHeapBlockT<TBlockAttributes>::ReassignPages(Recycler * recycler)
         return FALSE;
     }
 
+    this->heapBucket->heapInfo->AddHeapSpaceTotalBytes(this, this->GetPageCount() * AutoSystemInfo::PageSize);
 #if ENABLE_PARTIAL_GC
     recycler->autoHeap.uncollectedNewPageCount += this->GetPageCount();
 #endif
@@ -518,6 +519,8 @@ SmallHeapBlockT<TBlockAttributes>::ReleasePages(Recycler * recycler)
     }
 
     this->GetPageAllocator(recycler)->ReleasePages(address, this->GetPageCount(), this->GetPageSegment());
+    this->heapBucket->heapInfo->SetHeapSpaceUsedBytes(this, 0);
+    this->heapBucket->heapInfo->SubtractHeapSpaceTotalBytes(this, this->GetPageCount() * AutoSystemInfo::PageSize);
 
     this->segment = nullptr;
     this->address = nullptr;
@@ -536,6 +539,8 @@ SmallHeapBlockT<TBlockAttributes>::BackgroundReleasePagesSweep(Recycler* recycle
         this->RestoreUnusablePages();
     }
     this->GetPageAllocator(recycler)->BackgroundReleasePages(address, this->GetPageCount(), this->GetPageSegment());
+    this->heapBucket->heapInfo->SetHeapSpaceUsedBytes(this, 0);
+    this->heapBucket->heapInfo->SubtractHeapSpaceTotalBytes(this, this->GetPageCount() * AutoSystemInfo::PageSize);
 
     this->address = nullptr;
     this->segment = nullptr;
@@ -1233,6 +1238,13 @@ SmallHeapBlockT<TBlockAttributes>::SweepVerifyPartialBlock(Recycler * recycler)
 }
 #endif
 
+template <class TBlockAttributes>
+void
+SmallHeapBlockT<TBlockAttributes>::UpdateHeapSpaceUsedBytes()
+{
+    this->heapBucket->heapInfo->SetHeapSpaceUsedBytes(this, (this->objectCount - this->freeCount) * this->objectSize);
+}
+
 template <class TBlockAttributes>
 uint
 SmallHeapBlockT<TBlockAttributes>::GetAndClearUnaccountedAllocBytes()
@@ -1659,6 +1671,7 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
 #endif
 
         this->lastFreeObjectHead = this->freeObjectList;
+        this->UpdateHeapSpaceUsedBytes();
     }
 
     // While allocations are allowed during concurrent sweep into still unswept blocks the
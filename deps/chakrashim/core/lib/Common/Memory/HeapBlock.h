@@ -280,6 +280,7 @@ template <class TBlockAttributes> class SmallRecyclerVisitedHostHeapBlockT;
 class RecyclerHeapObjectInfo;
 class HeapBlock
 {
+    friend class HeapInfo;
 public:
     enum HeapBlockType : byte
     {
@@ -376,6 +377,7 @@ class HeapBlock
 protected:
     char * address;
     Segment * segment;
+    size_t heapSpaceUsedBytes;                      // Used bytes of this block last reported to its heap space
     HeapBlockType const heapBlockType;
     bool needOOMRescan;                             // Set if we OOMed while marking a particular object
 #if ENABLE_CONCURRENT_GC
@@ -401,6 +403,7 @@ class HeapBlock
     void SetNeedOOMRescan(Recycler * recycler);
 public:
     HeapBlock(HeapBlockType heapBlockType) :
+        heapSpaceUsedBytes(0),
         heapBlockType(heapBlockType),
         needOOMRescan(false)
     {
@@ -470,11 +473,33 @@ class HeapBlock
 #endif
 };
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
+#if SUPPORT_WIN32_SLIST
+typedef SLIST_ENTRY HeapBlockSListEntry;
+typedef SLIST_HEADER HeapBlockSListHeader;
+#else
+// xplat: There is no interlocked SLIST in the PAL. The list of allocable heap blocks is only pushed by the
+// sweeping thread and popped by the allocator when it runs out of its current block, so a lock protected list
+// (like the BackgroundPageQueue in PageAllocator.h) is good enough here.
+struct HeapBlockSListEntry
+{
+    HeapBlockSListEntry * Next;
+};
+
+struct HeapBlockSListHeader
+{
+    HeapBlockSListHeader() : head(nullptr), depth(0) {}
+
+    CriticalSection lock;
+    HeapBlockSListEntry * head;
+    ushort depth;
+};
+#endif
+
 template <typename TBlockType>
 struct HeapBlockSListItem {
     // SLIST_ENTRY needs to be the first element in the structure to avoid calculating offset with the SList API calls.
-    SLIST_ENTRY itemEntry;
+    HeapBlockSListEntry itemEntry;
     TBlockType * itemHeapBlock;
 };
 #endif
@@ -769,6 +794,7 @@ class SmallHeapBlockT : public HeapBlock
     SweepState Sweep(RecyclerSweep& recyclerSweep, bool queuePendingSweep, bool allocable, ushort finalizeCount = 0, bool hasPendingDispose = false);
     template <SweepMode mode>
     void SweepObjects(Recycler * recycler);
+    void UpdateHeapSpaceUsedBytes();
 
     uint GetAndClearLastFreeCount();
     void ClearAllAllocBytes();      // Reset all unaccounted alloc bytes and the new alloc count
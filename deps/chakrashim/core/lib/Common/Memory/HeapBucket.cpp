@@ -56,11 +56,9 @@ HeapBucketT<TBlockType>::HeapBucketT() :
     fullBlockList(nullptr),
     heapBlockList(nullptr),
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
-#if SUPPORT_WIN32_SLIST
     lastKnownNextAllocableBlockHead(nullptr),
     allocableHeapBlockListHead(nullptr),
     sweepableHeapBlockList(nullptr),
-#endif
 #endif
     explicitFreeList(nullptr),
     lastExplicitFreeListAllocator(nullptr)
@@ -80,7 +78,6 @@ HeapBucketT<TBlockType>::~HeapBucketT()
     DeleteHeapBlockList(this->fullBlockList);
 
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
-#if SUPPORT_WIN32_SLIST
     if (allocableHeapBlockListHead != nullptr)
     {
         if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc))
@@ -88,12 +85,15 @@ HeapBucketT<TBlockType>::~HeapBucketT()
             FlushInterlockedSList(this->allocableHeapBlockListHead);
         }
 
+#if SUPPORT_WIN32_SLIST
         _aligned_free(this->allocableHeapBlockListHead);
+#else
+        HeapDelete(this->allocableHeapBlockListHead);
+#endif
     }
 
     DeleteHeapBlockList(this->sweepableHeapBlockList);
 #endif
-#endif
 
 #if defined(RECYCLER_SLOW_CHECK_ENABLED) || ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     Assert(this->heapBlockCount + this->newHeapBlockCount == 0);
@@ -136,13 +136,17 @@ HeapBucketT<TBlockType>::DeleteHeapBlockList(TBlockType * list)
     DeleteHeapBlockList(list, this->heapInfo->recycler);
 }
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
 template<typename TBlockType>
 bool
-HeapBucketT<TBlockType>::PushHeapBlockToSList(PSLIST_HEADER list, TBlockType * heapBlock)
+HeapBucketT<TBlockType>::PushHeapBlockToSList(HeapBlockSListHeader * list, TBlockType * heapBlock)
 {
     Assert(list != nullptr);
+#if SUPPORT_WIN32_SLIST
     HeapBlockSListItem<TBlockType> * currentBlock = (HeapBlockSListItem<TBlockType> *) _aligned_malloc(sizeof(HeapBlockSListItem<TBlockType>), MEMORY_ALLOCATION_ALIGNMENT);
+#else
+    HeapBlockSListItem<TBlockType> * currentBlock = HeapNewNoThrowStruct(HeapBlockSListItem<TBlockType>);
+#endif
     if (currentBlock == nullptr)
     {
         return false;
@@ -153,24 +157,48 @@ HeapBucketT<TBlockType>::PushHeapBlockToSList(PSLIST_HEADER list, TBlockType * h
     heapBlock->SetNextBlock(nullptr);
     currentBlock->itemHeapBlock = heapBlock;
 
+#if SUPPORT_WIN32_SLIST
     ::InterlockedPushEntrySList(list, &(currentBlock->itemEntry));
+#else
+    AutoCriticalSection autoCS(&list->lock);
+    currentBlock->itemEntry.Next = list->head;
+    list->head = &(currentBlock->itemEntry);
+    list->depth++;
+#endif
     return true;
 }
 
 template<typename TBlockType>
 TBlockType *
-HeapBucketT<TBlockType>::PopHeapBlockFromSList(PSLIST_HEADER list)
+HeapBucketT<TBlockType>::PopHeapBlockFromSList(HeapBlockSListHeader * list)
 {
     Assert(list != nullptr);
     TBlockType * heapBlock = nullptr;
 
+#if SUPPORT_WIN32_SLIST
     PSLIST_ENTRY top = ::InterlockedPopEntrySList(list);
+#else
+    HeapBlockSListEntry * top;
+    {
+        AutoCriticalSection autoCS(&list->lock);
+        top = list->head;
+        if (top != nullptr)
+        {
+            list->head = top->Next;
+            list->depth--;
+        }
+    }
+#endif
     if (top != nullptr)
     {
         HeapBlockSListItem<TBlockType> * topItem = (HeapBlockSListItem<TBlockType> *) top;
         heapBlock = topItem->itemHeapBlock;
         Assert(heapBlock != nullptr);
+#if SUPPORT_WIN32_SLIST
         _aligned_free(top);
+#else
+        HeapDelete(topItem);
+#endif
     }
 
     return heapBlock;
@@ -178,17 +206,23 @@ HeapBucketT<TBlockType>::PopHeapBlockFromSList(PSLIST_HEADER list)
 
 template<typename TBlockType>
 ushort
-HeapBucketT<TBlockType>::QueryDepthInterlockedSList(PSLIST_HEADER list)
+HeapBucketT<TBlockType>::QueryDepthInterlockedSList(HeapBlockSListHeader * list)
 {
     Assert(list != nullptr);
+#if SUPPORT_WIN32_SLIST
     return ::QueryDepthSList(list);
+#else
+    AutoCriticalSection autoCS(&list->lock);
+    return list->depth;
+#endif
 }
 
 template<typename TBlockType>
 void
-HeapBucketT<TBlockType>::FlushInterlockedSList(PSLIST_HEADER list)
+HeapBucketT<TBlockType>::FlushInterlockedSList(HeapBlockSListHeader * list)
 {
     Assert(list != nullptr);
+#if SUPPORT_WIN32_SLIST
     if (::QueryDepthSList(list) > 0)
     {
         PSLIST_ENTRY listEntry = ::InterlockedPopEntrySList(list);
@@ -200,6 +234,19 @@ HeapBucketT<TBlockType>::FlushInterlockedSList(PSLIST_HEADER list)
     }
 
     ::InterlockedFlushSList(list);
+#else
+    AutoCriticalSection autoCS(&list->lock);
+    HeapBlockSListEntry * listEntry = list->head;
+    while (listEntry != nullptr)
+    {
+        HeapBlockSListEntry * next = listEntry->Next;
+        HeapDelete((HeapBlockSListItem<TBlockType> *)listEntry);
+        listEntry = next;
+    }
+
+    list->head = nullptr;
+    list->depth = 0;
+#endif
 }
 #endif
 
@@ -338,6 +385,10 @@ HeapBucketT<TBlockType>::IntegrateBlock(char * blockAddress, PageSegment * segme
         return false;
     }
 
+    // The block comes fully allocated
+    this->heapInfo->AddHeapSpaceTotalBytes(heapBlock, heapBlock->GetPageCount() * AutoSystemInfo::PageSize);
+    this->heapInfo->SetHeapSpaceUsedBytes(heapBlock, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
+
     heapBlock->SetNextBlock(this->fullBlockList);
     this->fullBlockList = heapBlock;
 
@@ -425,7 +476,6 @@ HeapBucketT<TBlockType>::GetNonEmptyHeapBlockCount(bool checkCount) const
 
 #if ENABLE_CONCURRENT_GC
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
-#if SUPPORT_WIN32_SLIST
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         allocatingDuringConcurrentSweep = true;
@@ -440,7 +490,6 @@ HeapBucketT<TBlockType>::GetNonEmptyHeapBlockCount(bool checkCount) const
         currentHeapBlockCount += HeapBlockList::Count(sweepableHeapBlockList);
         debugSweepableHeapBlockListLock.Leave();
     }
-#endif
 #endif
 
     // Recycler can be null if we have OOM in the ctor
@@ -478,7 +527,6 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
 
     TBlockType * heapBlock = this->nextAllocableBlockHead;
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 
-#if SUPPORT_WIN32_SLIST
     bool heapBlockFromAllocableHeapBlockList = false;
     DebugOnly(bool heapBlockInPendingSweepPrepList = false);
 
@@ -527,14 +575,13 @@ HeapBucketT<TBlockType>::TryAlloc(Recycler * recycler, TBlockAllocatorType * all
         debugSweepableHeapBlockListLock.Leave();
 #endif
     }
-#endif
 #endif
 
    if (heapBlock != nullptr)
    {
         Assert(!this->IsAllocationStopped());
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
         // When allocations are allowed during concurrent sweep we set nextAllocableBlockHead to NULL as the allocator will pick heap blocks from the
         // interlocked SLIST. During that time, the heap block at the top of the SLIST is always the nextAllocableBlockHead.
         // If the heapBlock was just picked from the SLIST and nextAllocableBlockHead is not NULL then we just resumed normal allocations on the background thread
@@ -839,7 +886,7 @@ HeapBucketT<TBlockType>::ResetMarks(ResetMarkFlags flags)
             Assert(!heapBlock->HasFreeObject());
         });
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
         if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
         {
             HeapBlockList::ForEach(sweepableHeapBlockList, [flags](TBlockType * heapBlock)
@@ -892,7 +939,7 @@ HeapBucketT<TBlockType>::ScanNewImplicitRoots(Recycler * recycler)
         heapBlock->ScanNewImplicitRoots(recycler);
     });
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         HeapBlockList::ForEach(sweepableHeapBlockList, [recycler](TBlockType * heapBlock)
@@ -1086,6 +1133,20 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 
         DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep, state));
 
+        // Blocks pending sweep report their used bytes once their objects are swept
+        if (state == SweepStateEmpty)
+        {
+            this->heapInfo->SetHeapSpaceUsedBytes(heapBlock, 0);
+        }
+#if ENABLE_CONCURRENT_GC
+        else if (state != SweepStatePendingSweep)
+#else
+        else
+#endif
+        {
+            heapBlock->UpdateHeapSpaceUsedBytes();
+        }
+
         switch (state)
         {
 #if ENABLE_CONCURRENT_GC
@@ -1150,7 +1211,7 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
             Assert(heapBlock->HasFreeObject());
             DebugOnly(this->AssertCheckHeapBlockNotInAnyList(heapBlock));
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
             if (this->AllocationsStartedDuringConcurrentSweep())
             {
                 Assert(!this->IsAnyFinalizableBucket());
@@ -1286,7 +1347,7 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep)
     Assert(!recyclerSweep.IsBackground());
 #endif
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && this->sweepableHeapBlockList != nullptr)
     {
         Assert(!this->IsAnyFinalizableBucket());
@@ -1398,9 +1459,7 @@ HeapBucketT<TBlockType>::StopAllocationBeforeSweep()
 {
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     this->allocationsStartedDuringConcurrentSweep = false;
-#if SUPPORT_WIN32_SLIST
     this->lastKnownNextAllocableBlockHead = this->nextAllocableBlockHead;
-#endif
 #endif
 
     Assert(!this->IsAllocationStopped());
@@ -1431,12 +1490,10 @@ HeapBucketT<TBlockType>::StartAllocationDuringConcurrentSweep()
     Assert(!this->allocationsStartedDuringConcurrentSweep);
     this->allocationsStartedDuringConcurrentSweep = true;
 
-#if SUPPORT_WIN32_SLIST
     // When allocations are allowed during concurrent sweep we set nextAllocableBlockHead to NULL as the allocator will pick heap blocks from the
     // interlocked SLIST. During that time, the heap block at the top of the SLIST is always the nextAllocableBlockHead.
     this->nextAllocableBlockHead = nullptr;
     this->lastKnownNextAllocableBlockHead = nullptr;
-#endif
 }
 
 template <typename TBlockType>
@@ -1485,7 +1542,6 @@ template<typename TBlockType>
 void
 HeapBucketT<TBlockType>::PrepareForAllocationsDuringConcurrentSweep(TBlockType * &currentHeapBlockList)
 {
-#if SUPPORT_WIN32_SLIST
     if (this->AllowAllocationsDuringConcurrentSweep())
     {
         this->EnsureAllocableHeapBlockList();
@@ -1551,7 +1607,6 @@ HeapBucketT<TBlockType>::PrepareForAllocationsDuringConcurrentSweep(TBlockType *
 
         Assert(!this->IsAllocationStopped());
     }
-#endif
 }
 #endif
 
@@ -1737,11 +1792,12 @@ template <typename TBlockType>
 void
 HeapBucketT<TBlockType>::EnsureAllocableHeapBlockList()
 {
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc))
     {
         if (allocableHeapBlockListHead == nullptr)
         {
+#if SUPPORT_WIN32_SLIST
             allocableHeapBlockListHead = ((PSLIST_HEADER)_aligned_malloc(sizeof(SLIST_HEADER), MEMORY_ALLOCATION_ALIGNMENT));
 
             if (allocableHeapBlockListHead == nullptr)
@@ -1752,6 +1808,14 @@ HeapBucketT<TBlockType>::EnsureAllocableHeapBlockList()
             {
                 ::InitializeSListHead(allocableHeapBlockListHead);
             }
+#else
+            allocableHeapBlockListHead = HeapNewNoThrow(HeapBlockSListHeader);
+
+            if (allocableHeapBlockListHead == nullptr)
+            {
+                this->heapInfo->recycler->OutOfMemory();
+            }
+#endif
         }
     }
 #endif
@@ -1777,7 +1841,6 @@ HeapBucketT<TBlockType>::FinishConcurrentSweep()
 {
     if (this->AllocationsStartedDuringConcurrentSweep())
     {
-#if SUPPORT_WIN32_SLIST
         Assert(!this->IsAnyFinalizableBucket());
         Assert(this->allocableHeapBlockListHead != nullptr);
 
@@ -1807,7 +1870,6 @@ HeapBucketT<TBlockType>::FinishConcurrentSweep()
         Assert(QueryDepthInterlockedSList(this->allocableHeapBlockListHead) == 0);
 
         this->ResumeNormalAllocationAfterConcurrentSweep(newNextAllocableBlockHead);
-#endif
 
         Assert(!this->IsAllocationStopped());
     }
@@ -1854,7 +1916,7 @@ HeapBucketT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBa
 {
     UpdateAllocators();
     HeapBucket::EnumerateObjects(fullBlockList, infoBits, CallBackFunction);
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         HeapBucket::EnumerateObjects(sweepableHeapBlockList, infoBits, CallBackFunction);
@@ -1884,7 +1946,7 @@ HeapBucketT<TBlockType>::Check(bool checkCount)
     UpdateAllocators();
     size_t smallHeapBlockCount = HeapInfo::Check(true, false, this->fullBlockList);
     bool allocatingDuringConcurrentSweep = false;
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         allocatingDuringConcurrentSweep = true;
@@ -1928,7 +1990,7 @@ HeapBucketT<TBlockType>::AggregateBucketStats()
     };
 
     HeapBlockList::ForEach(fullBlockList, blockStatsAggregator);
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         HeapBlockList::ForEach(sweepableHeapBlockList, blockStatsAggregator);
@@ -1967,7 +2029,7 @@ HeapBucketT<TBlockType>::Verify()
         heapBlock->Verify();
     });
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
 #if DBG
@@ -2042,7 +2104,7 @@ HeapBucketT<TBlockType>::VerifyMark()
         heapBlock->VerifyMark();
     });
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
         HeapBlockList::ForEach(this->sweepableHeapBlockList, [](TBlockType * heapBlock)
@@ -228,11 +228,11 @@ class HeapBucketT : public HeapBucket
     void DeleteHeapBlockList(TBlockType * list);
     static void DeleteEmptyHeapBlockList(TBlockType * list);
     static void DeleteHeapBlockList(TBlockType * list, Recycler * recycler);
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
-    static bool PushHeapBlockToSList(PSLIST_HEADER list, TBlockType * heapBlock);
-    static TBlockType * PopHeapBlockFromSList(PSLIST_HEADER list);
-    static ushort QueryDepthInterlockedSList(PSLIST_HEADER list);
-    static void FlushInterlockedSList(PSLIST_HEADER list);
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
+    static bool PushHeapBlockToSList(HeapBlockSListHeader * list, TBlockType * heapBlock);
+    static TBlockType * PopHeapBlockFromSList(HeapBlockSListHeader * list);
+    static ushort QueryDepthInterlockedSList(HeapBlockSListHeader * list);
+    static void FlushInterlockedSList(HeapBlockSListHeader * list);
 #endif
 
     // Small allocators
@@ -308,8 +308,7 @@ class HeapBucketT : public HeapBucket
     TBlockType * heapBlockList;      // list of blocks that has free objects
 
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
-#if SUPPORT_WIN32_SLIST
-    PSLIST_HEADER allocableHeapBlockListHead;
+    HeapBlockSListHeader * allocableHeapBlockListHead;
     TBlockType * lastKnownNextAllocableBlockHead;
 #if DBG || defined(RECYCLER_SLOW_CHECK_ENABLED)
     // This lock is needed only in the debug mode while we verify block counts. Not needed otherwise, as this list is never accessed concurrently.
@@ -320,7 +319,6 @@ class HeapBucketT : public HeapBucket
     // This is the list of blocks that we allocated from during concurrent sweep. These blocks will eventually get processed during the next sweep and either go into
     // the fullBlockList.
     TBlockType * sweepableHeapBlockList;
-#endif
 #endif
 
     FreeObject* explicitFreeList; // List of objects that have been explicitly freed
@@ -371,7 +369,7 @@ HeapBucketT<TBlockType>::SweepBucket(RecyclerSweep& recyclerSweep, Fn sweepFn)
         // We should only queue up pending sweep if we are doing partial collect
         Assert(recyclerSweep.GetPendingSweepBlockList(this) == nullptr);
 
-#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
         if (!this->AllocationsStartedDuringConcurrentSweep())
 #endif
 #endif
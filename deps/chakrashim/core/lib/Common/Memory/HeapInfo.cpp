@@ -469,6 +469,7 @@ HeapInfo::HeapInfo() :
     uncollectedNewPageCount(0),
     unusedPartialCollectFreeBytes(0),
 #endif
+    heapSpaceUsage(),
     uncollectedAllocBytes(0),
     lastUncollectedAllocBytes(0),
     pendingZeroPageCount(0)
@@ -1400,6 +1401,102 @@ HeapInfo::ReportMemStats()
 
 #endif  // ENABLE_MEM_STATS
 
+HeapSpace
+HeapInfo::GetHeapSpace(HeapBlock * heapBlock)
+{
+    switch (heapBlock->GetHeapBlockType())
+    {
+    case HeapBlock::SmallNormalBlockType:
+#ifdef RECYCLER_WRITE_BARRIER
+    case HeapBlock::SmallNormalBlockWithBarrierType:
+#endif
+        return HeapSpaceSmallNormal;
+    case HeapBlock::SmallLeafBlockType:
+        return HeapSpaceSmallLeaf;
+    case HeapBlock::SmallFinalizableBlockType:
+#ifdef RECYCLER_WRITE_BARRIER
+    case HeapBlock::SmallFinalizableBlockWithBarrierType:
+#endif
+#ifdef RECYCLER_VISITED_HOST
+    case HeapBlock::SmallRecyclerVisitedHostBlockType:
+#endif
+        return HeapSpaceSmallFinalizable;
+    case HeapBlock::MediumNormalBlockType:
+#ifdef RECYCLER_WRITE_BARRIER
+    case HeapBlock::MediumNormalBlockWithBarrierType:
+#endif
+        return HeapSpaceMediumNormal;
+    case HeapBlock::MediumLeafBlockType:
+        return HeapSpaceMediumLeaf;
+    case HeapBlock::MediumFinalizableBlockType:
+#ifdef RECYCLER_WRITE_BARRIER
+    case HeapBlock::MediumFinalizableBlockWithBarrierType:
+#endif
+#ifdef RECYCLER_VISITED_HOST
+    case HeapBlock::MediumRecyclerVisitedHostBlockType:
+#endif
+        return HeapSpaceMediumFinalizable;
+    default:
+        Assert(heapBlock->IsLargeHeapBlock());
+        return HeapSpaceLarge;
+    }
+}
+
+static void
+InterlockedAddHeapSpaceBytes(size_t volatile * bytes, size_t delta)
+{
+    // The counters are updated from both the main thread and the background sweep
+#if defined(TARGET_64)
+    ::InterlockedExchangeAdd64((volatile LONG64 *)bytes, (LONG64)delta);
+#else
+    ::InterlockedExchangeAdd((volatile LONG *)bytes, (LONG)delta);
+#endif
+}
+
+void
+HeapInfo::AddHeapSpaceTotalBytes(HeapBlock * heapBlock, size_t bytes)
+{
+    InterlockedAddHeapSpaceBytes(&heapSpaceUsage[GetHeapSpace(heapBlock)].totalBytes, bytes);
+}
+
+void
+HeapInfo::SubtractHeapSpaceTotalBytes(HeapBlock * heapBlock, size_t bytes)
+{
+    Assert(heapSpaceUsage[GetHeapSpace(heapBlock)].totalBytes >= bytes);
+    InterlockedAddHeapSpaceBytes(&heapSpaceUsage[GetHeapSpace(heapBlock)].totalBytes, (size_t)0 - bytes);
+}
+
+// A heap block is only swept or allocated from by one thread at a time, so the used bytes it
+// reported can be replaced without a lock. Only the heap space counter is shared.
+void
+HeapInfo::SetHeapSpaceUsedBytes(HeapBlock * heapBlock, size_t usedBytes)
+{
+    size_t lastUsedBytes = heapBlock->heapSpaceUsedBytes;
+    if (usedBytes == lastUsedBytes)
+    {
+        return;
+    }
+
+    heapBlock->heapSpaceUsedBytes = usedBytes;
+    InterlockedAddHeapSpaceBytes(&heapSpaceUsage[GetHeapSpace(heapBlock)].usedBytes, usedBytes - lastUsedBytes);
+}
+
+void
+HeapInfo::GetHeapSpaceUsage(HeapSpaceUsage * usage, uint count) const
+{
+    for (uint i = 0; i < count && i < HeapSpaceCount; i++)
+    {
+        usage[i].usedBytes = heapSpaceUsage[i].usedBytes;
+        usage[i].totalBytes = heapSpaceUsage[i].totalBytes;
+
+        // Both counters are read without synchronization
+        if (usage[i].usedBytes > usage[i].totalBytes)
+        {
+            usage[i].usedBytes = usage[i].totalBytes;
+        }
+    }
+}
+
 
 #if ENABLE_PARTIAL_GC
 void
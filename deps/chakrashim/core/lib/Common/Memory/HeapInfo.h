@@ -4,6 +4,25 @@
 //-------------------------------------------------------------------------------------------------------
 namespace Memory
 {
+// Groups of heap blocks reported to the host by HeapInfo::GetHeapSpaceUsage
+enum HeapSpace
+{
+    HeapSpaceSmallNormal,
+    HeapSpaceSmallLeaf,
+    HeapSpaceSmallFinalizable,
+    HeapSpaceMediumNormal,
+    HeapSpaceMediumLeaf,
+    HeapSpaceMediumFinalizable,
+    HeapSpaceLarge,
+    HeapSpaceCount
+};
+
+struct HeapSpaceUsage
+{
+    size_t usedBytes;
+    size_t totalBytes;
+};
+
 class HeapInfo
 {
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -50,6 +69,14 @@ class HeapInfo
     void ReportMemStats();
 #endif
 
+    // The heap space counters are updated as heap blocks get and release their pages, as allocators
+    // take heap blocks and as heap blocks are swept, so they can be read at any time without walking
+    // the heap. The free objects of a block taken by an allocator count as used until it is swept again.
+    void AddHeapSpaceTotalBytes(HeapBlock * heapBlock, size_t bytes);
+    void SubtractHeapSpaceTotalBytes(HeapBlock * heapBlock, size_t bytes);
+    void SetHeapSpaceUsedBytes(HeapBlock * heapBlock, size_t usedBytes);
+    void GetHeapSpaceUsage(HeapSpaceUsage * usage, uint count) const;
+
     template <ObjectInfoBits attributes, bool nothrow>
     char * MediumAlloc(Recycler * recycler, size_t sizeCat, size_t size);
 
@@ -404,6 +431,10 @@ class HeapInfo
     static typename SmallHeapBlockT<TBlockAttributes>::BlockInfo const * GetBlockInfo(uint objectSize);
 
 private:
+    static HeapSpace GetHeapSpace(HeapBlock * heapBlock);
+
+    HeapSpaceUsage heapSpaceUsage[HeapSpaceCount];
+
     size_t uncollectedAllocBytes;
     size_t lastUncollectedAllocBytes;
     size_t uncollectedExternalBytes;
@@ -138,7 +138,7 @@ IdleDecommitPageAllocator::LeaveIdleDecommit(bool allowTimer)
     }
 #endif
     this->maxFreePageCount = maxNonIdleDecommitFreePageCount;
-    __super::DecommitNow();
+    IdleDecommitNow();
     ClearMinFreePageCount();
     return IdleDecommitSignal_None;
 }
@@ -221,7 +221,7 @@ IdleDecommitPageAllocator::IdleDecommit()
 #if DBG_DUMP
             idleDecommitCount++;
 #endif
-            __super::DecommitNow();
+            IdleDecommitNow();
             hasDecommitTimer = false;
             ClearMinFreePageCount();
             this->maxFreePageCount = maxNonIdleDecommitFreePageCount;
@@ -233,6 +233,17 @@ IdleDecommitPageAllocator::IdleDecommit()
 
 #endif
 
+// With -IdleDecommitResetPages, pages freed while idle are reset rather than decommitted. On Linux
+// that is MADV_FREE, which leaves the mapping alone and lets the kernel reclaim the pages lazily,
+// instead of remapping them, which splits the mapping and drops them (and any huge pages) right away.
+void
+IdleDecommitPageAllocator::IdleDecommitNow()
+{
+    this->decommitByReset = this->pageAllocatorFlagTable.IdleDecommitResetPages;
+    __super::DecommitNow();
+    this->decommitByReset = false;
+}
+
 void
 IdleDecommitPageAllocator::Prime(uint primePageCount)
 {
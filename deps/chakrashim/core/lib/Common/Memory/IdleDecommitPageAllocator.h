@@ -41,6 +41,7 @@ class IdleDecommitPageAllocator : public PageAllocator
 #endif
 
 private:
+    void IdleDecommitNow();
 
 #ifdef IDLE_DECOMMIT_ENABLED
 #if DBG_DUMP
@@ -343,6 +343,9 @@ LargeHeapBlock::ReleasePages(Recycler * recycler)
 {
     Assert(segment != nullptr);
 
+    this->heapInfo->SetHeapSpaceUsedBytes(this, 0);
+    this->heapInfo->SubtractHeapSpaceTotalBytes(this, this->pageCount * AutoSystemInfo::PageSize);
+
     IdleDecommitPageAllocator* pageAllocator = recycler->GetRecyclerLargeBlockPageAllocator();
     char* blockStartAddress = this->address;
     size_t realPageCount = this->pageCount;
@@ -576,6 +579,7 @@ LargeHeapBlock::AllocFreeListEntry(DECLSPEC_GUARD_OVERFLOW size_t size, ObjectIn
 
     HeaderList()[headerIndex] = header;
     finalizeCount += ((attributes & FinalizeBit) != 0);
+    this->heapInfo->SetHeapSpaceUsedBytes(this, this->heapSpaceUsedBytes + originalSize);
 
 #ifdef RECYCLER_FINALIZE_CHECK
     if (attributes & FinalizeBit)
@@ -647,6 +651,7 @@ LargeHeapBlock::Alloc(DECLSPEC_GUARD_OVERFLOW size_t size, ObjectInfoBits attrib
     header->SetAttributes(recycler->Cookie, (attributes & StoredObjectInfoBitMask));
     HeaderList()[allocCount++] = header;
     finalizeCount += ((attributes & FinalizeBit) != 0);
+    this->heapInfo->SetHeapSpaceUsedBytes(this, this->heapSpaceUsedBytes + size);
 
 #ifdef RECYCLER_FINALIZE_CHECK
     if (attributes & FinalizeBit)
@@ -1656,6 +1661,7 @@ LargeHeapBlock::TrimObject(Recycler* recycler, LargeObjectHeader* header, size_t
         // and update the page count
         recycler->heapBlockMap.ClearHeapBlock(this->address, freePageCount);
 
+        this->heapInfo->SubtractHeapSpaceTotalBytes(this, freePageCount * AutoSystemInfo::PageSize);
         this->address = (char*) objectFreeEndAddress;
         this->pageCount -= freePageCount;
 
@@ -1818,6 +1824,7 @@ LargeHeapBlock::SweepObjects(Recycler * recycler)
     Assert(expectedSweepCount != 0 || isForceSweeping);
     uint sweepCount = 0;
 #endif
+    size_t sweptBytes = 0;
 
     for (uint i = 0; i < lastCollectAllocCount; i++)
     {
@@ -1850,6 +1857,7 @@ LargeHeapBlock::SweepObjects(Recycler * recycler)
 
         size_t objectSize = header->objectSize;
         recycler->NotifyFree((char *)header->GetAddress(), objectSize);
+        sweptBytes += objectSize;
 
         SweepObject<mode>(recycler, header);
 
@@ -1874,6 +1882,8 @@ LargeHeapBlock::SweepObjects(Recycler * recycler)
     }
 
     Assert(sweepCount == expectedSweepCount);
+    Assert(sweptBytes <= this->heapSpaceUsedBytes);
+    this->heapInfo->SetHeapSpaceUsedBytes(this, this->heapSpaceUsedBytes - sweptBytes);
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
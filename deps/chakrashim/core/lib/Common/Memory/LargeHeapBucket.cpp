@@ -209,6 +209,7 @@ LargeHeapBucket::PageHeapAlloc(Recycler * recycler, size_t sizeCat, size_t size,
 
     heapBlock->heapInfo = this->heapInfo;
     heapBlock->pageHeapData = pageHeapData;
+    this->heapInfo->AddHeapSpaceTotalBytes(heapBlock, pageCount * AutoSystemInfo::PageSize);
     
     bool decommitGuardPage = true;
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -348,6 +349,7 @@ LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow)
     RECYCLER_SLOW_CHECK(this->heapInfo->heapBlockCount[HeapBlock::HeapBlockType::LargeBlockType]++);
 
     heapBlock->heapInfo = this->heapInfo;
+    this->heapInfo->AddHeapSpaceTotalBytes(heapBlock, pageCount * AutoSystemInfo::PageSize);
 
     heapBlock->lastCollectAllocCount = 0;
 
@@ -24,7 +24,10 @@ class MarkContext
     };
 
 public:
+    typedef PageStack<MarkCandidate> MarkStack;
+
     static const int MarkCandidateSize = sizeof(MarkCandidate);
+    static const uint MaxSplitTargets = MarkStack::MaxSplitTargets;
 
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
@@ -61,6 +64,10 @@ class MarkContext
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+    // Moving mark stack chunks to and from the stack shared by the parallel markers
+    uint ShareMarkStackChunks(MarkStack * sharedStack, uint maxChunkCount) { return markStack.TransferChunks(sharedStack, maxChunkCount); }
+    uint TakeMarkStackChunks(MarkStack * sharedStack, uint maxChunkCount) { return sharedStack->TransferChunks(&markStack, maxChunkCount); }
+
     void Abort();
     void Release();
 
@@ -126,6 +133,9 @@ class MarkContext
 #endif
 
 private:
+    // Number of objects a parallel marker scans between checks for idle markers to share work with
+    static const uint ParallelMarkShareInterval = 256;
+
     Recycler * recycler;
     PagePool * pagePool;
     PageStack<MarkCandidate> markStack;
@@ -244,6 +244,7 @@ void MarkContext::ProcessMark()
         {
 #if defined(_M_IX86) || defined(_M_X64)
             MarkCandidate current, next;
+            uint shareCountdown = ParallelMarkShareInterval;
 
             while (markStack.Pop(&current))
             {
@@ -256,6 +257,13 @@ void MarkContext::ProcessMark()
                     // Process the previously retrieved entry.
                     ScanObject<parallel, interior>(current.obj, current.byteCount);
 
+                    // Every once in a while, check whether other parallel markers ran out of work.
+                    if (parallel && --shareCountdown == 0)
+                    {
+                        shareCountdown = ParallelMarkShareInterval;
+                        recycler->ShareParallelMarkWork(this);
+                    }
+
                     _mm_prefetch((char *)*(next.obj), _MM_HINT_T0);
 
                     current = next;
@@ -271,10 +279,17 @@ void MarkContext::ProcessMark()
             // CONSIDER: There does seem to be a compiler intrinsic for prefetch on ARM,
             // however, the information on this is scarce, so for now just don't do prefetch on ARM.
             MarkCandidate current;
+            uint shareCountdown = ParallelMarkShareInterval;
 
             while (markStack.Pop(&current))
             {
                 ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+                if (parallel && --shareCountdown == 0)
+                {
+                    shareCountdown = ParallelMarkShareInterval;
+                    recycler->ShareParallelMarkWork(this);
+                }
             }
 #endif
         }
@@ -573,6 +573,17 @@ PageSegmentBase<T>::DecommitFreePagesInternal(uint index, uint pageCount)
     this->SetRangeInDecommitPagesBitVector(index, pageCount);
 
     char * currentAddress = this->address + (index * AutoSystemInfo::PageSize);
+    if (this->GetAllocator()->decommitByReset)
+    {
+        // The pages are only decommitted in our bookkeeping. The OS may take them back whenever it
+        // needs the memory, but they stay committed, so committing them again later is free if it
+        // didn't. They read back as their old contents or as zeros, and free pages of zeroing
+        // allocators are zero already.
+        if (::VirtualAlloc(currentAddress, pageCount * AutoSystemInfo::PageSize, MEM_RESET, PAGE_READWRITE) != nullptr)
+        {
+            return;
+        }
+    }
 #pragma warning(suppress: 6250)
     this->GetAllocator()->GetVirtualAllocator()->Free(currentAddress,
       pageCount * AutoSystemInfo::PageSize, MEM_DECOMMIT);
@@ -692,6 +703,7 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     , numberOfSegments(0)
     , processHandle(processHandle)
     , enableWriteBarrier(enableWriteBarrier)
+    , decommitByReset(false)
 {
     AssertMsg(Math::IsPow2(maxAllocPageCount + secondaryAllocPageCount), "Illegal maxAllocPageCount: Why is this not a power of 2 aligned?");
 
@@ -820,6 +820,8 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
     bool enableWriteBarrier;
+    // Decommit free pages by resetting them (MEM_RESET) instead; see DecommitFreePagesInternal
+    bool decommitByReset;
     AllocationPolicyManager * policyManager;
 
     Js::ConfigFlagsTable& pageAllocatorFlagTable;
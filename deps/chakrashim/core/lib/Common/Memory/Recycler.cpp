@@ -115,13 +115,12 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
     threadPageAllocator(pageAllocator),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
+    parallelMarkContextCount(0),
+    parallelMarkSharedStack(&this->markPagePool),
+    parallelMarkSharedChunkCount(0),
+    parallelMarkActiveCount(0),
+    parallelMarkIdleCount(0),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -152,8 +151,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
+    parallelThreadCount(0),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -191,6 +189,9 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     hasDisposableObject(false),
     tickCountNextDispose(0),
     hasPendingTransferDisposedObjects(false),
+    externalMemoryBytes(0),
+    externalMemoryBytesBaseline(0),
+    arrayBufferMemoryBytes(0),
     transientPinnedObject(nullptr),
     pinnedObjectMap(1024, HeapAllocator::GetNoMemProtectInstance()),
     weakReferenceMap(1024, HeapAllocator::GetNoMemProtectInstance()),
@@ -251,9 +252,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -328,9 +326,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -531,10 +526,24 @@ Recycler::~Recycler()
     recyclerWithBarrierPageAllocator.Close();
 #endif
 
+    // The shared stack's chunk comes from markPagePool, release it before markContext releases the pool's free pages
+    parallelMarkSharedStack.Release();
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->Release();
+        HeapDelete(this->parallelMarkContexts[i]);
+        HeapDelete(this->parallelMarkPagePools[i]);
+    }
+    this->parallelMarkContextCount = 0;
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelThreadCount; i++)
+    {
+        HeapDelete(this->parallelThreads[i]);
+    }
+    this->parallelThreadCount = 0;
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -559,6 +568,9 @@ Recycler::~Recycler()
     clientTrackedObjectList.Clear(&this->clientTrackedObjectAllocator);
 #endif
 
+    // The host may free its root ranges after the recycler is gone
+    externalRootRangeList.Clear(&NoThrowHeapAllocator::Instance);
+
 #ifdef PROFILE_RECYCLER_ALLOC
     if (trackerDictionary != nullptr)
     {
@@ -816,6 +828,7 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #endif
 
     markContext.Init(Recycler::PrimaryMarkStackReservedPageCount);
+    parallelMarkSharedStack.Init();
 
 #if defined(RECYCLER_DUMP_OBJECT_GRAPH) || defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
     isPrimaryMarkContextInitialized = true;
@@ -856,7 +869,47 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelMarkThreads = (uint)GetRecyclerFlagsTable().ParallelMarkThreads;
+    if (parallelMarkThreads != 0)
+    {
+        // Explicitly requested number of mark threads, which is allowed to exceed the number of processors
+        this->maxParallelism = parallelMarkThreads > Recycler::MaxParallelism ? Recycler::MaxParallelism : parallelMarkThreads;
+    }
+    else
+    {
+        this->maxParallelism = (numProcs > Recycler::DefaultParallelism) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ?
+            Recycler::DefaultParallelism : numProcs;
+    }
+
+    // Set up a mark context for each thread participating in parallel mark, other than the one using the main markContext.
+    // The concurrent thread and the thread driving the mark are always available, the rest get a parallel thread of their own.
+    while (this->parallelMarkContextCount + 1 < this->maxParallelism)
+    {
+        PagePool * pagePool = HeapNew(PagePool, GetRecyclerFlagsTable());
+        MarkContext * parallelMarkContext = HeapNewNoThrow(MarkContext, this, pagePool);
+        if (parallelMarkContext == nullptr)
+        {
+            HeapDelete(pagePool);
+            Js::Throw::OutOfMemory();
+        }
+
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarkContext->SetMarkMap(markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarkContext->SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+
+        this->parallelMarkPagePools[this->parallelMarkContextCount] = pagePool;
+        this->parallelMarkContexts[this->parallelMarkContextCount] = parallelMarkContext;
+        this->parallelMarkContextCount++;
+    }
+
+    while (this->parallelThreadCount + 2 < this->maxParallelism)
+    {
+        this->parallelThreads[this->parallelThreadCount] = HeapNew(RecyclerParallelThread, this, &Recycler::ParallelWorkFunc, this->parallelThreadCount);
+        this->parallelThreadCount++;
+    }
 
     if (forceInThread)
     {
@@ -975,9 +1028,10 @@ Recycler::ClearNeedOOMRescan()
 {
     this->needOOMRescan = false;
     markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-    parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    });
 }
 
 bool
@@ -1098,6 +1152,31 @@ Recycler::AddExternalMemoryUsage(size_t size)
     CollectNow<CollectOnAllocation>();
 }
 
+size_t
+Recycler::AdjustExternalMemoryUsage(int64 changeInBytes)
+{
+    if (changeInBytes < 0)
+    {
+        const size_t freedBytes = (size_t)(-changeInBytes);
+        this->externalMemoryBytes = freedBytes < this->externalMemoryBytes ? this->externalMemoryBytes - freedBytes : 0;
+        this->externalMemoryBytesBaseline = min(this->externalMemoryBytesBaseline, this->externalMemoryBytes);
+        return GetExternalMemoryUsage();
+    }
+
+    this->externalMemoryBytes += (size_t)changeInBytes;
+    this->autoHeap.uncollectedExternalBytes += (size_t)changeInBytes;
+
+    // Unlike AddExternalMemoryUsage, external memory doesn't count towards the allocation byte
+    // heuristic: hosts report large native buffers that are usually freed explicitly. Only collect
+    // once external memory has grown significantly since the last collection.
+    if (RecyclerHeuristic::ShouldCollectForExternalMemory(this->externalMemoryBytes, this->externalMemoryBytesBaseline))
+    {
+        CollectNow<CollectOnExternalMemoryPressure>();
+    }
+
+    return GetExternalMemoryUsage();
+}
+
 bool Recycler::RequestExternalMemoryAllocation(size_t size)
 {
     return recyclerPageAllocator.RequestAlloc(size);
@@ -1986,6 +2065,25 @@ Recycler::FindRoots()
     }
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootArenaPhase);
 
+    DListBase<ExternalRootRange>::Iterator externalRootRangeIter(&externalRootRangeList);
+    while (externalRootRangeIter.Next())
+    {
+        const ExternalRootRange& range = externalRootRangeIter.Data();
+        void ** const end = *range.end;
+        if (end > range.start)
+        {
+            const size_t byteCount = (end - range.start) * sizeof(void *);
+            scanRootBytes += byteCount;
+            ScanMemory<false>(range.start, byteCount);
+        }
+    }
+
+    globalHandleTable.MapStrong([this, &scanRootBytes](void * value)
+    {
+        this->TryMarkNonInterior(value);
+        scanRootBytes += sizeof(void *);
+    });
+
     this->ScanImplicitRoots();
 
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootPhase);
@@ -2286,14 +2384,21 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+    InterlockedIncrement(&this->parallelMarkActiveCount);
+
+    // Once our own mark stack is drained, keep picking up work shared by the other parallel markers until all are done.
+    do
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+    while (this->TakeParallelMarkWork(markContext));
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2309,6 +2414,65 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
     }
 }
 
+// Parallel markers balance their work by sharing chunks of their mark stacks.
+// A marker that has drained its own mark stack goes idle and waits for work in parallelMarkSharedStack.
+// Busy markers periodically check for idle ones (see MarkContext::ProcessMark) and move some of the
+// full chunks below the top of their mark stack to the shared stack.
+// Work only moves through the shared stack while holding parallelMarkSharedStackCs, and only active
+// markers share work, so once no marker is active and the shared stack is empty, the mark is done.
+void
+Recycler::ShareParallelMarkWork(MarkContext * markContext)
+{
+    LONG idleCount = this->parallelMarkIdleCount;
+    if (idleCount == 0 || this->parallelMarkSharedChunkCount != 0)
+    {
+        return;
+    }
+
+    AutoCriticalSection autocs(&this->parallelMarkSharedStackCs);
+    if (this->parallelMarkSharedChunkCount == 0)
+    {
+        // One chunk for each idle marker, if we have that many to spare
+        this->parallelMarkSharedChunkCount = markContext->ShareMarkStackChunks(&this->parallelMarkSharedStack, (uint)idleCount);
+    }
+}
+
+bool
+Recycler::TakeParallelMarkWork(MarkContext * markContext)
+{
+    Assert(!markContext->HasPendingMarkObjects());
+
+    InterlockedIncrement(&this->parallelMarkIdleCount);
+    InterlockedDecrement(&this->parallelMarkActiveCount);
+
+    while (true)
+    {
+        if (this->parallelMarkSharedChunkCount != 0 || this->parallelMarkActiveCount == 0)
+        {
+            AutoCriticalSection autocs(&this->parallelMarkSharedStackCs);
+            if (this->parallelMarkSharedChunkCount != 0)
+            {
+                uint chunkCount = markContext->TakeMarkStackChunks(&this->parallelMarkSharedStack, 1);
+                Assert(chunkCount == 1);
+                this->parallelMarkSharedChunkCount -= chunkCount;
+
+                // Become active before leaving the lock, so other idle markers don't consider the mark done
+                InterlockedIncrement(&this->parallelMarkActiveCount);
+                InterlockedDecrement(&this->parallelMarkIdleCount);
+                return true;
+            }
+
+            if (this->parallelMarkActiveCount == 0)
+            {
+                InterlockedDecrement(&this->parallelMarkIdleCount);
+                return false;
+            }
+        }
+
+        SwitchToThread();
+    }
+}
+
 void
 Recycler::Mark()
 {
@@ -2388,9 +2552,10 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Cleanup();
+    });
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2415,6 +2580,7 @@ Recycler::ResetHeuristicCounters()
     autoHeap.lastUncollectedAllocBytes = autoHeap.uncollectedAllocBytes;
     autoHeap.uncollectedAllocBytes = 0;
     autoHeap.uncollectedExternalBytes = 0;
+    externalMemoryBytesBaseline = externalMemoryBytes;
     ResetPartialHeuristicCounters();
 }
 
@@ -2558,14 +2724,14 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
+    Assert(this->parallelMarkContextCount == this->maxParallelism - 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    uint actualSplitCount = markContext.Split(this->parallelMarkContextCount, this->parallelMarkContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->parallelMarkContextCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2587,56 +2753,46 @@ Recycler::DoParallelMark()
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
     // If there's enough work to split, then kick off marking on parallel threads too.
+    // parallelThreads[n] processes parallelMarkContexts[n + 1].
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    uint parallelThreadStartCount = 0;
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
+        while (parallelThreadStartCount + 1 < actualSplitCount &&
+            this->parallelThreads[parallelThreadStartCount]->StartConcurrent())
         {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
+            parallelThreadStartCount++;
         }
     }
 
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, this->parallelMarkContexts[0]);
 
-    // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
-    if (concurrentSuccess)
+    // If we failed to launch parallel work, process the work in-thread now.
+    if (!concurrentSuccess)
     {
-        WaitForConcurrentThread(INFINITE);
+        this->ProcessParallelMark(false, &markContext);
     }
-    else
+
+    for (uint i = parallelThreadStartCount + 1; i < actualSplitCount; i++)
     {
-        this->ProcessParallelMark(false, &markContext);
+        this->ProcessParallelMark(false, this->parallelMarkContexts[i]);
     }
 
-    if (actualSplitCount >= 2)
+    // If we successfully launched parallel work, wait for it to complete.
+    if (concurrentSuccess)
     {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
+        WaitForConcurrentThread(INFINITE);
+    }
 
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
-        }
+    for (uint i = 0; i < parallelThreadStartCount; i++)
+    {
+        this->parallelThreads[i]->WaitForConcurrent();
     }
 
+    Assert(this->parallelMarkSharedStack.IsEmpty());
+    Assert(this->parallelMarkSharedChunkCount == 0);
+
     this->collectionState = CollectionStateMark;
 
     // Process tracked objects, if any, then do one final mark phase in case they marked any new objects.
@@ -2662,19 +2818,19 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // We keep the main markContext, and parallelThreads[n] is hardwired to use parallelMarkContexts[n + 1],
+    // so we split using those. (parallelMarkContexts[0] is not used in background parallel mark.)
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
         if (this->maxParallelism > 2)
         {
-            actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
+            actualSplitCount = markContext.Split(this->maxParallelism - 2, &this->parallelMarkContexts[1]);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount <= this->parallelThreadCount);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2694,40 +2850,31 @@ Recycler::DoBackgroundParallelMark()
 
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
+    uint parallelThreadStartCount = 0;
+    while (parallelThreadStartCount < actualSplitCount &&
+        this->parallelThreads[parallelThreadStartCount]->StartConcurrent())
     {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
+        parallelThreadStartCount++;
     }
 
     // Process our portion of the split.
     this->ProcessParallelMark(true, &markContext);
 
-    // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
-    {
-        parallelThread1.WaitForConcurrent();
-    }
-    else
+    // If we failed to launch parallel work, process the work in-thread now.
+    for (uint i = parallelThreadStartCount; i < actualSplitCount; i++)
     {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
+        this->ProcessParallelMark(true, this->parallelMarkContexts[i + 1]);
     }
 
-    if (actualSplitCount == 2)
+    // If we successfully launched parallel work, wait for it to complete.
+    for (uint i = 0; i < parallelThreadStartCount; i++)
     {
-        if (parallelSuccess2)
-        {
-            parallelThread2.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
-        }
+        this->parallelThreads[i]->WaitForConcurrent();
     }
 
+    Assert(this->parallelMarkSharedStack.IsEmpty());
+    Assert(this->parallelMarkSharedChunkCount == 0);
+
     this->collectionState = CollectionStateConcurrentMark;
 }
 #endif
@@ -2846,15 +2993,17 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->Cleanup();
+    });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->DecommitPages();
+    });
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2944,9 +3093,12 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if DBG
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        Assert(!parallelMarkContext->GetPageAllocator()->DisableAllocationOutOfMemory());
+    });
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2971,10 +3123,58 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    if (!markContext.IsEmpty() || !parallelMarkSharedStack.IsEmpty())
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (!this->parallelMarkContexts[i]->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 #endif
 
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    if (markContext.HasPendingMarkObjects() || !parallelMarkSharedStack.IsEmpty())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (this->parallelMarkContexts[i]->HasPendingMarkObjects())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    if (markContext.HasPendingTrackObjects())
+    {
+        return true;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (this->parallelMarkContexts[i]->HasPendingTrackObjects())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 #ifdef HEAP_ENUMERATION_VALIDATION
 void
 Recycler::PostHeapEnumScan(PostHeapEnumScanCallback callback, void *data)
@@ -3202,6 +3402,11 @@ Recycler::SweepWeakReference()
     });
     this->weakReferenceCleanupId += hasCleanup;
 
+    globalHandleTable.ClearWeak([this](void * value) -> bool
+    {
+        return !this->IsObjectMarked(value);
+    });
+
     GCETW(GC_SWEEP_WEAKREF_STOP, (this));
     RECYCLER_PROFILE_EXEC_END(this, Js::SweepWeakPhase);
 }
@@ -4406,9 +4611,10 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    ForEachParallelMarkContext([](MarkContext * parallelMarkContext)
+    {
+        parallelMarkContext->ProcessTracked();
+    });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4953,8 +5159,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    for (uint i = 0; i < this->parallelThreadCount; i++)
+    {
+        this->parallelThreads[i]->Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -5028,32 +5236,18 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint parallelThreadStartCount = 0;
 
-        if (startAllThreads)
+        if (startAllThreads && this->enableParallelMark)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            while (parallelThreadStartCount < this->parallelThreadCount)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                if (!this->parallelThreads[parallelThreadStartCount]->EnableConcurrent(true))
                 {
                     startConcurrentThread = false;
+                    break;
                 }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
-                    {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
-                    }
-                }
+                parallelThreadStartCount++;
             }
         }
 
@@ -5076,13 +5270,9 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
+        for (uint i = 0; i < parallelThreadStartCount; i++)
         {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
+            this->parallelThreads[i]->Shutdown();
         }
     }
 
@@ -6366,7 +6556,6 @@ Recycler::FinishSweepPrep()
 void
 Recycler::FinishConcurrentSweep()
 {
-#if SUPPORT_WIN32_SLIST
     GCETW_INTERNAL(GC_START, (this, ETWEvent_ConcurrentSweep_FinishTwoPassSweep));
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc))
     {
@@ -6374,7 +6563,6 @@ Recycler::FinishConcurrentSweep()
         this->autoHeap.FinishConcurrentSweep();
     }
     GCETW_INTERNAL(GC_STOP, (this, ETWEvent_ConcurrentSweep_FinishTwoPassSweep));
-#endif
 }
 #endif
 
@@ -6475,6 +6663,21 @@ Recycler::FinishCollection()
     RECORD_TIMESTAMP(currentCollectionEndTime);
 }
 
+bool
+Recycler::UnregisterExternalRootRange(void ** start)
+{
+    DListBase<ExternalRootRange>::EditingIterator externalRootRangeIter(&externalRootRangeList);
+    while (externalRootRangeIter.Next())
+    {
+        if (externalRootRangeIter.Data().start == start)
+        {
+            externalRootRangeIter.RemoveCurrent(&NoThrowHeapAllocator::Instance);
+            return true;
+        }
+    }
+    return false;
+}
+
 void
 Recycler::SetExternalRootMarker(ExternalRootMarker fn, void * context)
 {
@@ -6731,13 +6934,12 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint parallelId)
 {
-    Assert(parallelId == 0 || parallelId == 1);
+    Assert(parallelId < this->parallelThreadCount);
 
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    MarkContext * markContext = this->parallelMarkContexts[parallelId + 1];
 
     switch (this->collectionState)
     {
@@ -6856,7 +7058,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->parallelId);
 
             // We always wait after the first time
             mustWait = true;
@@ -6895,7 +7097,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->parallelId);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -318,6 +318,7 @@ enum CollectionFlags
     CollectNowConcurrentPartial     = CollectMode_Concurrent | CollectNowPartial,
 
     CollectOnAllocation             = CollectHeuristic_AllocSize | CollectHeuristic_Time | CollectMode_Concurrent | CollectMode_Partial | CollectOverride_FinishConcurrent | CollectOverride_AllowReentrant | CollectOverride_FinishConcurrentTimeout,
+    CollectOnExternalMemoryPressure = CollectMode_Concurrent | CollectOverride_FinishConcurrent | CollectOverride_FinishConcurrentTimeout,
     CollectOnTypedArrayAllocation   = CollectHeuristic_AllocSize | CollectHeuristic_Time | CollectMode_Concurrent | CollectMode_Partial | CollectOverride_FinishConcurrent | CollectOverride_AllowReentrant | CollectOverride_FinishConcurrentTimeout | CollectOverride_AllowDispose,
     CollectOnScriptIdle             = CollectOverride_CheckScriptContextClose | CollectOverride_FinishConcurrent | CollectMode_Concurrent | CollectMode_CacheCleanup | CollectOverride_SkipStack,
     CollectOnScriptExit             = CollectOverride_CheckScriptContextClose | CollectHeuristic_AllocSize | CollectOverride_FinishConcurrent | CollectMode_Concurrent | CollectMode_CacheCleanup,
@@ -585,11 +586,12 @@ struct CollectionParam
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(uint parallelId);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, uint parallelId) :
         recycler(recycler),
         workFunc(workFunc),
+        parallelId(parallelId),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -618,6 +620,7 @@ class RecyclerParallelThread
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    uint parallelId;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
@@ -810,6 +813,20 @@ class Recycler
     DListBase<GuestArenaAllocator> guestArenaList;
     DListBase<ArenaData*> externalGuestArenaList;    // guest arenas are scanned for roots
 
+    // Host owned arrays of pointers that are scanned for roots in thread. Only [start, *end) is scanned,
+    // so the host can push and pop pointers by moving the end without notifying the recycler.
+    struct ExternalRootRange
+    {
+        ExternalRootRange(void ** start, void ** const * end) : start(start), end(end) {}
+
+        void ** start;
+        void ** const * end;
+    };
+    DListBase<ExternalRootRange> externalRootRangeList;
+
+    // Host handles; the strong ones are scanned for roots in thread
+    GlobalHandleTable globalHandleTable;
+
 #ifdef RECYCLER_PAGE_HEAP
     bool isPageHeapEnabled;
     bool capturePageHeapAllocStack;
@@ -846,23 +863,42 @@ class Recycler
     static const int PrimaryMarkStackReservedPageCount =
         ((SmallAllocationBlockAttributes::PageCount * MarkContext::MarkCandidateSize) / SmallAllocationBlockAttributes::MinObjectSize) + 1;
 
+    // Parallel marking runs up to MaxParallelism threads, the main context + MaxParallelism - 1 additional parallel contexts.
+    // Unless -ParallelMarkThreads says otherwise, we use up to DefaultParallelism threads.
+    static const uint MaxParallelism = MarkContext::MaxSplitTargets + 1;
+    static const uint DefaultParallelism = 4;
+
     MarkContext markContext;
 
-    // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
+    // Contexts for parallel marking, allocated in Initialize.
+    // parallelMarkContexts[0] is processed by the thread driving the mark,
+    // parallelMarkContexts[n + 1] by parallelThreads[n] (see DoParallelMark).
+    uint parallelMarkContextCount;
+    MarkContext * parallelMarkContexts[MaxParallelism - 1];
 
     // Page pools for above markContexts
     PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+    PagePool * parallelMarkPagePools[MaxParallelism - 1];
+
+    // Mark stack chunks that busy parallel markers hand off to idle ones, see ShareParallelMarkWork
+    MarkContext::MarkStack parallelMarkSharedStack;
+    CriticalSection parallelMarkSharedStackCs;
+    volatile uint parallelMarkSharedChunkCount;
+    volatile LONG parallelMarkActiveCount;
+    volatile LONG parallelMarkIdleCount;
+
+    template <typename Fn>
+    void ForEachParallelMarkContext(Fn fn)
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            fn(this->parallelMarkContexts[i]);
+        }
+    }
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -925,6 +961,13 @@ class Recycler
     bool hasDisposableObject;
     DWORD tickCountNextDispose;
     bool hasPendingTransferDisposedObjects;
+
+    // Memory held outside of the recycler by recycler objects, as reported by the host
+    size_t externalMemoryBytes;
+    // Lowest external memory usage since the last collection started
+    size_t externalMemoryBytesBaseline;
+    // Storage of the array buffers that are alive, which the engine allocates outside of the recycler
+    size_t arrayBufferMemoryBytes;
     bool inExhaustiveCollection;
     bool hasExhaustiveCandidate;
     bool inCacheCleanupCollection;
@@ -992,11 +1035,11 @@ class Recycler
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
+    void ParallelWorkFunc(uint parallelId);
 
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    // Helper threads for parallel mark, allocated in Initialize
+    uint parallelThreadCount;
+    RecyclerParallelThread * parallelThreads[MaxParallelism - 2];
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1220,6 +1263,19 @@ class Recycler
         this->CollectNow<CollectExhaustiveCandidate>();
     }
 
+    bool RegisterExternalRootRange(void ** start, void ** const * end)
+    {
+        return externalRootRangeList.PrependNode(&NoThrowHeapAllocator::Instance, start, end) != nullptr;
+    }
+    bool UnregisterExternalRootRange(void ** start);
+
+    GlobalHandleTable::Node * CreateGlobalHandle(void * value, bool weak, bool isPinned)
+    {
+        return globalHandleTable.Allocate(value, weak, isPinned);
+    }
+    void ReleaseGlobalHandle(GlobalHandleTable::Node * node) { globalHandleTable.Free(node); }
+    void SetGlobalHandleWeak(GlobalHandleTable::Node * node, bool weak) { globalHandleTable.SetWeak(node, weak); }
+
 #ifdef RECYCLER_TEST_SUPPORT
     void SetCheckFn(BOOL(*checkFn)(char* addr, size_t size));
 #endif
@@ -1235,6 +1291,13 @@ class Recycler
 #endif
 
     void AddExternalMemoryUsage(size_t size);
+    size_t AdjustExternalMemoryUsage(int64 changeInBytes);
+    size_t GetExternalMemoryUsage() const { return externalMemoryBytes + arrayBufferMemoryBytes; }
+    void AddArrayBufferMemoryUsage(size_t size) { arrayBufferMemoryBytes += size; }
+    void SubtractArrayBufferMemoryUsage(size_t size) { Assert(size <= arrayBufferMemoryBytes); arrayBufferMemoryBytes -= size; }
+
+    // Doesn't wait for a collection in progress, see HeapInfo::GetHeapSpaceUsage
+    void GetHeapSpaceUsage(HeapSpaceUsage * usage, uint count) const { autoHeap.GetHeapSpaceUsage(usage, count); }
 
     bool NeedDispose() { return this->hasDisposableObject; }
 
@@ -1579,6 +1642,8 @@ class Recycler
 
     void ProcessMark(bool background);
     void ProcessParallelMark(bool background, MarkContext * markContext);
+    void ShareParallelMarkWork(MarkContext * markContext);
+    bool TakeParallelMarkWork(MarkContext * markContext);
     template <bool parallel, bool interior>
     void ProcessMarkContext(MarkContext * markContext);
 
@@ -78,6 +78,18 @@ RecyclerHeuristic::UncollectedAllocBytesCollection()
     return DefaultUncollectedAllocBytesCollection;
 }
 
+bool
+RecyclerHeuristic::ShouldCollectForExternalMemory(size_t externalBytes, size_t externalBytesBaseline)
+{
+    if (externalBytes <= externalBytesBaseline)
+    {
+        return false;
+    }
+
+    const size_t growth = externalBytes - externalBytesBaseline;
+    return growth >= DefaultExternalMemoryBytesCollection && growth >= externalBytesBaseline;
+}
+
 #if ENABLE_CONCURRENT_GC
 uint
 RecyclerHeuristic::MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable& flags)
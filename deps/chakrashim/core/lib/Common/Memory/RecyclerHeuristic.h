@@ -36,6 +36,7 @@ class RecyclerHeuristic
 
     // Constant heuristic that may be changed by switches
     static uint UncollectedAllocBytesCollection();
+    static bool ShouldCollectForExternalMemory(size_t externalBytes, size_t externalBytesBaseline);
 #if ENABLE_CONCURRENT_GC
     static uint MaxBackgroundFinishMarkCount(Js::ConfigFlagsTable&);
     static DWORD BackgroundFinishMarkWaitTime(bool, Js::ConfigFlagsTable&);
@@ -79,6 +80,9 @@ class RecyclerHeuristic
 #endif
     static const uint DefaultUncollectedAllocBytesCollection = 1 MEGABYTES;
 
+    // Collect when external memory grew by this much and at least doubled since the last collection
+    static const size_t DefaultExternalMemoryBytesCollection = 32 MEGABYTES;
+
 #if ENABLE_CONCURRENT_GC
     static const uint TickCountConcurrentPriorityBoost = 5000;                              // 5 second
     static const DWORD DefaultFinishConcurrentCollectWaitTime = 1000;                       // 1 second
@@ -19,6 +19,15 @@ RecyclerPageAllocator::RecyclerPageAllocator(Recycler* recycler, AllocationPolic
         )
 {
     this->recycler = recycler;
+
+#ifdef MEM_RESERVE_HUGEPAGES
+    if (flagTable.RecyclerHugePages)
+    {
+        // Segments are smaller than a huge page, so they only get huge pages where the OS merges
+        // neighboring segments. Mark can then walk the heap with fewer TLB misses.
+        this->allocFlags = MEM_RESERVE_HUGEPAGES;
+    }
+#endif
 }
 
 bool RecyclerPageAllocator::IsMemProtectMode()
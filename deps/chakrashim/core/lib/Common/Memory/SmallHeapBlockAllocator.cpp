@@ -161,6 +161,7 @@ SmallHeapBlockAllocator<TBlockType>::SetNew(BlockType * heapBlock)
     this->heapBlock = heapBlock;
     this->freeObjectList = (FreeObject *)heapBlock->GetAddress();
     this->endAddress = heapBlock->GetEndAddress();
+    heapBlock->heapBucket->heapInfo->SetHeapSpaceUsedBytes(heapBlock, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
 
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 
     DebugOnly(this->isAllocatingFromNewBlock = true);
@@ -186,6 +187,15 @@ SmallHeapBlockAllocator<TBlockType>::Set(BlockType * heapBlock)
     RECYCLER_SLOW_CHECK(this->heapBlock->CheckDebugFreeBitVector(true));
     this->freeObjectList = this->heapBlock->freeObjectList;
 
+#if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
+    // The background sweep reports the used bytes of blocks it hasn't swept yet
+    if (!heapBlock->isPendingConcurrentSweepPrep)
+#endif
+    {
+        // Count the free objects as allocated, as uncollectedAllocBytes does
+        heapBlock->heapBucket->heapInfo->SetHeapSpaceUsedBytes(heapBlock, heapBlock->GetObjectSize() * heapBlock->GetObjectCount());
+    }
+
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 
     DebugOnly(this->isAllocatingFromNewBlock = false);
 #endif
@@ -599,6 +599,45 @@ CHAKRA_API
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
 
+/// <summary>
+///     Parses a serialized script and returns a function representing the script.
+///     Provides the ability to lazy load the script source only if/when it is needed, and to
+///     release it once the script is no longer used.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The runtime will hold on to the buffer until all instances of any functions created from
+///     the buffer are garbage collected. It will then call scriptUnloadCallback, whether or not
+///     the source was loaded.
+///     </para>
+///     <para>
+///     scriptUnloadCallback is called during garbage collection and must not call any JsRT API.
+///     </para>
+/// </remarks>
+/// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
+/// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
+/// <param name="scriptUnloadCallback">Callback called when the serialized script and source code are no longer needed.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+///     This context will passed into scriptLoadCallback and scriptUnloadCallback.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">A function representing the script code.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseSerializedWithUnloadCallback(
+        _In_ JsValueRef buffer,
+        _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+        _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
 /// <summary>
 ///     Runs a serialized script.
 ///     Provides the ability to lazy load the script source only if/when it is needed.
@@ -797,6 +836,50 @@ JsCopyStringOneByte(
     _Out_opt_ char* buffer,
     _Out_opt_ size_t* written);
 
+/// <summary>
+///     Create JavascriptString variable from a one-byte (Latin-1) string
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         Every byte of the input is a character in the range U+0000 to U+00FF.
+///         The string is stored with one byte per character until a wide
+///         (Utf16) representation of it is needed.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to string memory.</param>
+/// <param name="length">Number of characters within the string</param>
+/// <param name="value">JsValueRef representing the JavascriptString</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateStringOneByte(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *value);
+
+/// <summary>
+///     Determine whether a string value is stored with one byte per character
+/// </summary>
+/// <remarks>
+///     <para>
+///         A string that is not stored as one byte per character may still
+///         contain only characters that fit in one byte.
+///     </para>
+/// </remarks>
+/// <param name="value">JavascriptString value</param>
+/// <param name="isOneByte">Whether the string is stored as one byte per character</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsIsStringOneByte(
+    _In_ JsValueRef value,
+    _Out_ bool *isOneByte);
+
 /// <summary>
 ///     Obtains frequently used properties of a data view.
 /// </summary>
@@ -882,6 +965,124 @@ CHAKRA_API
         _In_opt_ JsValueRef prototype,
         _Out_ JsValueRef *object);
 
+/// <summary>
+///     Attributes reported by a <c>JsInterceptorQueryCallback</c> for an intercepted property.
+/// </summary>
+typedef enum JsInterceptorPropertyAttributes
+{
+    JsInterceptorPropertyAttributes_None = 0,
+    JsInterceptorPropertyAttributes_ReadOnly = 1,
+    JsInterceptorPropertyAttributes_DontEnum = 2,
+    JsInterceptorPropertyAttributes_DontDelete = 4
+} JsInterceptorPropertyAttributes;
+
+/// <summary>
+///     A callback that intercepts a property read on an interceptor object.
+/// </summary>
+/// <remarks>
+///     For all interceptor callbacks, <c>key</c> is a string or a symbol for named properties
+///     and a number for integer indexed properties.
+/// </remarks>
+/// <param name="object">The interceptor object.</param>
+/// <param name="key">The property key.</param>
+/// <param name="value">The intercepted value.</param>
+/// <returns>
+///     true if the access was intercepted, false to fall back to the object's own properties.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsInterceptorGetCallback)(_In_ JsValueRef object, _In_ JsValueRef key, _Out_ JsValueRef *value);
+
+/// <summary>
+///     A callback that intercepts a property write on an interceptor object.
+/// </summary>
+/// <param name="object">The interceptor object.</param>
+/// <param name="key">The property key.</param>
+/// <param name="value">The value being assigned.</param>
+/// <returns>
+///     true if the assignment was intercepted, false to fall back to the object's own properties.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsInterceptorSetCallback)(_In_ JsValueRef object, _In_ JsValueRef key, _In_ JsValueRef value);
+
+/// <summary>
+///     A callback that reports whether an interceptor object has a property.
+/// </summary>
+/// <param name="object">The interceptor object.</param>
+/// <param name="key">The property key.</param>
+/// <param name="attributes">The <c>JsInterceptorPropertyAttributes</c> of the property.</param>
+/// <returns>
+///     true if the property is provided by the interceptor, false to fall back to the object's own properties.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsInterceptorQueryCallback)(_In_ JsValueRef object, _In_ JsValueRef key, _Out_ int *attributes);
+
+/// <summary>
+///     A callback that intercepts a property deletion on an interceptor object.
+/// </summary>
+/// <param name="object">The interceptor object.</param>
+/// <param name="key">The property key.</param>
+/// <param name="result">Whether the property was deleted.</param>
+/// <returns>
+///     true if the deletion was intercepted, false to fall back to the object's own properties.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsInterceptorDeleteCallback)(_In_ JsValueRef object, _In_ JsValueRef key, _Out_ bool *result);
+
+/// <summary>
+///     A callback that returns the keys provided by the interceptor.
+/// </summary>
+/// <remarks>
+///     The returned keys are enumerated before the object's own properties.
+/// </remarks>
+/// <param name="object">The interceptor object.</param>
+/// <param name="keys">An array of strings, symbols or numbers.</param>
+/// <returns>
+///     true if the enumeration was intercepted, false otherwise.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK * JsInterceptorOwnKeysCallback)(_In_ JsValueRef object, _Out_ JsValueRef *keys);
+
+/// <summary>
+///     The set of callbacks used by an interceptor object. Any callback may be null.
+/// </summary>
+/// <remarks>
+///     The structure is not copied; it must stay alive as long as any object created with it.
+/// </remarks>
+typedef struct JsInterceptorCallbacks
+{
+    JsInterceptorGetCallback get;
+    JsInterceptorSetCallback set;
+    JsInterceptorQueryCallback query;
+    JsInterceptorDeleteCallback deleteProperty;
+    JsInterceptorOwnKeysCallback ownKeys;
+} JsInterceptorCallbacks;
+
+/// <summary>
+///     Creates a new external object whose property accesses are routed to native callbacks.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Accesses that are not intercepted fall back to the object's own properties and its
+///     prototype chain. Property accesses on interceptor objects are never inline cached.
+///     The object otherwise behaves like an object created by <c>JsCreateExternalObjectWithPrototype</c>.
+///     </para>
+/// </remarks>
+/// <param name="data">External data that the object will represent. May be null.</param>
+/// <param name="finalizeCallback">
+///     A callback for when the object is finalized. May be null.
+/// </param>
+/// <param name="prototype">Prototype object or nullptr.</param>
+/// <param name="callbacks">The interceptor callbacks.</param>
+/// <param name="object">The new object.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateInterceptorObject(
+        _In_opt_ void *data,
+        _In_opt_ JsFinalizeCallback finalizeCallback,
+        _In_opt_ JsValueRef prototype,
+        _In_ const JsInterceptorCallbacks *callbacks,
+        _Out_ JsValueRef *object);
+
 /// <summary>
 ///     Gets an object's property.
 /// </summary>
@@ -1063,5 +1264,538 @@ CHAKRA_API
         _Out_opt_ JsValueRef* target,
         _Out_opt_ JsValueRef* handler);
 
+/// <summary>
+///     Adjusts the amount of memory kept alive by objects of a runtime outside of the garbage
+///     collected heap (for example native buffers owned by external objects).
+/// </summary>
+/// <remarks>
+///     <para>
+///     Growing the external memory usage may trigger a garbage collection so that objects holding
+///     on to external memory can be finalized. A change of 0 returns the current usage without
+///     triggering a collection.
+///     </para>
+///     <para>
+///     Must be called on the thread the runtime is active on.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="changeInBytes">
+///     The change of the external memory usage in bytes, negative when external memory was freed.
+/// </param>
+/// <param name="externalMemoryUsage">The external memory usage after the adjustment.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsAdjustExternalMemoryUsage(
+        _In_ JsRuntimeHandle runtime,
+        _In_ int64_t changeInBytes,
+        _Out_opt_ size_t *externalMemoryUsage);
+
+/// <summary>
+///     Events reported to a <c>JsGarbageCollectionCallback</c>.
+/// </summary>
+typedef enum JsGarbageCollectionEvent
+{
+    JsGarbageCollectionEvent_Begin = 0x1,
+    JsGarbageCollectionEvent_End = 0x2
+} JsGarbageCollectionEvent;
+
+/// <summary>
+///     Kinds of garbage collections reported to a <c>JsGarbageCollectionCallback</c>.
+/// </summary>
+/// <remarks>
+///     A partial collection only collects the pages allocated since the previous collection.
+///     A concurrent collection does most of its work on a background thread. Both flags can be
+///     combined, a collection without either flag is a full in-thread collection.
+/// </remarks>
+typedef enum JsGarbageCollectionKind
+{
+    JsGarbageCollectionKind_Full = 0x0,
+    JsGarbageCollectionKind_Partial = 0x1,
+    JsGarbageCollectionKind_Concurrent = 0x2
+} JsGarbageCollectionKind;
+
+/// <summary>
+///     A callback called at the start and at the end of every garbage collection.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The callback is invoked on the thread the runtime is active on, while the collection is
+///     in progress. It must not call into script or allocate objects.
+///     </para>
+///     <para>
+///     Use <c>JsSetRuntimeGarbageCollectionCallback</c> to register this callback.
+///     </para>
+/// </remarks>
+/// <param name="gcEvent">Whether the collection begins or ends.</param>
+/// <param name="kind">The kind of the collection.</param>
+/// <param name="durationInMilliseconds">
+///     For <c>JsGarbageCollectionEvent_End</c>, the time elapsed since the collection began. This is
+///     the pause of in-thread collections. For concurrent collections it includes the time spent on
+///     the background thread. Always 0 for <c>JsGarbageCollectionEvent_Begin</c>.
+/// </param>
+/// <param name="callbackState">The state passed to <c>JsSetRuntimeGarbageCollectionCallback</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsGarbageCollectionCallback)(
+    _In_ JsGarbageCollectionEvent gcEvent,
+    _In_ JsGarbageCollectionKind kind,
+    _In_ double durationInMilliseconds,
+    _In_opt_ void *callbackState);
+
+/// <summary>
+///     Sets a callback function that is called at the start and at the end of every garbage
+///     collection of the runtime.
+/// </summary>
+/// <param name="runtime">The runtime.</param>
+/// <param name="callbackState">
+///     User provided state that will be passed back to the callback.
+/// </param>
+/// <param name="gcCallback">The callback function being set. Use null to clear the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeGarbageCollectionCallback(
+        _In_ JsRuntimeHandle runtime,
+        _In_opt_ void *callbackState,
+        _In_opt_ JsGarbageCollectionCallback gcCallback);
+
+/// <summary>
+///     Spaces of the garbage collected heap reported by <c>JsGetRuntimeHeapSpaceStatistics</c>.
+/// </summary>
+/// <remarks>
+///     Objects are allocated in small, medium or large heap blocks depending on their size. Small
+///     and medium blocks are further split into normal blocks, leaf blocks for objects that don't
+///     contain pointers, and finalizable blocks for objects that need to be finalized.
+/// </remarks>
+typedef enum JsHeapSpace
+{
+    JsHeapSpace_SmallNormal = 0,
+    JsHeapSpace_SmallLeaf = 1,
+    JsHeapSpace_SmallFinalizable = 2,
+    JsHeapSpace_MediumNormal = 3,
+    JsHeapSpace_MediumLeaf = 4,
+    JsHeapSpace_MediumFinalizable = 5,
+    JsHeapSpace_Large = 6,
+    JsHeapSpace_Count = 7
+} JsHeapSpace;
+
+/// <summary>
+///     Statistics of a heap space.
+/// </summary>
+typedef struct JsHeapSpaceStatistics
+{
+    /// <summary>
+    ///     The number of bytes occupied by live objects.
+    /// </summary>
+    size_t usedBytes;
+    /// <summary>
+    ///     The number of bytes of the heap blocks of the space.
+    /// </summary>
+    size_t totalBytes;
+} JsHeapSpaceStatistics;
+
+/// <summary>
+///     Gets the statistics of the spaces of the garbage collected heap of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The statistics are kept up to date by the garbage collector as heap blocks are allocated
+///     and swept, so this neither walks the heap nor waits for a collection in progress. During a
+///     collection they are the counts as of the heap blocks swept so far. The free objects of the
+///     heap blocks currently allocated from are counted as used.
+///     </para>
+///     <para>
+///     Can be called on any thread, including from a garbage collection callback.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="statistics">
+///     An array receiving the statistics of the first <c>count</c> heap spaces, indexed by
+///     <c>JsHeapSpace</c>.
+/// </param>
+/// <param name="count">The number of heap spaces to get, at most <c>JsHeapSpace_Count</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeHeapSpaceStatistics(
+        _In_ JsRuntimeHandle runtime,
+        _Out_writes_(count) JsHeapSpaceStatistics *statistics,
+        _In_ unsigned int count);
+
+/// <summary>
+///     Registers a host-owned array of values as roots of the garbage collector of a runtime.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The values from <c>start</c> up to (not including) <c>*end</c> are kept alive. <c>*end</c>
+///     is read at every collection, so values can be pushed and popped by moving the end pointer
+///     without calling into the runtime. The array must stay allocated until the range is
+///     unregistered or the runtime is disposed.
+///     </para>
+///     <para>
+///     Must be called on the thread the runtime is active on.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="start">The start of the array.</param>
+/// <param name="end">The location of the pointer to the end of the used part of the array.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRegisterRootRange(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsValueRef *start,
+        _In_ JsValueRef * const *end);
+
+/// <summary>
+///     Unregisters an array of values registered with <c>JsRegisterRootRange</c>.
+/// </summary>
+/// <remarks>
+///     Must be called on the thread the runtime is active on.
+/// </remarks>
+/// <param name="runtime">The runtime.</param>
+/// <param name="start">The start of the array.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsUnregisterRootRange(
+        _In_ JsRuntimeHandle runtime,
+        _In_ JsValueRef *start);
+
+/// <summary>
+///     A global handle to a value.
+/// </summary>
+/// <remarks>
+///     A strong global handle keeps its value alive until the handle is released, like
+///     <c>JsAddRef</c>. A weak global handle doesn't, and no longer refers to the value once the
+///     value has been collected. Global handles are cheaper to create and release than
+///     <c>JsAddRef</c>/<c>JsRelease</c> pairs and are meant for hosts holding many values for
+///     an unbounded amount of time.
+/// </remarks>
+typedef void *JsGlobalHandle;
+
+/// <summary>
+///     Creates a global handle to a value.
+/// </summary>
+/// <remarks>
+///     Requires a runtime active on the current thread. The handle must be released with
+///     <c>JsReleaseGlobalHandle</c>, unless the runtime is disposed first.
+/// </remarks>
+/// <param name="ref">The value to be referenced.</param>
+/// <param name="weak">Whether the handle is weak.</param>
+/// <param name="handle">The new global handle.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateGlobalHandle(
+        _In_ JsRef ref,
+        _In_ bool weak,
+        _Out_ JsGlobalHandle *handle);
+
+/// <summary>
+///     Makes a global handle weak or strong.
+/// </summary>
+/// <remarks>
+///     A weak handle whose value has been collected can't be made strong again.
+/// </remarks>
+/// <param name="handle">The global handle.</param>
+/// <param name="weak">Whether the handle is weak.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetGlobalHandleWeak(
+        _In_ JsGlobalHandle handle,
+        _In_ bool weak);
+
+/// <summary>
+///     Gets the value referenced by a global handle.
+/// </summary>
+/// <param name="handle">The global handle.</param>
+/// <param name="ref">The value, or <c>JS_INVALID_REFERENCE</c> if the handle is weak and the
+///     value has been collected.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetGlobalHandleValue(
+        _In_ JsGlobalHandle handle,
+        _Out_ JsRef *ref);
+
+/// <summary>
+///     Releases a global handle.
+/// </summary>
+/// <param name="handle">The global handle.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReleaseGlobalHandle(
+        _In_ JsGlobalHandle handle);
+
+/// <summary>
+///     Creates a one-byte (Latin-1) string value that uses external memory for its characters.
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         Unlike <c>JsCreateStringOneByte</c>, the characters are not copied. They must not
+///         change and must stay valid until <c>finalizeCallback</c> is called, which happens once
+///         the string and every string sharing its characters (e.g. substrings) have been
+///         collected, or when a wide (Utf16) representation of them has been created instead.
+///     </para>
+///     <para>
+///         If the call fails, <c>finalizeCallback</c> is not called and the caller keeps ownership
+///         of <c>content</c>.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to string memory.</param>
+/// <param name="length">Number of characters within the string</param>
+/// <param name="finalizeCallback">Callback for when the memory is no longer used by the string.</param>
+/// <param name="callbackState">User provided state passed to <c>finalizeCallback</c>.</param>
+/// <param name="value">JsValueRef representing the JavascriptString</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateExternalStringOneByte(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value);
+
+/// <summary>
+///     Write as much of a JavascriptString value as fits into a C string buffer (Utf8)
+/// </summary>
+/// <remarks>
+///     <para>
+///         Unlike <c>JsCopyString</c>, the buffer may be smaller than the encoded string. The
+///         string is encoded up to the last code point that fits entirely, so the buffer never
+///         ends with a partial Utf8 sequence, and a surrogate pair is never split. The string is
+///         encoded only once, up to where it is truncated.
+///     </para>
+///     <para>
+///         The buffer is not null terminated.
+///     </para>
+/// </remarks>
+/// <param name="value">JavascriptString value</param>
+/// <param name="buffer">Pointer to buffer</param>
+/// <param name="bufferSize">Buffer size in bytes</param>
+/// <param name="written">Number of bytes written</param>
+/// <param name="charsWritten">Number of characters (Utf16 code units) the written bytes encode</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCopyStringTruncated(
+    _In_ JsValueRef value,
+    _Out_writes_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t* written,
+    _Out_opt_ size_t* charsWritten);
+
+/// <summary>
+///     Parses UTF-8 JSON text into a value
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         The result is the same as that of <c>JSON.parse</c> on the string the text decodes
+///         to, but the text is parsed as is, without creating that string first. Strings in
+///         the result that are all ASCII are stored with one byte per character. The text
+///         does not have to be null terminated.
+///     </para>
+///     <para>
+///         If the text is not valid JSON, a <c>SyntaxError</c> is set as the runtime's
+///         exception and <c>JsErrorScriptException</c> is returned. In time travel debugging
+///         record and replay modes, <c>JsErrorNotImplemented</c> is returned and the text
+///         should be parsed as a string instead.
+///     </para>
+/// </remarks>
+/// <param name="content">Pointer to the UTF-8 text.</param>
+/// <param name="length">Number of bytes of the text</param>
+/// <param name="result">The parsed value</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsParseJsonUtf8(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *result);
+
+/// <summary>
+///     A reader for the UTF-8 JSON text of a value, created by <c>JsCreateJsonUtf8Reader</c>.
+/// </summary>
+typedef void *JsJsonUtf8Reader;
+
+/// <summary>
+///     Serializes a value as JSON, to be read as UTF-8 text with <c>JsReadJsonUtf8</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///        Requires an active script context.
+///     </para>
+///     <para>
+///         The text is the same as that of <c>JSON.stringify(value, undefined, space)</c>, but
+///         it is not created as a string. Each call to <c>JsReadJsonUtf8</c> encodes just the
+///         next part of it, so the memory used by the reader does not depend on the length of
+///         the text. Unpaired surrogates are written as U+FFFD.
+///     </para>
+///     <para>
+///         Any script run by the serialization (<c>toJSON</c> methods, getters and proxy traps)
+///         runs before this returns, so if it throws, <c>JsErrorScriptException</c> is returned
+///         and no reader is created. In time travel debugging record and replay modes,
+///         <c>JsErrorNotImplemented</c> is returned and <c>JSON.stringify</c> should be called
+///         instead.
+///     </para>
+///     <para>
+///         The reader keeps what it serializes alive and must be released with
+///         <c>JsReleaseJsonUtf8Reader</c>.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to serialize.</param>
+/// <param name="space">
+///     The <c>space</c> argument of <c>JSON.stringify</c>, or <c>JS_INVALID_REFERENCE</c> for none.
+/// </param>
+/// <param name="reader">
+///     The new reader, or <c>nullptr</c> when <c>JSON.stringify</c> would return <c>undefined</c>.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateJsonUtf8Reader(
+    _In_ JsValueRef value,
+    _In_opt_ JsValueRef space,
+    _Out_ JsJsonUtf8Reader *reader);
+
+/// <summary>
+///     Reads the next part of the UTF-8 JSON text of a reader.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. No script is run. The buffer is filled as far as
+///     possible without ending in the middle of a character.
+/// </remarks>
+/// <param name="reader">The reader.</param>
+/// <param name="buffer">The buffer the text is written to.</param>
+/// <param name="bufferSize">Size of the buffer; at least 4 bytes.</param>
+/// <param name="written">
+///     The number of bytes written; zero once the whole text has been read.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsReadJsonUtf8(
+    _In_ JsJsonUtf8Reader reader,
+    _Out_writes_to_(bufferSize, *written) uint8_t *buffer,
+    _In_ size_t bufferSize,
+    _Out_ size_t *written);
+
+/// <summary>
+///     Releases a reader created by <c>JsCreateJsonUtf8Reader</c>.
+/// </summary>
+/// <remarks>
+///     Requires a runtime active on the current thread. The reader doesn't have to have been
+///     read to the end.
+/// </remarks>
+/// <param name="reader">The reader.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsReleaseJsonUtf8Reader(
+    _In_ JsJsonUtf8Reader reader);
+
+/// <summary>
+///     Sets the directory that dynamic profiles are cached in across processes.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Must be called before any runtime is created. Once set, the profile that the engine
+///         collects for a script is loaded from the directory when the script is run again (by
+///         <c>JsRun</c>, <c>JsParse</c> and the other source APIs), so the functions that were hot
+///         in the previous process are JIT'd with its type feedback as soon as they are parsed
+///         instead of after warming up in the interpreter. Profiles are saved when a script
+///         context is closed, or by calling <c>JsSaveProfileCache</c>.
+///     </para>
+///     <para>
+///         Files are named after a hash of the script source and are only used by the same engine
+///         build that wrote them; anything else in the directory is ignored. The directory must
+///         already exist.
+///     </para>
+/// </remarks>
+/// <param name="directory">
+///     The UTF-8 path of the directory, or <c>nullptr</c> to stop using the cache.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorNotImplemented</c> if the engine was built without native code generation.
+/// </returns>
+CHAKRA_API
+JsSetProfileCacheDirectory(
+    _In_opt_ const char *directory);
+
+/// <summary>
+///     Saves the dynamic profiles of the scripts run in the current script context to the
+///     directory set by <c>JsSetProfileCacheDirectory</c>.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. Hosts that exit without closing the script context
+///     should call this first. Does nothing if no directory has been set.
+/// </remarks>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     <c>JsErrorNotImplemented</c> if the engine was built without native code generation.
+/// </returns>
+CHAKRA_API
+JsSaveProfileCache();
+
+/// <summary>
+///     Options for the pages that back the garbage collected heap.
+/// </summary>
+typedef enum JsRecyclerPageOptions
+{
+    /// <summary>
+    ///     No options.
+    /// </summary>
+    JsRecyclerPageOptionNone = 0x00000000,
+    /// <summary>
+    ///     Hint the OS to back heap segments with transparent huge pages (Linux only).
+    /// </summary>
+    JsRecyclerPageOptionHugePages = 0x00000001,
+    /// <summary>
+    ///     After an idle decommit, reset the free pages (MEM_RESET / MADV_FREE) instead of
+    ///     decommitting them, so the OS only reclaims them under memory pressure.
+    /// </summary>
+    JsRecyclerPageOptionIdleResetPages = 0x00000002,
+} JsRecyclerPageOptions;
+
+/// <summary>
+///     Sets the options for the pages of the garbage collected heap of new runtimes.
+/// </summary>
+/// <remarks>
+///     Must be called before any runtime is created. These are the <c>-RecyclerHugePages</c>
+///     and <c>-IdleDecommitResetPages</c> engine flags.
+/// </remarks>
+/// <param name="options">The page options.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSetRecyclerPageOptions(
+    _In_ JsRecyclerPageOptions options);
+
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
@@ -6,6 +6,7 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtExternalOneByteBuffer.h"
 #include "jsrtHelper.h"
 
 #include "JsrtSourceHolder.h"
@@ -15,8 +16,12 @@
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Library/JavascriptSymbol.h"
 #include "Library/JavascriptPromise.h"
+#include "Library/JSON.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
+#ifdef ENABLE_PROFILE_CACHE
+#include "Language/ProfileCache.h"
+#endif
 
 // Parser Includes
 #include "cmperr.h"     // For ERRnoMemory
@@ -1318,6 +1323,35 @@ CHAKRA_API JsCreateExternalObjectWithPrototype(_In_opt_ void *data,
     });
 }
 
+#ifdef _CHAKRACOREBUILD
+CHAKRA_API JsCreateInterceptorObject(_In_opt_ void *data,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ JsValueRef prototype,
+    _In_ const JsInterceptorCallbacks *callbacks,
+    _Out_ JsValueRef *object)
+{
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTAllocateExternalObject, prototype);
+
+        PARAM_NOT_NULL(callbacks);
+        PARAM_NOT_NULL(object);
+
+        Js::RecyclableObject * prototypeObject = nullptr;
+        if (prototype != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_OBJECT(prototype, scriptContext);
+            prototypeObject = Js::RecyclableObject::FromVar(prototype);
+        }
+
+        *object = JsrtInterceptorObject::Create(data, finalizeCallback, callbacks, prototypeObject, scriptContext);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, object);
+
+        return JsNoError;
+    });
+}
+#endif
+
 CHAKRA_API JsCreateExternalObject(_In_opt_ void *data, _In_opt_ JsFinalizeCallback finalizeCallback, _Out_ JsValueRef *object)
 {
     return JsCreateExternalObjectWithPrototype(data, finalizeCallback, JS_INVALID_REFERENCE, object);
@@ -3455,6 +3489,13 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
         if (sourceContextInfo == nullptr)
         {
             sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr);
+#ifdef ENABLE_PROFILE_CACHE
+            if (Js::ProfileCache::IsEnabled())
+            {
+                Js::ProfileCache::Load(sourceContextInfo, script, cb,
+                    (loadScriptFlag & LoadScriptFlag_Utf8Source) == LoadScriptFlag_Utf8Source);
+            }
+#endif
         }
 
         const int chsize = (loadScriptFlag & LoadScriptFlag_Utf8Source) ?
@@ -5018,14 +5059,16 @@ CHAKRA_API JsSerialize(
     return errorCode;
 }
 
-CHAKRA_API JsParseSerialized(
+CHAKRA_API JsParseSerializedWithUnloadCallback(
     _In_ JsValueRef bufferVal,
     _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSerializedScriptUnloadCallback scriptUnloadCallback,
     _In_ JsSourceContext sourceContext,
     _In_ JsValueRef sourceUrl,
     _Out_ JsValueRef *result)
 {
     PARAM_NOT_NULL(bufferVal);
+    PARAM_NOT_NULL(scriptUnloadCallback);
     PARAM_NOT_NULL(sourceUrl);
 
     const WCHAR *url;
@@ -5048,11 +5091,22 @@ CHAKRA_API JsParseSerialized(
     byte* buffer = Js::ArrayBuffer::FromVar(bufferVal)->GetBuffer();
 
     return RunSerializedScriptCore(
-      scriptLoadCallback, DummyScriptUnloadCallback,
+      scriptLoadCallback, scriptUnloadCallback,
       sourceContext,// use the same user provided sourceContext as scriptLoadSourceContext
       buffer, bufferVal, sourceContext, url, true, result);
 }
 
+CHAKRA_API JsParseSerialized(
+    _In_ JsValueRef bufferVal,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    return JsParseSerializedWithUnloadCallback(bufferVal, scriptLoadCallback,
+        DummyScriptUnloadCallback, sourceContext, sourceUrl, result);
+}
+
 CHAKRA_API JsRunSerialized(
     _In_ JsValueRef bufferVal,
     _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
@@ -5266,6 +5320,35 @@ CHAKRA_API JsCopyStringOneByte(
 {
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
+
+    // Copy one-byte strings without widening them
+    Js::OneByteString* oneByteString = Js::OneByteString::TryFromVar(value);
+    if (oneByteString != nullptr && !oneByteString->IsFinalized())
+    {
+        if (written)
+        {
+            *written = 0;
+        }
+
+        const size_t strLength = oneByteString->GetLength();
+        if (start < 0 || (size_t)start > strLength)
+        {
+            return JsErrorInvalidArgument;  // start out of range, no chars written
+        }
+
+        const size_t count = min(static_cast<size_t>(length), strLength - start);
+        if (buffer && count > 0)
+        {
+            oneByteString->CopyOneByte(reinterpret_cast<byte*>(buffer), start, static_cast<charcount_t>(count));
+        }
+
+        if (written)
+        {
+            *written = count;
+        }
+        return JsNoError;
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
     {
@@ -5280,6 +5363,52 @@ CHAKRA_API JsCopyStringOneByte(
     });
 }
 
+CHAKRA_API JsCreateStringOneByte(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *value)
+{
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(value);
+    *value = JS_INVALID_REFERENCE;
+
+    if (length > MaxCharCount)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+
+        Js::JavascriptString *stringValue = Js::OneByteString::New(content, (CharCount)length, scriptContext);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
+
+        *value = stringValue;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsIsStringOneByte(
+    _In_ JsValueRef value,
+    _Out_ bool *isOneByte)
+{
+    VALIDATE_JSREF(value);
+    PARAM_NOT_NULL(isOneByte);
+    *isOneByte = false;
+
+    if (!Js::JavascriptString::Is(value))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    Js::OneByteString* oneByteString = Js::OneByteString::TryFromVar(value);
+    *isOneByte = oneByteString != nullptr && !oneByteString->IsFinalized();
+    return JsNoError;
+}
+
 CHAKRA_API JsGetDataViewInfo(
     _In_ JsValueRef dataView,
     _Out_opt_ JsValueRef *arrayBuffer,
@@ -5370,4 +5499,447 @@ CHAKRA_API JsGetProxyProperties (_In_ JsValueRef object, _Out_ bool* isProxy, _O
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
+CHAKRA_API JsAdjustExternalMemoryUsage(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ int64_t changeInBytes,
+    _Out_opt_ size_t *externalMemoryUsage)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    if (ThreadContext::GetContextForCurrentThread() != threadContext)
+    {
+        return JsErrorWrongThread;
+    }
+
+    // A change of 0 only queries the usage, and must not trigger a collection
+    Recycler * recycler = threadContext->GetRecycler();
+    size_t usage = changeInBytes == 0 ?
+        recycler->GetExternalMemoryUsage() :
+        recycler->AdjustExternalMemoryUsage(changeInBytes);
+
+    if (externalMemoryUsage != nullptr)
+    {
+        *externalMemoryUsage = usage;
+    }
+
+    return JsNoError;
+}
+
+CHAKRA_API JsSetRuntimeGarbageCollectionCallback(
+    _In_ JsRuntimeHandle runtime,
+    _In_opt_ void *callbackState,
+    _In_opt_ JsGarbageCollectionCallback gcCallback)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtime);
+
+        JsrtRuntime::FromHandle(runtime)->SetGarbageCollectionCallback(gcCallback, callbackState);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeHeapSpaceStatistics(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _Out_writes_(count) JsHeapSpaceStatistics *statistics,
+    _In_ unsigned int count)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(statistics);
+
+    if (count > (unsigned int)JsHeapSpace_Count)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    CompileAssert((int)JsHeapSpace_SmallNormal == (int)HeapSpaceSmallNormal);
+    CompileAssert((int)JsHeapSpace_MediumNormal == (int)HeapSpaceMediumNormal);
+    CompileAssert((int)JsHeapSpace_Large == (int)HeapSpaceLarge);
+    CompileAssert((int)JsHeapSpace_Count == (int)HeapSpaceCount);
+    CompileAssert(sizeof(JsHeapSpaceStatistics) == sizeof(HeapSpaceUsage));
+
+    // The recycler keeps these up to date, a collection in progress is neither waited for nor finished
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    threadContext->GetRecycler()->GetHeapSpaceUsage((HeapSpaceUsage *)statistics, count);
+
+    return JsNoError;
+}
+
+CHAKRA_API JsRegisterRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsValueRef *start,
+    _In_ JsValueRef * const *end)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(start);
+    PARAM_NOT_NULL(end);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    if (ThreadContext::GetContextForCurrentThread() != threadContext)
+    {
+        return JsErrorWrongThread;
+    }
+
+    if (!threadContext->GetRecycler()->RegisterExternalRootRange(start, end))
+    {
+        return JsErrorOutOfMemory;
+    }
+    return JsNoError;
+}
+
+CHAKRA_API JsUnregisterRootRange(
+    _In_ JsRuntimeHandle runtimeHandle,
+    _In_ JsValueRef *start)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(start);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    if (ThreadContext::GetContextForCurrentThread() != threadContext)
+    {
+        return JsErrorWrongThread;
+    }
+
+    if (!threadContext->GetRecycler()->UnregisterExternalRootRange(start))
+    {
+        return JsErrorInvalidArgument;
+    }
+    return JsNoError;
+}
+
+CHAKRA_API JsCreateGlobalHandle(
+    _In_ JsRef ref,
+    _In_ bool weak,
+    _Out_ JsGlobalHandle *handle)
+{
+    VALIDATE_JSREF(ref);
+    PARAM_NOT_NULL(handle);
+    *handle = nullptr;
+
+    ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+    if (threadContext == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    // Values that aren't recycler objects don't need to be kept alive. With time travel debugging,
+    // roots are tracked through JsAddRef/JsRelease, so the handle only forwards to those.
+    Recycler * recycler = threadContext->GetRecycler();
+    const bool isPinned = Js::TaggedNumber::Is(ref) || !recycler->IsValidObject(ref)
+#if ENABLE_TTD
+        || threadContext->IsRuntimeInTTDMode()
+#endif
+        ;
+
+    GlobalHandleTable::Node * node = recycler->CreateGlobalHandle(ref, weak, isPinned);
+    if (node == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    if (isPinned && !weak)
+    {
+        JsErrorCode errorCode = JsAddRef(ref, nullptr);
+        if (errorCode != JsNoError)
+        {
+            recycler->ReleaseGlobalHandle(node);
+            return errorCode;
+        }
+    }
+
+    *handle = node;
+    return JsNoError;
+}
+
+CHAKRA_API JsSetGlobalHandleWeak(
+    _In_ JsGlobalHandle handle,
+    _In_ bool weak)
+{
+    PARAM_NOT_NULL(handle);
+
+    ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+    if (threadContext == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    GlobalHandleTable::Node * node = static_cast<GlobalHandleTable::Node *>(handle);
+    const bool isWeak = (node->kind == GlobalHandleTable::NodeKind::Weak);
+    if (isWeak == weak)
+    {
+        return JsNoError;
+    }
+
+    if (node->value == nullptr)
+    {
+        // The value of the weak handle has been collected
+        return JsErrorInvalidArgument;
+    }
+
+    if (node->isPinned)
+    {
+        JsErrorCode errorCode = weak ? JsRelease(node->value, nullptr) : JsAddRef(node->value, nullptr);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+    }
+
+    threadContext->GetRecycler()->SetGlobalHandleWeak(node, weak);
+    return JsNoError;
+}
+
+CHAKRA_API JsGetGlobalHandleValue(
+    _In_ JsGlobalHandle handle,
+    _Out_ JsRef *ref)
+{
+    PARAM_NOT_NULL(handle);
+    PARAM_NOT_NULL(ref);
+
+    GlobalHandleTable::Node * node = static_cast<GlobalHandleTable::Node *>(handle);
+    Assert(node->kind != GlobalHandleTable::NodeKind::Free);
+    *ref = (node->value != nullptr) ? node->value : JS_INVALID_REFERENCE;
+    return JsNoError;
+}
+
+CHAKRA_API JsReleaseGlobalHandle(
+    _In_ JsGlobalHandle handle)
+{
+    PARAM_NOT_NULL(handle);
+
+    ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+    if (threadContext == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    GlobalHandleTable::Node * node = static_cast<GlobalHandleTable::Node *>(handle);
+    if (node->isPinned && node->kind == GlobalHandleTable::NodeKind::Strong)
+    {
+        // Don't leak the node even if we fail to release the value
+        JsErrorCode errorCode = JsRelease(node->value, nullptr);
+        Assert(errorCode == JsNoError);
+        UNREFERENCED_PARAMETER(errorCode);
+    }
+
+    threadContext->GetRecycler()->ReleaseGlobalHandle(node);
+    return JsNoError;
+}
+
+CHAKRA_API JsCreateExternalStringOneByte(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _In_opt_ JsFinalizeCallback finalizeCallback,
+    _In_opt_ void *callbackState,
+    _Out_ JsValueRef *value)
+{
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(value);
+    *value = JS_INVALID_REFERENCE;
+
+    if (length > MaxCharCount)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+
+        Js::JsrtExternalOneByteBuffer *externalBuffer = Js::JsrtExternalOneByteBuffer::New(scriptContext->GetRecycler());
+        Js::JavascriptString *stringValue = Js::OneByteString::NewExternal(content, (CharCount)length, externalBuffer, scriptContext);
+        externalBuffer->SetFinalizeCallback(finalizeCallback, callbackState);
+
+        PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
+
+        *value = stringValue;
+
+        PERFORM_JSRT_TTD_RECORD_ACTION_RESULT(scriptContext, value);
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCopyStringTruncated(
+    _In_ JsValueRef value,
+    _Out_writes_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _Out_opt_ size_t* written,
+    _Out_opt_ size_t* charsWritten)
+{
+    PARAM_NOT_NULL(value);
+    VALIDATE_JSREF(value);
+    if (bufferSize > 0)
+    {
+        PARAM_NOT_NULL(buffer);
+    }
+
+    if (written)
+    {
+        *written = 0;
+    }
+    if (charsWritten)
+    {
+        *charsWritten = 0;
+    }
+
+    const char16* str = nullptr;
+    size_t strLength = 0;
+    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    charcount_t encoded = 0;
+    static_assert(sizeof(utf8char_t) == sizeof(char), "Needs to be valid for cast");
+    size_t count = utf8::EncodeTrueUtf8IntoTruncated((utf8char_t*)buffer, bufferSize, str, (charcount_t)strLength, &encoded);
+
+    if (written)
+    {
+        *written = count;
+    }
+    if (charsWritten)
+    {
+        *charsWritten = encoded;
+    }
+
+    return JsNoError;
+}
+
+CHAKRA_API JsParseJsonUtf8(
+    _In_ const uint8_t *content,
+    _In_ size_t length,
+    _Out_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(content);
+    PARAM_NOT_NULL(result);
+    *result = JS_INVALID_REFERENCE;
+
+    if (length > MaxCharCount)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+#if ENABLE_TTD
+        // The values created by the parser aren't recorded, so they couldn't be replayed
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        *result = JSON::ParseUtf8(content, (uint)length, scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsCreateJsonUtf8Reader(
+    _In_ JsValueRef value,
+    _In_opt_ JsValueRef space,
+    _Out_ JsJsonUtf8Reader *reader)
+{
+    PARAM_NOT_NULL(reader);
+    *reader = nullptr;
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        if (space != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(space, scriptContext);
+        }
+
+#if ENABLE_TTD
+        // The script run by the serialization isn't recorded, so it couldn't be replayed
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        *reader = JSON::CreateUtf8Reader(value, space, scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReadJsonUtf8(
+    _In_ JsJsonUtf8Reader reader,
+    _Out_writes_to_(bufferSize, *written) uint8_t *buffer,
+    _In_ size_t bufferSize,
+    _Out_ size_t *written)
+{
+    PARAM_NOT_NULL(reader);
+    PARAM_NOT_NULL(buffer);
+    PARAM_NOT_NULL(written);
+    *written = 0;
+
+    if (bufferSize < JSON::MinUtf8ChunkSize)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        *written = JSON::ReadUtf8(static_cast<Js::JSONUtf8Reader *>(reader), buffer, bufferSize);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReleaseJsonUtf8Reader(
+    _In_ JsJsonUtf8Reader reader)
+{
+    PARAM_NOT_NULL(reader);
+
+    ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+    if (threadContext == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    JSON::DeleteUtf8Reader(static_cast<Js::JSONUtf8Reader *>(reader));
+    return JsNoError;
+}
+
+CHAKRA_API JsSetProfileCacheDirectory(_In_opt_ const char *directory)
+{
+#ifdef ENABLE_PROFILE_CACHE
+    if (directory == nullptr)
+    {
+        Js::ProfileCache::SetDirectory(nullptr);
+        return JsNoError;
+    }
+
+    utf8::NarrowToWide wideDirectory(directory);
+    if (!wideDirectory || !Js::ProfileCache::SetDirectory(wideDirectory))
+    {
+        return JsErrorOutOfMemory;
+    }
+    return JsNoError;
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsSaveProfileCache()
+{
+#ifdef ENABLE_PROFILE_CACHE
+    return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        Js::ProfileCache::Save(scriptContext);
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API JsSetRecyclerPageOptions(_In_ JsRecyclerPageOptions options)
+{
+    if ((options & ~(JsRecyclerPageOptionHugePages | JsRecyclerPageOptionIdleResetPages)) != 0)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    Js::Configuration::Global.flags.RecyclerHugePages = (options & JsRecyclerPageOptionHugePages) != 0;
+    Js::Configuration::Global.flags.IdleDecommitResetPages = (options & JsRecyclerPageOptionIdleResetPages) != 0;
+    return JsNoError;
+}
+
 #endif // _CHAKRACOREBUILD
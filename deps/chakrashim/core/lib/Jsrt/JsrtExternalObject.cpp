@@ -6,6 +6,7 @@
 #include "jsrtHelper.h"
 #include "JsrtExternalObject.h"
 #include "Types/PathTypeHandler.h"
+#include "Library/JavascriptSymbol.h"
 
 JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback)
     : Js::DynamicType(
@@ -17,10 +18,21 @@ JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeC
         true,
         true)
         , jsFinalizeCallback(finalizeCallback)
+#ifdef _CHAKRACOREBUILD
+        , interceptorCallbacks(nullptr)
+#endif
 {
     this->flags |= TypeFlagMask_JsrtExternal;
 }
 
+#ifdef _CHAKRACOREBUILD
+JsrtExternalType::JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback, const JsInterceptorCallbacks * interceptorCallbacks)
+    : JsrtExternalType(scriptContext, finalizeCallback)
+{
+    this->interceptorCallbacks = interceptorCallbacks;
+}
+#endif
+
 JsrtExternalObject::JsrtExternalObject(JsrtExternalType * type, void *data) :
     slot(data),
     Js::DynamicObject(type, false/* initSlots*/)
@@ -59,7 +71,11 @@ bool JsrtExternalObject::Is(Js::Var value)
     }
 
     return (VirtualTableInfo<JsrtExternalObject>::HasVirtualTable(value)) ||
-        (VirtualTableInfo<Js::CrossSiteObject<JsrtExternalObject>>::HasVirtualTable(value));
+        (VirtualTableInfo<Js::CrossSiteObject<JsrtExternalObject>>::HasVirtualTable(value))
+#ifdef _CHAKRACOREBUILD
+        || JsrtInterceptorObject::Is(value)
+#endif
+        ;
 }
 
 JsrtExternalObject * JsrtExternalObject::FromVar(Js::Var value)
@@ -104,6 +120,572 @@ Js::DynamicType* JsrtExternalObject::DuplicateType()
         this->GetExternalType());
 }
 
+#ifdef _CHAKRACOREBUILD
+JsrtInterceptorObject::JsrtInterceptorObject(JsrtExternalType * type, void *data) :
+    JsrtExternalObject(type, data)
+{
+}
+
+/* static */
+JsrtInterceptorObject* JsrtInterceptorObject::Create(void *data, JsFinalizeCallback finalizeCallback, const JsInterceptorCallbacks * callbacks, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext)
+{
+    Assert(callbacks != nullptr);
+
+    // Interceptor objects must never share a type with plain external objects; an inline cache
+    // filled in for one of those would let property accesses bypass the interceptor. The types
+    // are cached per callback table instead of per finalizer.
+    const uintptr_t typeKey = reinterpret_cast<uintptr_t>(callbacks);
+    JsrtExternalType * externalType = static_cast<JsrtExternalType *>(scriptContext->GetLibrary()->GetCachedJsrtExternalType(typeKey));
+
+    if (externalType == nullptr || externalType->GetJsFinalizeCallback() != finalizeCallback)
+    {
+        bool cacheType = (externalType == nullptr);
+        externalType = RecyclerNew(scriptContext->GetRecycler(), JsrtExternalType, scriptContext, finalizeCallback, callbacks);
+        if (cacheType)
+        {
+            scriptContext->GetLibrary()->CacheJsrtExternalType(typeKey, externalType);
+        }
+    }
+
+    Assert(externalType->IsJsrtExternal());
+    Assert(externalType->GetInterceptorCallbacks() == callbacks);
+
+    JsrtInterceptorObject * interceptorObject = RecyclerNewFinalized(scriptContext->GetRecycler(), JsrtInterceptorObject, externalType, data);
+
+    if (prototype != nullptr)
+    {
+        interceptorObject->SetPrototype(prototype);
+    }
+
+    return interceptorObject;
+}
+
+bool JsrtInterceptorObject::Is(Js::Var value)
+{
+    if (Js::TaggedNumber::Is(value))
+    {
+        return false;
+    }
+
+    return (VirtualTableInfo<JsrtInterceptorObject>::HasVirtualTable(value)) ||
+        (VirtualTableInfo<Js::CrossSiteObject<JsrtInterceptorObject>>::HasVirtualTable(value));
+}
+
+Js::Var JsrtInterceptorObject::GetKey(Js::PropertyId propertyId) const
+{
+    Js::ScriptContext * scriptContext = this->GetScriptContext();
+    const Js::PropertyRecord * propertyRecord = scriptContext->GetPropertyName(propertyId);
+
+    if (propertyRecord->IsSymbol())
+    {
+        return scriptContext->GetLibrary()->CreateSymbol(propertyRecord);
+    }
+
+    if (propertyRecord->IsNumeric())
+    {
+        return Js::JavascriptNumber::ToVar(propertyRecord->GetNumericValue(), scriptContext);
+    }
+
+    return scriptContext->GetPropertyString(propertyId);
+}
+
+Js::Var JsrtInterceptorObject::GetKey(Js::JavascriptString * propertyNameString) const
+{
+    return propertyNameString;
+}
+
+Js::Var JsrtInterceptorObject::GetKey(uint32 index) const
+{
+    return Js::JavascriptNumber::ToVar(index, this->GetScriptContext());
+}
+
+bool JsrtInterceptorObject::CanCallInterceptor(Js::ScriptContext * requestContext) const
+{
+    // Interceptors are implicit calls into the host. When those are disabled (e.g. jitted code probing
+    // for side effects) report the call and let the caller bail out instead of running host code.
+    ThreadContext * threadContext = requestContext->GetThreadContext();
+    if (threadContext->IsDisableImplicitCall())
+    {
+        threadContext->AddImplicitCallFlags(Js::ImplicitCall_External);
+        return false;
+    }
+
+    return true;
+}
+
+template <class Fn>
+bool JsrtInterceptorObject::InvokeInterceptor(Fn fn)
+{
+    Js::ScriptContext * scriptContext = this->GetScriptContext();
+    bool intercepted = false;
+
+    BEGIN_INTERCEPTOR(scriptContext)
+    {
+        intercepted = fn();
+    }
+    END_INTERCEPTOR(scriptContext);
+
+    return intercepted;
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptGet(TKey key, Js::Var* value, Js::ScriptContext * requestContext)
+{
+    const JsInterceptorCallbacks * callbacks = this->GetCallbacks();
+    if (callbacks->get == nullptr || !CanCallInterceptor(requestContext))
+    {
+        return false;
+    }
+
+    Js::Var keyVar = GetKey(key);
+    JsValueRef result = JS_INVALID_REFERENCE;
+    if (!InvokeInterceptor([&]() { return callbacks->get(this, keyVar, &result); }) ||
+        result == JS_INVALID_REFERENCE)
+    {
+        return false;
+    }
+
+    *value = result;
+    return true;
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptSet(TKey key, Js::Var value)
+{
+    const JsInterceptorCallbacks * callbacks = this->GetCallbacks();
+    if (callbacks->set == nullptr || !CanCallInterceptor(this->GetScriptContext()))
+    {
+        return false;
+    }
+
+    Js::Var keyVar = GetKey(key);
+    return InvokeInterceptor([&]() { return callbacks->set(this, keyVar, value); });
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptQuery(TKey key, int* attributes)
+{
+    const JsInterceptorCallbacks * callbacks = this->GetCallbacks();
+    if (callbacks->query == nullptr || !CanCallInterceptor(this->GetScriptContext()))
+    {
+        return false;
+    }
+
+    Js::Var keyVar = GetKey(key);
+    *attributes = JsInterceptorPropertyAttributes_None;
+    return InvokeInterceptor([&]() { return callbacks->query(this, keyVar, attributes); });
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptDelete(TKey key, BOOL* result)
+{
+    const JsInterceptorCallbacks * callbacks = this->GetCallbacks();
+    if (callbacks->deleteProperty == nullptr || !CanCallInterceptor(this->GetScriptContext()))
+    {
+        return false;
+    }
+
+    Js::Var keyVar = GetKey(key);
+    bool deleted = false;
+    if (!InvokeInterceptor([&]() { return callbacks->deleteProperty(this, keyVar, &deleted); }))
+    {
+        return false;
+    }
+
+    *result = deleted;
+    return true;
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptHas(TKey key)
+{
+    // A property is present if the query callback claims it, or, lacking a query
+    // callback, if the getter produces a value for it.
+    int attributes;
+    if (InterceptQuery(key, &attributes))
+    {
+        return true;
+    }
+
+    Js::Var value;
+    return this->GetCallbacks()->query == nullptr &&
+        InterceptGet(key, &value, this->GetScriptContext());
+}
+
+template <class TKey>
+bool JsrtInterceptorObject::InterceptAttributes(TKey key, int* attributes)
+{
+    if (InterceptQuery(key, attributes))
+    {
+        return true;
+    }
+
+    Js::Var value;
+    if (this->GetCallbacks()->query == nullptr &&
+        InterceptGet(key, &value, this->GetScriptContext()))
+    {
+        *attributes = JsInterceptorPropertyAttributes_None;
+        return true;
+    }
+
+    return false;
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::HasPropertyQuery(Js::PropertyId propertyId)
+{
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptHas(propertyId))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    return JsrtExternalObject::HasPropertyQuery(propertyId);
+}
+
+BOOL JsrtInterceptorObject::HasOwnProperty(Js::PropertyId propertyId)
+{
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptHas(propertyId))
+    {
+        return TRUE;
+    }
+
+    return JsrtExternalObject::HasOwnProperty(propertyId);
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::GetPropertyQuery(Js::Var originalInstance, Js::PropertyId propertyId, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisablePrototypeCache(info, this);
+
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptGet(propertyId, value, requestContext))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    Js::PropertyQueryFlags result = JsrtExternalObject::GetPropertyQuery(originalInstance, propertyId, value, info, requestContext);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return result;
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::GetPropertyQuery(Js::Var originalInstance, Js::JavascriptString* propertyNameString, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisablePrototypeCache(info, this);
+
+    if (InterceptGet(propertyNameString, value, requestContext))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    Js::PropertyQueryFlags result = JsrtExternalObject::GetPropertyQuery(originalInstance, propertyNameString, value, info, requestContext);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return result;
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::GetPropertyReferenceQuery(Js::Var originalInstance, Js::PropertyId propertyId, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisablePrototypeCache(info, this);
+
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptGet(propertyId, value, requestContext))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    Js::PropertyQueryFlags result = JsrtExternalObject::GetPropertyReferenceQuery(originalInstance, propertyId, value, info, requestContext);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return result;
+}
+
+BOOL JsrtInterceptorObject::SetProperty(Js::PropertyId propertyId, Js::Var value, Js::PropertyOperationFlags flags, Js::PropertyValueInfo* info)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisableStoreFieldCache(info);
+
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptSet(propertyId, value))
+    {
+        return TRUE;
+    }
+
+    BOOL result = JsrtExternalObject::SetProperty(propertyId, value, flags, info);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return result;
+}
+
+BOOL JsrtInterceptorObject::SetProperty(Js::JavascriptString* propertyNameString, Js::Var value, Js::PropertyOperationFlags flags, Js::PropertyValueInfo* info)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisableStoreFieldCache(info);
+
+    if (InterceptSet(propertyNameString, value))
+    {
+        return TRUE;
+    }
+
+    BOOL result = JsrtExternalObject::SetProperty(propertyNameString, value, flags, info);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return result;
+}
+
+Js::DescriptorFlags JsrtInterceptorObject::GetSetter(Js::PropertyId propertyId, Js::Var *setterValue, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisablePrototypeCache(info, this);
+
+    // With a set interceptor the assignment must reach SetProperty, which offers it
+    // to the host before falling back to any own accessor.
+    if (this->GetCallbacks()->set != nullptr)
+    {
+        return Js::None;
+    }
+
+    Js::DescriptorFlags flags = JsrtExternalObject::GetSetter(propertyId, setterValue, info, requestContext);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return flags;
+}
+
+Js::DescriptorFlags JsrtInterceptorObject::GetSetter(Js::JavascriptString* propertyNameString, Js::Var *setterValue, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext)
+{
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    Js::PropertyValueInfo::DisablePrototypeCache(info, this);
+
+    if (this->GetCallbacks()->set != nullptr)
+    {
+        return Js::None;
+    }
+
+    Js::DescriptorFlags flags = JsrtExternalObject::GetSetter(propertyNameString, setterValue, info, requestContext);
+    Js::PropertyValueInfo::SetNoCache(info, this);
+    return flags;
+}
+
+BOOL JsrtInterceptorObject::DeleteProperty(Js::PropertyId propertyId, Js::PropertyOperationFlags flags)
+{
+    BOOL result;
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptDelete(propertyId, &result))
+    {
+        return result;
+    }
+
+    return JsrtExternalObject::DeleteProperty(propertyId, flags);
+}
+
+BOOL JsrtInterceptorObject::DeleteProperty(Js::JavascriptString *propertyNameString, Js::PropertyOperationFlags flags)
+{
+    BOOL result;
+    if (InterceptDelete(propertyNameString, &result))
+    {
+        return result;
+    }
+
+    return JsrtExternalObject::DeleteProperty(propertyNameString, flags);
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::HasItemQuery(uint32 index)
+{
+    if (InterceptHas(index))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    return JsrtExternalObject::HasItemQuery(index);
+}
+
+BOOL JsrtInterceptorObject::HasOwnItem(uint32 index)
+{
+    if (InterceptHas(index))
+    {
+        return TRUE;
+    }
+
+    return JsrtExternalObject::HasOwnItem(index);
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::GetItemQuery(Js::Var originalInstance, uint32 index, Js::Var* value, Js::ScriptContext * requestContext)
+{
+    if (InterceptGet(index, value, requestContext))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    return JsrtExternalObject::GetItemQuery(originalInstance, index, value, requestContext);
+}
+
+Js::PropertyQueryFlags JsrtInterceptorObject::GetItemReferenceQuery(Js::Var originalInstance, uint32 index, Js::Var* value, Js::ScriptContext * requestContext)
+{
+    if (InterceptGet(index, value, requestContext))
+    {
+        return Js::PropertyQueryFlags::Property_Found;
+    }
+
+    return JsrtExternalObject::GetItemReferenceQuery(originalInstance, index, value, requestContext);
+}
+
+Js::DescriptorFlags JsrtInterceptorObject::GetItemSetter(uint32 index, Js::Var* setterValue, Js::ScriptContext* requestContext)
+{
+    if (this->GetCallbacks()->set != nullptr)
+    {
+        return Js::None;
+    }
+
+    return JsrtExternalObject::GetItemSetter(index, setterValue, requestContext);
+}
+
+BOOL JsrtInterceptorObject::SetItem(uint32 index, Js::Var value, Js::PropertyOperationFlags flags)
+{
+    if (InterceptSet(index, value))
+    {
+        return TRUE;
+    }
+
+    return JsrtExternalObject::SetItem(index, value, flags);
+}
+
+BOOL JsrtInterceptorObject::DeleteItem(uint32 index, Js::PropertyOperationFlags flags)
+{
+    BOOL result;
+    if (InterceptDelete(index, &result))
+    {
+        return result;
+    }
+
+    return JsrtExternalObject::DeleteItem(index, flags);
+}
+
+BOOL JsrtInterceptorObject::IsWritable(Js::PropertyId propertyId)
+{
+    int attributes;
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptAttributes(propertyId, &attributes))
+    {
+        return (attributes & JsInterceptorPropertyAttributes_ReadOnly) == 0;
+    }
+
+    return JsrtExternalObject::IsWritable(propertyId);
+}
+
+BOOL JsrtInterceptorObject::IsConfigurable(Js::PropertyId propertyId)
+{
+    int attributes;
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptAttributes(propertyId, &attributes))
+    {
+        return (attributes & JsInterceptorPropertyAttributes_DontDelete) == 0;
+    }
+
+    return JsrtExternalObject::IsConfigurable(propertyId);
+}
+
+BOOL JsrtInterceptorObject::IsEnumerable(Js::PropertyId propertyId)
+{
+    int attributes;
+    if (!Js::IsInternalPropertyId(propertyId) && InterceptAttributes(propertyId, &attributes))
+    {
+        return (attributes & JsInterceptorPropertyAttributes_DontEnum) == 0;
+    }
+
+    return JsrtExternalObject::IsEnumerable(propertyId);
+}
+
+// Enumerates the keys returned by the ownKeys interceptor. It is used as the prefix
+// enumerator of the object, so the object's own properties follow the intercepted keys.
+class JsrtInterceptorKeysEnumerator : public Js::JavascriptEnumerator
+{
+protected:
+    DEFINE_VTABLE_CTOR_ABSTRACT(JsrtInterceptorKeysEnumerator, Js::JavascriptEnumerator)
+
+public:
+    JsrtInterceptorKeysEnumerator(Js::ScriptContext* scriptContext, JsrtInterceptorObject* object, Js::RecyclableObject* keys, Js::EnumeratorFlags flags)
+        : Js::JavascriptEnumerator(scriptContext), scriptContext(scriptContext), object(object), keys(keys), flags(flags), index(0)
+    {
+        this->length = Js::JavascriptConversion::ToUInt32(Js::JavascriptOperators::OP_GetLength(keys, scriptContext), scriptContext);
+    }
+
+    virtual void Reset() override
+    {
+        this->index = 0;
+    }
+
+    virtual Js::JavascriptString * MoveAndGetNext(Js::PropertyId& propertyId, Js::PropertyAttributes* attributes = nullptr) override
+    {
+        propertyId = Js::Constants::NoProperty;
+
+        while (this->index < this->length)
+        {
+            Js::Var key;
+            if (!Js::JavascriptOperators::GetItem(this->keys, this->index++, &key, this->scriptContext))
+            {
+                continue;
+            }
+
+            const Js::PropertyRecord * propertyRecord;
+            Js::JavascriptString * propertyName;
+            if (Js::JavascriptSymbol::Is(key))
+            {
+                if ((this->flags & Js::EnumeratorFlags::EnumSymbols) == Js::EnumeratorFlags::None)
+                {
+                    continue;
+                }
+
+                propertyRecord = Js::JavascriptSymbol::FromVar(key)->GetValue();
+                propertyName = this->scriptContext->GetPropertyString(propertyRecord->GetPropertyId());
+            }
+            else
+            {
+                propertyName = Js::JavascriptConversion::ToString(key, this->scriptContext);
+                this->scriptContext->GetOrAddPropertyRecord(propertyName, &propertyRecord);
+            }
+
+            BOOL isEnumerable = this->object->IsEnumerable(propertyRecord->GetPropertyId());
+            if (!isEnumerable && (this->flags & Js::EnumeratorFlags::EnumNonEnumerable) == Js::EnumeratorFlags::None)
+            {
+                continue;
+            }
+
+            propertyId = propertyRecord->GetPropertyId();
+            if (attributes != nullptr)
+            {
+                *attributes = isEnumerable ? PropertyEnumerable : PropertyNone;
+            }
+            return propertyName;
+        }
+
+        return nullptr;
+    }
+
+private:
+    FieldNoBarrier(Js::ScriptContext*) scriptContext;
+    Field(JsrtInterceptorObject*) object;
+    Field(Js::RecyclableObject*) keys;
+    Field(Js::EnumeratorFlags) flags;
+    Field(uint32) index;
+    Field(uint32) length;
+};
+
+BOOL JsrtInterceptorObject::GetEnumerator(Js::JavascriptStaticEnumerator * enumerator, Js::EnumeratorFlags flags, Js::ScriptContext * requestContext, Js::ForInCache * forInCache)
+{
+    const JsInterceptorCallbacks * callbacks = this->GetCallbacks();
+    JsValueRef keys = JS_INVALID_REFERENCE;
+
+    if (callbacks->ownKeys != nullptr && CanCallInterceptor(requestContext))
+    {
+        if (!InvokeInterceptor([&]() { return callbacks->ownKeys(this, &keys); }) ||
+            !Js::JavascriptOperators::IsObject(keys))
+        {
+            keys = JS_INVALID_REFERENCE;
+        }
+    }
+
+    Js::JavascriptEnumerator * keysEnumerator = nullptr;
+    if (keys != JS_INVALID_REFERENCE)
+    {
+        keysEnumerator = RecyclerNew(requestContext->GetRecycler(), JsrtInterceptorKeysEnumerator,
+            requestContext, this, Js::RecyclableObject::FromVar(keys), flags);
+    }
+
+    // The set of keys is owned by the host and can change between enumerations, so the
+    // type based for-in cache cannot be used.
+    return this->GetEnumeratorWithPrefix(keysEnumerator, enumerator, flags, requestContext, nullptr);
+}
+#endif // _CHAKRACOREBUILD
+
 #if ENABLE_TTD
 TTD::NSSnapObjects::SnapObjectType JsrtExternalObject::GetSnapTag_TTD() const
 {
@@ -4,7 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-#include "ChakraCommon.h"
+#include "ChakraCore.h"
 
 #define BEGIN_INTERCEPTOR(scriptContext) \
     BEGIN_LEAVE_SCRIPT(scriptContext) \
@@ -27,14 +27,26 @@
 class JsrtExternalType sealed : public Js::DynamicType
 {
 public:
-    JsrtExternalType(JsrtExternalType *type) : Js::DynamicType(type), jsFinalizeCallback(type->jsFinalizeCallback) {}
+    JsrtExternalType(JsrtExternalType *type) : Js::DynamicType(type), jsFinalizeCallback(type->jsFinalizeCallback)
+#ifdef _CHAKRACOREBUILD
+        , interceptorCallbacks(type->interceptorCallbacks)
+#endif
+    {}
     JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback);
 
     //Js::PropertyId GetNameId() const { return ((Js::PropertyRecord *)typeDescription.className)->GetPropertyId(); }
     JsFinalizeCallback GetJsFinalizeCallback() const { return this->jsFinalizeCallback; }
 
+#ifdef _CHAKRACOREBUILD
+    JsrtExternalType(Js::ScriptContext* scriptContext, JsFinalizeCallback finalizeCallback, const JsInterceptorCallbacks * interceptorCallbacks);
+    const JsInterceptorCallbacks * GetInterceptorCallbacks() const { return this->interceptorCallbacks; }
+#endif
+
 private:
     FieldNoBarrier(JsFinalizeCallback) jsFinalizeCallback;
+#ifdef _CHAKRACOREBUILD
+    FieldNoBarrier(const JsInterceptorCallbacks *) interceptorCallbacks;
+#endif
 };
 AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalType, &Js::Type::DumpObjectFunction);
 
@@ -74,3 +86,65 @@ class JsrtExternalObject : public Js::DynamicObject
 #endif
 };
 AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtExternalObject, &Js::RecyclableObject::DumpObjectFunction);
+
+#ifdef _CHAKRACOREBUILD
+// An external object whose property accesses are first offered to host callbacks
+// (see JsCreateInterceptorObject). Unintercepted accesses fall back to the regular
+// DynamicObject behavior. Nothing about these objects is ever inline cached, since
+// the host can change the answer for any key at any time.
+class JsrtInterceptorObject : public JsrtExternalObject
+{
+protected:
+    DEFINE_VTABLE_CTOR(JsrtInterceptorObject, JsrtExternalObject);
+    DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JsrtInterceptorObject);
+
+public:
+    JsrtInterceptorObject(JsrtExternalType * type, void *data);
+
+    static bool Is(Js::Var value);
+    static JsrtInterceptorObject * Create(void *data, JsFinalizeCallback finalizeCallback, const JsInterceptorCallbacks * callbacks, Js::RecyclableObject * prototype, Js::ScriptContext *scriptContext);
+
+    const JsInterceptorCallbacks * GetCallbacks() const { return this->GetExternalType()->GetInterceptorCallbacks(); }
+
+    virtual Js::PropertyQueryFlags HasPropertyQuery(Js::PropertyId propertyId) override;
+    virtual BOOL HasOwnProperty(Js::PropertyId propertyId) override;
+    virtual Js::PropertyQueryFlags GetPropertyQuery(Js::Var originalInstance, Js::PropertyId propertyId, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext) override;
+    virtual Js::PropertyQueryFlags GetPropertyQuery(Js::Var originalInstance, Js::JavascriptString* propertyNameString, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext) override;
+    virtual Js::PropertyQueryFlags GetPropertyReferenceQuery(Js::Var originalInstance, Js::PropertyId propertyId, Js::Var* value, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext) override;
+    virtual BOOL SetProperty(Js::PropertyId propertyId, Js::Var value, Js::PropertyOperationFlags flags, Js::PropertyValueInfo* info) override;
+    virtual BOOL SetProperty(Js::JavascriptString* propertyNameString, Js::Var value, Js::PropertyOperationFlags flags, Js::PropertyValueInfo* info) override;
+    virtual Js::DescriptorFlags GetSetter(Js::PropertyId propertyId, Js::Var *setterValue, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext) override;
+    virtual Js::DescriptorFlags GetSetter(Js::JavascriptString* propertyNameString, Js::Var *setterValue, Js::PropertyValueInfo* info, Js::ScriptContext* requestContext) override;
+    virtual BOOL DeleteProperty(Js::PropertyId propertyId, Js::PropertyOperationFlags flags) override;
+    virtual BOOL DeleteProperty(Js::JavascriptString *propertyNameString, Js::PropertyOperationFlags flags) override;
+
+    virtual Js::PropertyQueryFlags HasItemQuery(uint32 index) override;
+    virtual BOOL HasOwnItem(uint32 index) override;
+    virtual Js::PropertyQueryFlags GetItemQuery(Js::Var originalInstance, uint32 index, Js::Var* value, Js::ScriptContext * requestContext) override;
+    virtual Js::PropertyQueryFlags GetItemReferenceQuery(Js::Var originalInstance, uint32 index, Js::Var* value, Js::ScriptContext * requestContext) override;
+    virtual Js::DescriptorFlags GetItemSetter(uint32 index, Js::Var* setterValue, Js::ScriptContext* requestContext) override;
+    virtual BOOL SetItem(uint32 index, Js::Var value, Js::PropertyOperationFlags flags) override;
+    virtual BOOL DeleteItem(uint32 index, Js::PropertyOperationFlags flags) override;
+
+    virtual BOOL GetEnumerator(Js::JavascriptStaticEnumerator * enumerator, Js::EnumeratorFlags flags, Js::ScriptContext * requestContext, Js::ForInCache * forInCache = nullptr) override;
+
+    virtual BOOL IsWritable(Js::PropertyId propertyId) override;
+    virtual BOOL IsConfigurable(Js::PropertyId propertyId) override;
+    virtual BOOL IsEnumerable(Js::PropertyId propertyId) override;
+
+private:
+    Js::Var GetKey(Js::PropertyId propertyId) const;
+    Js::Var GetKey(Js::JavascriptString * propertyNameString) const;
+    Js::Var GetKey(uint32 index) const;
+    bool CanCallInterceptor(Js::ScriptContext * requestContext) const;
+
+    template <class Fn> bool InvokeInterceptor(Fn fn);
+    template <class TKey> bool InterceptGet(TKey key, Js::Var* value, Js::ScriptContext * requestContext);
+    template <class TKey> bool InterceptSet(TKey key, Js::Var value);
+    template <class TKey> bool InterceptQuery(TKey key, int* attributes);
+    template <class TKey> bool InterceptDelete(TKey key, BOOL* result);
+    template <class TKey> bool InterceptHas(TKey key);
+    template <class TKey> bool InterceptAttributes(TKey key, int* attributes);
+};
+AUTO_REGISTER_RECYCLER_OBJECT_DUMPER(JsrtInterceptorObject, &Js::RecyclableObject::DumpObjectFunction);
+#endif // _CHAKRACOREBUILD
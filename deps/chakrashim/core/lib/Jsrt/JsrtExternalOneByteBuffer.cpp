@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtExternalOneByteBuffer.h"
+
+namespace Js
+{
+    JsrtExternalOneByteBuffer::JsrtExternalOneByteBuffer()
+        : finalizeCallback(nullptr), callbackState(nullptr)
+    {
+    }
+
+    JsrtExternalOneByteBuffer* JsrtExternalOneByteBuffer::New(Recycler* recycler)
+    {
+        return RecyclerNewFinalized(recycler, JsrtExternalOneByteBuffer);
+    }
+
+    void JsrtExternalOneByteBuffer::SetFinalizeCallback(JsFinalizeCallback finalizeCallback, void *callbackState)
+    {
+        Assert(this->finalizeCallback == nullptr);
+        this->finalizeCallback = finalizeCallback;
+        this->callbackState = callbackState;
+    }
+
+    void JsrtExternalOneByteBuffer::Dispose(bool isShutdown)
+    {
+        // Called after sweeping rather than from Finalize, so that the host may call back into the
+        // runtime, e.g. to adjust the external memory usage
+        if (finalizeCallback != nullptr)
+        {
+            finalizeCallback(callbackState);
+        }
+    }
+}
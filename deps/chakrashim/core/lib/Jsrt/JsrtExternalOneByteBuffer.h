@@ -0,0 +1,25 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js {
+    class JsrtExternalOneByteBuffer sealed : public ExternalOneByteBuffer
+    {
+    private:
+        JsrtExternalOneByteBuffer();
+
+    public:
+        static JsrtExternalOneByteBuffer* New(Recycler* recycler);
+
+        // Set once the strings referencing the buffer have been created, so that the callback isn't
+        // called if creating them fails
+        void SetFinalizeCallback(JsFinalizeCallback finalizeCallback, void *callbackState);
+        void Dispose(bool isShutdown) override;
+
+    private:
+        FieldNoBarrier(JsFinalizeCallback) finalizeCallback;
+        Field(void *) callbackState;
+    };
+}
@@ -15,6 +15,9 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->gcCallback = NULL;
+    this->gcCallbackContext = NULL;
+    this->gcKind = JsGarbageCollectionKind_Full;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -85,38 +88,73 @@ void JsrtRuntime::CloseContexts()
 
 void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext)
 {
-    if (beforeCollectCallback != NULL)
+    this->beforeCollectCallback = beforeCollectCallback;
+    this->callbackContext = beforeCollectCallback != NULL ? callbackContext : NULL;
+    this->UpdateRecyclerCollectCallback();
+}
+
+void JsrtRuntime::SetGarbageCollectionCallback(JsGarbageCollectionCallback gcCallback, void * gcCallbackContext)
+{
+    this->gcCallback = gcCallback;
+    this->gcCallbackContext = gcCallback != NULL ? gcCallbackContext : NULL;
+    this->UpdateRecyclerCollectCallback();
+}
+
+// Both the before collect and the garbage collection callbacks are dispatched from a single
+// recycler collect callback, which is only registered while one of them is set.
+void JsrtRuntime::UpdateRecyclerCollectCallback()
+{
+    if (this->beforeCollectCallback != NULL || this->gcCallback != NULL)
     {
         if (this->collectCallback == NULL)
         {
             this->collectCallback = this->threadContext->AddRecyclerCollectCallBack(RecyclerCollectCallbackStatic, this);
         }
-
-        this->beforeCollectCallback = beforeCollectCallback;
-        this->callbackContext = callbackContext;
     }
-    else
+    else if (this->collectCallback != NULL)
     {
-        if (this->collectCallback != NULL)
-        {
-            this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
-            this->collectCallback = NULL;
-        }
-
-        this->beforeCollectCallback = NULL;
-        this->callbackContext = NULL;
+        this->threadContext->RemoveRecyclerCollectCallBack(this->collectCallback);
+        this->collectCallback = NULL;
     }
 }
 
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
+    JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+
     if (flags & Collect_Begin)
     {
-        JsrtRuntime * _this = reinterpret_cast<JsrtRuntime *>(context);
+        // Collect_Begin_Concurrent and Collect_Begin_Partial share the Collect_Begin bit
+        _this->gcKind = (JsGarbageCollectionKind)
+            (((flags & Collect_Begin_Partial) == Collect_Begin_Partial ? JsGarbageCollectionKind_Partial : 0) |
+             ((flags & Collect_Begin_Concurrent) == Collect_Begin_Concurrent ? JsGarbageCollectionKind_Concurrent : 0));
+        _this->gcBeginTime = Js::Tick::Now();
+
+        try
+        {
+            JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
+            if (_this->beforeCollectCallback != NULL)
+            {
+                _this->beforeCollectCallback(_this->callbackContext);
+            }
+            if (_this->gcCallback != NULL)
+            {
+                _this->gcCallback(JsGarbageCollectionEvent_Begin, _this->gcKind, 0, _this->gcCallbackContext);
+            }
+        }
+        catch (...)
+        {
+            AssertMsg(false, "Unexpected non-engine exception.");
+        }
+    }
+    else if ((flags & Collect_End) && _this->gcCallback != NULL)
+    {
+        const double durationInMilliseconds = (Js::Tick::Now() - _this->gcBeginTime).ToMicroseconds() / 1000.0;
+
         try
         {
             JsrtCallbackState scope(reinterpret_cast<ThreadContext*>(_this->GetThreadContext()));
-            _this->beforeCollectCallback(_this->callbackContext);
+            _this->gcCallback(JsGarbageCollectionEvent_End, _this->gcKind, durationInMilliseconds, _this->gcCallbackContext);
         }
         catch (...)
         {
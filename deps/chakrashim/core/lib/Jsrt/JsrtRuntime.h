@@ -38,6 +38,7 @@ class JsrtRuntime
 
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
+    void SetGarbageCollectionCallback(JsGarbageCollectionCallback gcCallback, void * gcCallbackContext);
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
@@ -58,6 +59,7 @@ class JsrtRuntime
 
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
+    void UpdateRecyclerCollectCallback();
 
 private:
     ThreadContext * threadContext;
@@ -65,6 +67,10 @@ class JsrtRuntime
     JsrtContext * contextList;
     ThreadContext::CollectCallBack * collectCallback;
     JsBeforeCollectCallback beforeCollectCallback;
+    JsGarbageCollectionCallback gcCallback;
+    void * gcCallbackContext;
+    JsGarbageCollectionKind gcKind;
+    Js::Tick gcBeginTime;
     JsrtThreadService threadService;
     void * callbackContext;
     bool useIdle;
@@ -292,6 +292,11 @@ namespace Js
     template <>
     void JsrtSourceHolder<JsSerializedLoadScriptCallback, JsSerializedScriptUnloadCallback>::Finalize(bool isShutdown)
     {
+        if (scriptUnloadCallback != nullptr)
+        {
+            scriptUnloadCallback(sourceContext);
+        }
+
         if (this->mappedSource != nullptr)
         {
             JsrtSourceHolderPolicy<JsSerializedLoadScriptCallback>::FreeMappedSource(
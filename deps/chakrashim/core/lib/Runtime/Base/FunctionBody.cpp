@@ -4955,7 +4955,7 @@ namespace Js
                 sourceContextInfo->sourceDynamicProfileManager->RemoveDynamicProfileInfo(GetFunctionInfo()->GetLocalFunctionId());
             }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
             DynamicProfileInfoList * profileInfoList = GetScriptContext()->GetProfileInfoList();
             if (profileInfoList)
             {
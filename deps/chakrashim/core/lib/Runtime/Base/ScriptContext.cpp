@@ -24,6 +24,9 @@
 
 #include "Language/InterpreterStackFrame.h"
 #include "Language/SourceDynamicProfileManager.h"
+#ifdef ENABLE_PROFILE_CACHE
+#include "Language/ProfileCache.h"
+#endif
 #include "Language/JavascriptStackWalker.h"
 #include "Language/AsmJsTypes.h"
 #include "Language/AsmJsModule.h"
@@ -1251,7 +1254,7 @@ namespace Js
     {
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         if (DynamicProfileInfo::NeedProfileInfoList())
         {
             this->Cache()->profileInfoList = RecyclerNew(this->GetRecycler(), DynamicProfileInfoList);
@@ -1448,7 +1451,19 @@ namespace Js
                 }
 #endif
 
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#ifdef ENABLE_PROFILE_CACHE
+                if (ProfileCache::IsEnabled())
+                {
+                    HRESULT hrProfileCache = S_OK;
+                    BEGIN_TRANSLATE_OOM_TO_HRESULT_NESTED
+                    {
+                        ProfileCache::Save(this);
+                    }
+                    END_TRANSLATE_OOM_TO_HRESULT(hrProfileCache);
+                }
+#endif
+
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
                 this->ClearDynamicProfileList();
 #endif
 #endif
@@ -3434,7 +3449,7 @@ namespace Js
         }
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         // Reset the dynamic profile list
         if (this->Cache()->profileInfoList)
         {
@@ -5229,7 +5244,7 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
                 dynamicProfileInfo = newDynamicProfileInfo;
             }
             Assert(functionBody->GetInterpretedCount() == 0);
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
 
             if (this->Cache()->profileInfoList)
             {
@@ -1093,7 +1093,7 @@ namespace Js
 #endif
 
 #if ENABLE_PROFILE_INFO
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         void ClearDynamicProfileList()
         {
             if (this->Cache()->profileInfoList)
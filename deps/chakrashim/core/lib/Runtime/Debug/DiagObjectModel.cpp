@@ -16,7 +16,7 @@
 #include "Library/BoundFunction.h"
 #include "Library/JavascriptRegExpConstructor.h"
 #include "Library/SameValueComparer.h"
-#include "Library/MapOrSetDataList.h"
+#include "Library/MapOrSetData.h"
 #include "Library/JavascriptPromise.h"
 #include "Library/JavascriptProxy.h"
 #include "Library/JavascriptMap.h"
@@ -7,7 +7,7 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
@@ -20,7 +20,7 @@ namespace Js
         size_t size;
     };
 
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
     bool DynamicProfileInfo::NeedProfileInfoList()
     {
 #pragma prefast(suppress: 6235 6286, "(<non-zero constant> || <expression>) is always a non-zero constant. - This is wrong, DBG_DUMP is not set in some build variants")
@@ -28,6 +28,9 @@ namespace Js
 #ifdef DYNAMIC_PROFILE_STORAGE
             || DynamicProfileStorage::IsEnabled()
 #endif
+#ifdef ENABLE_PROFILE_CACHE
+            || ProfileCache::IsEnabled()
+#endif
 #ifdef RUNTIME_DATA_COLLECTION
             || (Configuration::Global.flags.RuntimeDataOutputFile != nullptr)
 #endif
@@ -94,7 +97,7 @@ namespace Js
         }
         else
         {
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
             if (DynamicProfileInfo::NeedProfileInfoList())
             {
                 info = RecyclerNewPlusZ(recycler, totalAlloc, DynamicProfileInfo, functionBody);
@@ -123,7 +126,7 @@ namespace Js
     }
 
     DynamicProfileInfo::DynamicProfileInfo(FunctionBody * functionBody)
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         : functionBody(DynamicProfileInfo::NeedProfileInfoList() ? functionBody : nullptr)
 #endif
     {
@@ -426,7 +429,7 @@ namespace Js
             return;
         }
         
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         // If we persistsAcrossScriptContext, the dynamic profile info may be referred to by multiple function body from
         // different script context
         Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == callerBody);
@@ -507,7 +510,7 @@ namespace Js
 
     void DynamicProfileInfo::RecordCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, FunctionInfo* calleeFunctionInfo, JavascriptFunction* calleeFunction, uint actualArgCount, bool isConstructorCall, InlineCacheIndex ldFldInlineCacheId)
     {
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         // If we persistsAcrossScriptContext, the dynamic profile info may be referred to by multiple function body from
         // different script context
         Assert(!DynamicProfileInfo::NeedProfileInfoList() || this->persistsAcrossScriptContexts || this->functionBody == functionBody);
@@ -1250,7 +1253,7 @@ namespace Js
             return false;
         }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         this->functionBody = functionBody;
 #endif
 
@@ -1863,7 +1866,7 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
 #if DBG_DUMP
     void BufferWriter::Log(DynamicProfileInfo* info)
     {
@@ -2176,6 +2179,24 @@ namespace Js
         return nullptr;
     }
 
+#ifdef ENABLE_PROFILE_CACHE
+    // Call targets in other files are recorded by host source context, which only identifies a file in the process
+    // that recorded it. Treat those call sites as having mixed targets in a profile loaded from another process.
+    void DynamicProfileInfo::ResetCrossFileCallSiteInfo()
+    {
+        for (ProfileId i = 0; i < dynamicProfileFunctionInfo->callSiteInfoCount; i++)
+        {
+            Assert(!callSiteInfo[i].isPolymorphic);
+            Js::SourceId sourceId = callSiteInfo[i].u.functionData.sourceId;
+            if (sourceId != NoSourceId && sourceId != BuiltInSourceId && sourceId != CurrentSourceId
+                && sourceId != InvalidSourceId && sourceId != JsBuiltInSourceId)
+            {
+                ResetPolymorphicCallSiteInfo(i, CallSiteMixed);
+            }
+        }
+    }
+#endif
+
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
     template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
@@ -345,7 +345,7 @@ namespace Js
 
         static Var EnsureDynamicProfileInfoThunk(RecyclableObject * function, CallInfo callInfo, ...);
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         bool HasFunctionBody() const { return hasFunctionBody; }
         FunctionBody * GetFunctionBody() const { Assert(hasFunctionBody); return functionBody; }
 #endif
@@ -447,7 +447,7 @@ namespace Js
 #ifdef RUNTIME_DATA_COLLECTION
         static void DumpScriptContextToFile(ScriptContext * scriptContext);
 #endif
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         static bool NeedProfileInfoList();
 #endif
 #ifdef DYNAMIC_PROFILE_MUTATOR
@@ -571,10 +571,10 @@ namespace Js
         template <typename T>
         static void WriteArray(uint count, WriteBarrierPtr<T> arr, FILE * file);
 #endif
-#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
+#if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION) || defined(ENABLE_PROFILE_CACHE)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         // Used by de-serialize
         DynamicProfileInfo();
 
@@ -584,6 +584,9 @@ namespace Js
         bool Serialize(T * writer);
 
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
+#endif
+#ifdef ENABLE_PROFILE_CACHE
+        void ResetCrossFileCallSiteInfo();
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
         static Js::LocalFunctionId const CallSiteCrossContext = (Js::LocalFunctionId)-2;
@@ -602,6 +605,9 @@ namespace Js
         DynamicProfileInfo(FunctionBody * functionBody);
 
         friend class SourceDynamicProfileManager;
+#ifdef ENABLE_PROFILE_CACHE
+        friend class ProfileCache;
+#endif
 
     public:
         bool IsAggressiveIntTypeSpecDisabled(const bool isJitLoopBody) const
@@ -855,7 +861,7 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
     class BufferReader
     {
     public:
@@ -0,0 +1,325 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#ifdef ENABLE_PROFILE_CACHE
+namespace Js
+{
+    char16 * ProfileCache::directory = nullptr;
+    size_t ProfileCache::directoryLength = 0;
+    DWORD const ProfileCache::MagicNumber = 20180117;
+    DWORD const ProfileCache::FileFormatVersion = 1;
+
+    // Separator, 16 hex digits, ".profile", and ".<process id>.tmp" for temporary files
+    static size_t const FilenameExtraLength = 48;
+
+#ifdef _WIN32
+    static char16 const PathSeparator[] = _u("\\");
+#else
+    static char16 const PathSeparator[] = _u("/");
+#endif
+
+    bool ProfileCache::SetDirectory(__in_z_opt char16 const * newDirectory)
+    {
+        if (directory != nullptr)
+        {
+            HeapDeleteArray(directoryLength + 1, directory);
+            directory = nullptr;
+            directoryLength = 0;
+        }
+
+        if (newDirectory == nullptr || newDirectory[0] == _u('\0'))
+        {
+            return true;
+        }
+
+        size_t length = wcslen(newDirectory);
+        while (length > 1 && (newDirectory[length - 1] == _u('/') || newDirectory[length - 1] == PathSeparator[0]))
+        {
+            length--;
+        }
+
+        char16 * copy = HeapNewNoThrowArray(char16, length + 1);
+        if (copy == nullptr)
+        {
+            return false;
+        }
+        js_wmemcpy_s(copy, length + 1, newDirectory, length);
+        copy[length] = _u('\0');
+
+        directory = copy;
+        directoryLength = length;
+        return true;
+    }
+
+    uint64 ProfileCache::Hash(__in_bcount(length) byte const * buffer, size_t length, uint64 hash)
+    {
+        // 64-bit FNV-1a
+        for (size_t i = 0; i < length; i++)
+        {
+            hash = (hash ^ buffer[i]) * FnvPrime;
+        }
+        return hash;
+    }
+
+    char16 * ProfileCache::GetFilename(uint64 sourceHash, bool isTemporary)
+    {
+        size_t const filenameLength = directoryLength + FilenameExtraLength;
+        char16 * filename = HeapNewNoThrowArray(char16, filenameLength);
+        if (filename == nullptr)
+        {
+            return nullptr;
+        }
+
+        uint32 high = (uint32)(sourceHash >> 32);
+        uint32 low = (uint32)sourceHash;
+        int written = isTemporary ?
+            swprintf_s(filename, filenameLength, _u("%s%s%08x%08x.profile.%u.tmp"), directory, PathSeparator, high, low, GetCurrentProcessId()) :
+            swprintf_s(filename, filenameLength, _u("%s%s%08x%08x.profile"), directory, PathSeparator, high, low);
+        if (written < 0)
+        {
+            HeapDeleteArray(filenameLength, filename);
+            return nullptr;
+        }
+        return filename;
+    }
+
+    void ProfileCache::DeleteFilename(__in_z char16 * filename)
+    {
+        HeapDeleteArray(directoryLength + FilenameExtraLength, filename);
+    }
+
+    void ProfileCache::InitializeHeader(FileHeader * header, uint64 sourceHash)
+    {
+        memset(header, 0, sizeof(FileHeader));
+        header->magic = MagicNumber;
+        header->formatVersion = FileFormatVersion;
+        header->pointerSize = sizeof(void *);
+        header->sourceHash = sourceHash;
+
+        // Profiles are saved as raw structures, so they can only be loaded by the build that saved them. The
+        // file version isn't available on every platform, but the build date and time hashes always are.
+        DWORD majorVersion, minorVersion;
+        AutoSystemInfo::GetJscriptFileVersion(&majorVersion, &minorVersion, &header->buildDateHash, &header->buildTimeHash);
+    }
+
+    void ProfileCache::Load(SourceContextInfo * sourceContextInfo, __in_bcount(length) byte const * source, size_t length, bool isUtf8)
+    {
+        Assert(IsEnabled());
+
+        SourceDynamicProfileManager * manager = sourceContextInfo->sourceDynamicProfileManager;
+        if (manager == nullptr || sourceContextInfo->IsDynamic())
+        {
+            return;
+        }
+
+        // Key on the raw bytes; the same text in the other encoding gets a file of its own.
+        byte const encoding = isUtf8 ? 1 : 2;
+        uint64 sourceHash = Hash(source, length);
+        sourceHash = Hash((byte const *)&length, sizeof(length), sourceHash);
+        sourceHash = Hash(&encoding, sizeof(encoding), sourceHash);
+
+        manager->hasProfileCacheKey = true;
+        manager->profileCacheKey = sourceHash;
+
+        FileHeader expectedHeader;
+        InitializeHeader(&expectedHeader, sourceHash);
+
+        char16 * filename = GetFilename(sourceHash, false);
+        if (filename == nullptr)
+        {
+            return;
+        }
+
+        FILE * file = nullptr;
+        errno_t err = _wfopen_s(&file, filename, _u("rb"));
+        DeleteFilename(filename);
+        if (err != 0 || file == nullptr)
+        {
+            // Nothing saved for this script yet
+            return;
+        }
+
+        FileHeader header;
+        char * data = nullptr;
+        size_t dataSize = 0;
+        if (fread(&header, sizeof(header), 1, file) == 1
+            && memcmp(&header, &expectedHeader, offsetof(FileHeader, dataSize)) == 0
+            && header.dataSize <= UINT_MAX)
+        {
+            dataSize = (size_t)header.dataSize;
+            data = HeapNewNoThrowArray(char, dataSize);
+            if (data != nullptr
+                && (fread(data, 1, dataSize, file) != dataSize || Hash((byte const *)data, dataSize) != header.dataHash))
+            {
+                HeapDeleteArray(dataSize, data);
+                data = nullptr;
+            }
+        }
+        fclose(file);
+
+        if (data == nullptr)
+        {
+            // Stale or damaged; it is replaced when the profile is saved again.
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache: discarded stale profile for %s\n"), sourceContextInfo->url);
+            return;
+        }
+
+        AutoArrayPtr<char> autoData(data, dataSize);
+        BufferReader reader(data, dataSize);
+        Recycler * recycler = manager->GetRecycler();
+
+        uint hotFunctionCount;
+        if (!reader.Read(&hotFunctionCount))
+        {
+            return;
+        }
+        BVFixed * hotFunctions = BVFixed::New(hotFunctionCount, recycler);
+        if (!reader.ReadArray(hotFunctions->GetData(), hotFunctions->WordCount()))
+        {
+            return;
+        }
+
+        SourceDynamicProfileManager * cachedManager = SourceDynamicProfileManager::Deserialize(&reader, recycler);
+        if (cachedManager == nullptr)
+        {
+            return;
+        }
+
+        cachedManager->dynamicProfileInfoMap.Map([](LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo)
+        {
+            dynamicProfileInfo->ResetCrossFileCallSiteInfo();
+        });
+        cachedManager->cachedHotFunctions = hotFunctions;
+        cachedManager->hasProfileCacheKey = true;
+        cachedManager->profileCacheKey = sourceHash;
+        sourceContextInfo->sourceDynamicProfileManager = cachedManager;
+
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache: loaded %d function profiles for %s\n"),
+            cachedManager->dynamicProfileInfoMap.Count(), sourceContextInfo->url);
+    }
+
+    void ProfileCache::Save(ScriptContext * scriptContext)
+    {
+        if (!IsEnabled() || scriptContext->GetSourceContextInfoMap() == nullptr)
+        {
+            return;
+        }
+
+        DynamicProfileInfo::UpdateSourceDynamicProfileManagers(scriptContext);
+
+        scriptContext->GetSourceContextInfoMap()->Map([&](DWORD_PTR dwHostSourceContext, SourceContextInfo * sourceContextInfo)
+        {
+            SourceDynamicProfileManager * manager = sourceContextInfo->sourceDynamicProfileManager;
+            if (manager != nullptr)
+            {
+                if (manager->hasProfileCacheKey && !Save(manager))
+                {
+                    OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile cache: saving FAILED for %s\n"), sourceContextInfo->url);
+                }
+                manager->ClearSavingData();
+            }
+        });
+    }
+
+    BVFixed * ProfileCache::GetHotFunctions(SourceDynamicProfileManager * manager)
+    {
+        BVFixed * hotFunctions = BVFixed::New(manager->startupFunctions->Length(), manager->GetRecycler());
+        manager->dynamicProfileInfoMapSaving.Map([&](LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo)
+        {
+            if (dynamicProfileInfo != nullptr && dynamicProfileInfo->HasFunctionBody() && functionId < hotFunctions->Length()
+                && dynamicProfileInfo->GetFunctionBody()->GetExecutionMode() == ExecutionMode::FullJit)
+            {
+                hotFunctions->Set(functionId);
+            }
+        });
+        return hotFunctions;
+    }
+
+    bool ProfileCache::Save(SourceDynamicProfileManager * manager)
+    {
+        if (manager->startupFunctions == nullptr && manager->cachedStartupFunctions == nullptr)
+        {
+            // The script never ran
+            return true;
+        }
+
+        // Counting also merges the startup functions loaded from the cache into the ones of this run.
+        BufferSizeCounter counter;
+        if (!manager->Serialize(&counter))
+        {
+            return false;
+        }
+
+        BVFixed * hotFunctions = GetHotFunctions(manager);
+        size_t dataSize = sizeof(uint) + sizeof(BVUnit) * hotFunctions->WordCount() + counter.GetByteCount();
+        if (dataSize > UINT_MAX)
+        {
+            return false;
+        }
+
+        char * data = HeapNewNoThrowArray(char, dataSize);
+        if (data == nullptr)
+        {
+            return false;
+        }
+        AutoArrayPtr<char> autoData(data, dataSize);
+
+        BufferWriter writer(data, dataSize);
+        if (!writer.Write(hotFunctions->Length())
+            || !writer.WriteArray(hotFunctions->GetData(), hotFunctions->WordCount())
+            || !manager->Serialize(&writer))
+        {
+            return false;
+        }
+
+        FileHeader header;
+        InitializeHeader(&header, manager->profileCacheKey);
+        header.dataSize = dataSize;
+        header.dataHash = Hash((byte const *)data, dataSize);
+
+        // Write to a file of our own and rename it over the old one, so a process loading the profile never
+        // sees a partly written file.
+        char16 * temporaryFilename = GetFilename(manager->profileCacheKey, true);
+        if (temporaryFilename == nullptr)
+        {
+            return false;
+        }
+        char16 * filename = GetFilename(manager->profileCacheKey, false);
+        if (filename == nullptr)
+        {
+            DeleteFilename(temporaryFilename);
+            return false;
+        }
+
+        bool saved = WriteFile(temporaryFilename, header, data, dataSize);
+        if (saved)
+        {
+            saved = MoveFileEx(temporaryFilename, filename, MOVEFILE_REPLACE_EXISTING) != FALSE;
+        }
+        if (!saved)
+        {
+            _wunlink(temporaryFilename);
+        }
+
+        DeleteFilename(filename);
+        DeleteFilename(temporaryFilename);
+        return saved;
+    }
+
+    bool ProfileCache::WriteFile(__in_z char16 const * filename, FileHeader const& header, __in_bcount(dataSize) char const * data, size_t dataSize)
+    {
+        FILE * file = nullptr;
+        if (_wfopen_s(&file, filename, _u("wb")) != 0 || file == nullptr)
+        {
+            return false;
+        }
+
+        bool written = fwrite(&header, sizeof(header), 1, file) == 1
+            && fwrite(data, 1, dataSize, file) == dataSize;
+        return fclose(file) == 0 && written;
+    }
+};
+#endif
@@ -0,0 +1,60 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef ENABLE_PROFILE_CACHE
+namespace Js
+{
+    //
+    // Persists the dynamic profiles of scripts in a directory, so a later process running the same script
+    // starts with the type feedback of the previous run instead of collecting it again.
+    //
+    // Each script has one file, named after a hash of its source text. The file is only used if the
+    // source, the engine build and the pointer size all match, and every function profile is checked
+    // against its function body again when it is loaded. Functions that were full JIT'd when the file was
+    // saved are queued for full JIT as soon as their byte code is generated.
+    //
+    class ProfileCache
+    {
+    public:
+        // Must be called before any script context is created. Pass nullptr to disable the cache.
+        static bool SetDirectory(__in_z_opt char16 const * directory);
+        static bool IsEnabled() { return directory != nullptr; }
+
+        static void Load(SourceContextInfo * sourceContextInfo, __in_bcount(length) byte const * source, size_t length, bool isUtf8);
+        static void Save(ScriptContext * scriptContext);
+
+    private:
+        struct FileHeader
+        {
+            DWORD magic;
+            DWORD formatVersion;
+            DWORD buildDateHash;
+            DWORD buildTimeHash;
+            DWORD pointerSize;
+            DWORD reserved;
+            uint64 sourceHash;
+            uint64 dataSize;
+            uint64 dataHash;
+        };
+
+        static void InitializeHeader(FileHeader * header, uint64 sourceHash);
+        static bool Save(SourceDynamicProfileManager * manager);
+        static BVFixed * GetHotFunctions(SourceDynamicProfileManager * manager);
+        static bool WriteFile(__in_z char16 const * filename, FileHeader const& header, __in_bcount(dataSize) char const * data, size_t dataSize);
+        static char16 * GetFilename(uint64 sourceHash, bool isTemporary);
+        static void DeleteFilename(__in_z char16 * filename);
+        static uint64 Hash(__in_bcount(length) byte const * buffer, size_t length, uint64 hash = FnvOffsetBasis);
+
+        static char16 * directory;
+        static size_t directoryLength;
+
+        static DWORD const MagicNumber;
+        static DWORD const FileFormatVersion;
+        static uint64 const FnvOffsetBasis = 14695981039346656037ull;
+        static uint64 const FnvPrime = 1099511628211ull;
+    };
+};
+#endif
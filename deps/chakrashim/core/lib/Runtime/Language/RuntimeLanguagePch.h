@@ -26,6 +26,9 @@
 #include "Language/DynamicProfileStorage.h"
 #endif
 #include "Language/SourceDynamicProfileManager.h"
+#ifdef ENABLE_PROFILE_CACHE
+#include "Language/ProfileCache.h"
+#endif
 
 #include "Base/EtwTrace.h"
 
@@ -20,6 +20,14 @@ namespace Js
         return (ExecutionFlags)cachedStartupFunctions->Test(functionId);
     }
 
+#ifdef ENABLE_PROFILE_CACHE
+    bool
+    SourceDynamicProfileManager::IsFunctionHot(Js::LocalFunctionId functionId) const
+    {
+        return cachedHotFunctions != nullptr && functionId < cachedHotFunctions->Length() && cachedHotFunctions->Test(functionId);
+    }
+#endif
+
     DynamicProfileInfo *
     SourceDynamicProfileManager::GetDynamicProfileInfo(FunctionBody * functionBody)
     {
@@ -55,7 +63,7 @@ namespace Js
     void SourceDynamicProfileManager::RemoveDynamicProfileInfo(LocalFunctionId functionId)
     {
         dynamicProfileInfoMap.Remove(functionId);
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         dynamicProfileInfoMapSaving.Remove(functionId);
 #endif
     }
@@ -331,7 +339,7 @@ namespace Js
         return manager;
     }
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
     void SourceDynamicProfileManager::ClearSavingData()
     {
         dynamicProfileInfoMapSaving.Reset();
@@ -466,6 +474,7 @@ namespace Js
         return true;
     }
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void
     SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
     {
@@ -499,7 +508,12 @@ namespace Js
 
         DynamicProfileStorage::SaveRecord(url, record);
     }
+#endif
 
+    // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
+    template SourceDynamicProfileManager * SourceDynamicProfileManager::Deserialize<BufferReader>(BufferReader*, Recycler*);
+    template bool SourceDynamicProfileManager::Serialize<BufferSizeCounter>(BufferSizeCounter*);
+    template bool SourceDynamicProfileManager::Serialize<BufferWriter>(BufferWriter*);
 #endif
 };
 #endif
@@ -18,14 +18,18 @@ namespace Js
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
     // It uses the WININET cache to save/load profile data.
     // For testing scenarios enabled using DYNAMIC_PROFILE_STORAGE macro, this can persist the profile info into a file as well.
+    // With ENABLE_PROFILE_CACHE, ProfileCache persists it in a directory keyed by the script source.
     class SourceDynamicProfileManager
     {
     public:
         SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator),
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
             dynamicProfileInfoMapSaving(&HeapAllocator::Instance),
 #endif
             dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr) 
+#ifdef ENABLE_PROFILE_CACHE
+            , cachedHotFunctions(nullptr), hasProfileCacheKey(false), profileCacheKey(0)
+#endif
         {
         }
 
@@ -44,21 +48,29 @@ namespace Js
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef ENABLE_PROFILE_CACHE
+        bool IsFunctionHot(Js::LocalFunctionId functionId) const;
+#endif
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         void ClearSavingData();
         void CopySavingData();
 #endif
 
     private:
         friend class DynamicProfileInfo;
+#ifdef ENABLE_PROFILE_CACHE
+        friend class ProfileCache;
+#endif
         FieldNoBarrier(Recycler*) recycler;
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#if defined(DYNAMIC_PROFILE_STORAGE) || defined(ENABLE_PROFILE_CACHE)
         typedef JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, HeapAllocator> DynamicProfileInfoMapSavingType;
         FieldNoBarrier(DynamicProfileInfoMapSavingType) dynamicProfileInfoMapSaving;
         
         void SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo);
+#ifdef DYNAMIC_PROFILE_STORAGE
         void SaveToDynamicProfileStorage(char16 const * url);
+#endif
         void AddItem(LocalFunctionId functionId, DynamicProfileInfo *info);
         template <typename T>
         static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
@@ -77,6 +89,11 @@ namespace Js
                                                             // It's not modified but used as an input for deferred parsing/bytecodegen
         typedef JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy>  DynamicProfileInfoMapType;
         Field(DynamicProfileInfoMapType) dynamicProfileInfoMap;
+#ifdef ENABLE_PROFILE_CACHE
+        Field(BVFixed const *) cachedHotFunctions;          // Bit vector representing functions that were full JIT'd when the profile cache was saved
+        Field(bool) hasProfileCacheKey;                     // Indicates if this script is saved to the profile cache
+        Field(uint64) profileCacheKey;                      // Hash of the script source naming its profile cache file
+#endif
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
 
@@ -218,6 +218,12 @@ namespace Js
     {
         Assert(!this->isDetached);
 
+        if (this->OwnsBuffer())
+        {
+            // The buffer now belongs to the detached state or to a new array buffer
+            this->GetRecycler()->SubtractArrayBufferMemoryUsage(this->bufferLength);
+        }
+
         this->buffer = nullptr;
         this->bufferLength = 0;
         this->isDetached = true;
@@ -688,6 +694,7 @@ namespace Js
         JavascriptArrayBuffer* result = RecyclerNewFinalized(recycler, JavascriptArrayBuffer, length, type);
         Assert(result);
         recycler->AddExternalMemoryUsage(length);
+        recycler->AddArrayBufferMemoryUsage(result->GetByteLength());
         return result;
     }
 
@@ -697,6 +704,7 @@ namespace Js
         JavascriptArrayBuffer* result = RecyclerNewFinalized(recycler, JavascriptArrayBuffer, buffer, length, type);
         Assert(result);
         recycler->AddExternalMemoryUsage(length);
+        recycler->AddArrayBufferMemoryUsage(result->GetByteLength());
         return result;
     }
 
@@ -794,6 +802,7 @@ namespace Js
 #endif
         Recycler* recycler = GetType()->GetLibrary()->GetRecycler();
         recycler->ReportExternalMemoryFree(bufferLength);
+        recycler->SubtractArrayBufferMemoryUsage(bufferLength);
 
         buffer = nullptr;
         bufferLength = 0;
@@ -902,6 +911,7 @@ namespace Js
             recycler->AddExternalMemoryUsage(length);
         }
         Assert(result);
+        recycler->AddArrayBufferMemoryUsage(result->GetByteLength());
         return result;
     }
 
@@ -185,6 +185,9 @@ namespace Js
     protected:
         void Detach();
 
+        // Whether the buffer is allocated and freed by this object, and counted as external memory
+        virtual bool OwnsBuffer() const { return false; }
+
         typedef void __cdecl FreeFn(void* ptr);
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) = 0;
 
@@ -258,6 +261,7 @@ namespace Js
     protected:
         JavascriptArrayBuffer(DynamicType * type);
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(BYTE* buffer, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) override;
+        virtual bool OwnsBuffer() const override { return true; }
 
         template<typename Allocator>
         JavascriptArrayBuffer(uint32 length, DynamicType * type, Allocator allocator): ArrayBuffer(length, type, allocator){}
@@ -55,7 +55,7 @@ namespace JSON
     Js::Var Parse(Js::JavascriptString* input, Js::RecyclableObject* reviver, Js::ScriptContext* scriptContext)
     {
         // alignment required because of the union in JSONParser::m_token
-        __declspec (align(8)) JSONParser parser(scriptContext, reviver);
+        __declspec (align(8)) JSONParser<char16> parser(scriptContext, reviver);
         Js::Var result = NULL;
 
         TryFinally([&]()
@@ -69,7 +69,7 @@ namespace JSON
             }
             if (result == nullptr)
             {
-                result = parser.Parse(input);
+                result = parser.Parse(input->GetSz(), input->GetLength());
             }
 
     #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -97,6 +97,24 @@ namespace JSON
         return result;
     }
 
+    Js::Var ParseUtf8(const utf8char_t* input, uint length, Js::ScriptContext* scriptContext)
+    {
+        // alignment required because of the union in JSONParser::m_token
+        __declspec (align(8)) JSONParser<utf8char_t> parser(scriptContext, nullptr);
+        Js::Var result = NULL;
+
+        TryFinally([&]()
+        {
+            result = parser.Parse(input, length);
+        },
+            [&](bool/*hasException*/)
+        {
+            parser.Finalizer();
+        });
+
+        return result;
+    }
+
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -145,4 +163,29 @@ namespace JSON
         return lazy;
     }
 
+    Js::JSONUtf8Reader* CreateUtf8Reader(Js::Var value, Js::Var space, Js::ScriptContext* scriptContext)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        // All script (toJSON, getters, proxy traps) runs while the metadata is read, so nothing has been
+        // encoded yet if it throws
+        LazyJSONString* lazy = JSONStringifier::Stringify(scriptContext, value, nullptr, space);
+        if (!lazy)
+        {
+            return nullptr;
+        }
+
+        return HeapNew(Js::JSONUtf8Reader, scriptContext, lazy);
+    }
+
+    size_t ReadUtf8(Js::JSONUtf8Reader* reader, utf8char_t* buffer, size_t size)
+    {
+        return reader->Read(buffer, size);
+    }
+
+    void DeleteUtf8Reader(Js::JSONUtf8Reader* reader)
+    {
+        HeapDelete(reader);
+    }
+
 } // namespace JSON
@@ -4,6 +4,11 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
+namespace Js
+{
+    class JSONUtf8Reader;
+}
+
 namespace JSON
 {
     class EntryInfo
@@ -15,4 +20,22 @@ namespace JSON
 
     Js::Var Stringify(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
     Js::Var Parse(Js::RecyclableObject* function, Js::CallInfo callInfo, ...);
+
+    // Smallest buffer that is guaranteed to hold any code point
+    const size_t MinUtf8ChunkSize = 4;
+
+    // Stringifies value as JSON.stringify(value, undefined, space) would and returns a reader for the UTF-8 encoding
+    // of the result, or nullptr when the result would be undefined. All script runs before this returns; the text
+    // itself is only encoded as it is read, without creating the result string.
+    Js::JSONUtf8Reader* CreateUtf8Reader(Js::Var value, Js::Var space, Js::ScriptContext* scriptContext);
+
+    // Encodes the next part of the text into buffer, which must be at least MinUtf8ChunkSize bytes. Returns the number
+    // of bytes written, which is only 0 once the whole text has been read.
+    size_t ReadUtf8(Js::JSONUtf8Reader* reader, utf8char_t* buffer, size_t size);
+
+    void DeleteUtf8Reader(Js::JSONUtf8Reader* reader);
+
+    // Parses UTF-8 JSON text as JSON.parse would parse the string it decodes to, without creating that string.
+    // The input doesn't have to be null terminated.
+    Js::Var ParseUtf8(const utf8char_t* input, uint length, Js::ScriptContext* scriptContext);
 } // namespace JSON
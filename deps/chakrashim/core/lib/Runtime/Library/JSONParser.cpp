@@ -12,7 +12,8 @@ using namespace Js;
 namespace JSON
 {
     // -------- Parser implementation ------------//
-    void JSONParser::Finalizer()
+    template <typename EncodedChar>
+    void JSONParser<EncodedChar>::Finalizer()
     {
         m_scanner.Finalizer();
         if(arenaAllocatorObject)
@@ -21,7 +22,8 @@ namespace JSON
         }
     }
 
-    Js::Var JSONParser::Parse(LPCWSTR str, uint length)
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::Parse(const EncodedChar* str, uint length)
     {
         if (length > MIN_CACHE_LENGTH)
         {
@@ -41,12 +43,8 @@ namespace JSON
         return ret;
     }
 
-    Js::Var JSONParser::Parse(Js::JavascriptString* input)
-    {
-        return Parse(input->GetSz(), input->GetLength());
-    }
-
-    Js::Var JSONParser::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index)
     {
         AssertMsg(reviver, "JSON post parse walk with null reviver");
         PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
@@ -187,7 +185,8 @@ namespace JSON
         return value;
     }
 
-    Js::Var JSONParser::ParseObject()
+    template <typename EncodedChar>
+    Js::Var JSONParser<EncodedChar>::ParseObject()
     {
         PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
 
@@ -205,7 +204,16 @@ namespace JSON
             {
                 // will auto-null-terminate the string (as length=len+1)
                 uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                const utf8char_t* oneByteString = m_scanner.GetCurrentOneByteString();
+                if (oneByteString != nullptr)
+                {
+                    // ASCII from UTF-8 input keeps one byte per character
+                    retVal = Js::OneByteString::New(oneByteString, len, scriptContext);
+                }
+                else
+                {
+                    retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                }
                 Scan();
                 return retVal;
             }
@@ -415,4 +423,7 @@ namespace JSON
             m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
         }
     }
+
+    template class JSONParser<char16>;
+    template class JSONParser<utf8char_t>;
 } // namespace JSON
@@ -46,6 +46,8 @@ namespace JSON
     };
 
 
+    // EncodedChar is char16 for JavascriptString input and utf8char_t for UTF-8 input (see JSONScanner)
+    template <typename EncodedChar>
     class JSONParser
     {
     public:
@@ -55,8 +57,7 @@ namespace JSON
         };
         void Finalizer();
 
-        Js::Var Parse(LPCWSTR str, uint length);
-        Js::Var Parse(Js::JavascriptString* input);
+        Js::Var Parse(const EncodedChar* str, uint length);
         Js::Var Walk(Js::JavascriptString* name, Js::PropertyId id, Js::Var holder, uint32 index = Js::JavascriptArray::InvalidIndex);
 
     private:
@@ -80,7 +81,7 @@ namespace JSON
         }
 
         Token m_token;
-        JSONScanner m_scanner;
+        JSONScanner<EncodedChar> m_scanner;
         Js::ScriptContext* scriptContext;
         Js::RecyclableObject* reviver;
         Js::TempGuestArenaAllocatorObject* arenaAllocatorObject;
@@ -10,13 +10,15 @@ using namespace Js;
 namespace JSON
 {
     // -------- Scanner implementation ------------//
-    JSONScanner::JSONScanner()
+    template <typename EncodedChar>
+    JSONScanner<EncodedChar>::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
-        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0)
+        currentRangeCharacterPairList(0), stringBufferLength(0), currentIndex(0), currentString(0), currentOneByteString(0)
     {
     }
 
-    void JSONScanner::Finalizer()
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::Finalizer()
     {
         // All dynamic memory allocated by this object is on the arena - either the one this object owns or by the
         // one shared with JSON parser - here we will deallocate ours. The others will be deallocated when JSONParser
@@ -28,7 +30,8 @@ namespace JSON
         }
     }
 
-    void JSONScanner::Init(const char16* input, uint len, Token* pOutToken, Js::ScriptContext* sc, const char16* current, ArenaAllocator* allocator)
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::Init(const EncodedChar* input, uint len, Token* pOutToken, Js::ScriptContext* sc, const EncodedChar* current, ArenaAllocator* allocator)
     {
         // Note that allocator could be nullptr from JSONParser, if we could not reuse an allocator, keep our own
         inputText = input;
@@ -39,7 +42,8 @@ namespace JSON
         this->allocator = allocator;
     }
 
-    tokens JSONScanner::Scan()
+    template <typename EncodedChar>
+    tokens JSONScanner<EncodedChar>::Scan()
     {
         pTokenString = currentChar;
 
@@ -74,30 +78,8 @@ namespace JSON
             case '8':
             case '9':
                 //decimal digit starts a number
-                {
-                    currentChar--;
-
-                    // we use StrToDbl() here for compat with the rest of the engine. StrToDbl() accept a larger syntax.
-                    // Verify first the JSON grammar.
-                    const char16* saveCurrentChar = currentChar;
-                    if(!IsJSONNumber())
-                    {
-                       ThrowSyntaxError(JSERR_JsonBadNumber);
-                    }
-                    currentChar = saveCurrentChar;
-                    double val;
-                    const char16* end = nullptr;
-                    val = Js::NumberUtilities::StrToDbl(currentChar, &end, scriptContext);
-                    if(currentChar == end)
-                    {
-                       ThrowSyntaxError(JSERR_JsonBadNumber);
-                    }
-                    AssertMsg(!Js::JavascriptNumber::IsNan(val), "Bad result from string to double conversion");
-                    pToken->tk = tkFltCon;
-                    pToken->SetDouble(val, false);
-                    currentChar = end;
-                    return tkFltCon;
-                }
+                currentChar--;
+                return ScanNumber();
 
             case ',':
                 return (pToken->tk = tkComma);
@@ -156,7 +138,60 @@ namespace JSON
         return (pToken->tk = tkEOF);
     }
 
-    bool JSONScanner::IsJSONNumber()
+    template <typename EncodedChar>
+    tokens JSONScanner<EncodedChar>::ScanNumber()
+    {
+        // we use StrToDbl() here for compat with the rest of the engine. StrToDbl() accept a larger syntax.
+        // Verify first the JSON grammar.
+        const EncodedChar* saveCurrentChar = currentChar;
+        if(!IsJSONNumber())
+        {
+           ThrowSyntaxError(JSERR_JsonBadNumber);
+        }
+        currentChar = saveCurrentChar;
+
+        // StrToDbl() reads up to the first character that can't be part of a number. The input doesn't have to
+        // be null terminated (UTF-8 input usually comes from a buffer), so a number that ends the input is
+        // converted from a terminated copy.
+        const EncodedChar* inputEnd = inputText + inputLen;
+        const EncodedChar* numberEnd = currentChar;
+        while (numberEnd < inputEnd &&
+            (('0' <= *numberEnd && *numberEnd <= '9') || *numberEnd == '.' || *numberEnd == 'e' || *numberEnd == 'E' || *numberEnd == '+' || *numberEnd == '-'))
+        {
+            numberEnd++;
+        }
+
+        EncodedChar terminatedNumber[64];
+        const EncodedChar* start = currentChar;
+        if (numberEnd == inputEnd)
+        {
+            const size_t numberLength = numberEnd - currentChar;
+            EncodedChar* copy = terminatedNumber;
+            if (numberLength >= _countof(terminatedNumber))
+            {
+                copy = AnewArray(this->GetAllocator(), EncodedChar, numberLength + 1);
+            }
+            js_memcpy_s(copy, numberLength * sizeof(EncodedChar), currentChar, numberLength * sizeof(EncodedChar));
+            copy[numberLength] = 0;
+            start = copy;
+        }
+
+        double val;
+        const EncodedChar* end = nullptr;
+        val = Js::NumberUtilities::StrToDbl(start, &end, scriptContext);
+        if(start == end)
+        {
+           ThrowSyntaxError(JSERR_JsonBadNumber);
+        }
+        AssertMsg(!Js::JavascriptNumber::IsNan(val), "Bad result from string to double conversion");
+        pToken->tk = tkFltCon;
+        pToken->SetDouble(val, false);
+        currentChar += end - start;
+        return tkFltCon;
+    }
+
+    template <typename EncodedChar>
+    bool JSONScanner<EncodedChar>::IsJSONNumber()
     {
         bool firstDigitIsAZero = false;
         if (PeekNextChar() == '0')
@@ -193,7 +228,7 @@ namespace JSON
                     // at least one digit after '.'
                     if(currentChar < inputText + inputLen)
                     {
-                        char16 nch = ReadNextChar();
+                        EncodedChar nch = ReadNextChar();
                         if('0' <= nch && nch <= '9')
                         {
                             return true;
@@ -220,16 +255,19 @@ namespace JSON
         return true;
     }
 
-    tokens JSONScanner::ScanString()
+    template <typename EncodedChar>
+    tokens JSONScanner<EncodedChar>::ScanString()
     {
-        char16 ch;
+        EncodedChar ch;
 
         this->currentIndex = 0;
-        this->currentString = const_cast<char16*>(currentChar);
+        this->currentString = nullptr;
+        this->currentOneByteString = nullptr;
         bool endFound = false;
         bool isStringDirectInputTextMapped = true;
-        LPCWSTR bulkStart = currentChar;
+        const EncodedChar* bulkStart = currentChar;
         uint bulkLength = 0;
+        EncodedChar bulkBits = 0;
 
         while (currentChar < inputText + inputLen)
         {
@@ -261,8 +299,8 @@ namespace JSON
                    ThrowSyntaxError(JSERR_JsonNoStrEnd);
                 }
 
-                ch = ReadNextChar();
-                switch (ch)
+                char16 unescaped = ReadNextChar();
+                switch (unescaped)
                 {
                 case 0:
                     currentChar--;
@@ -271,27 +309,27 @@ namespace JSON
                 case '"':
                 case '/':
                 case '\\':
-                    //keep ch
+                    //keep the character
                     break;
 
                 case 'b':
-                    ch = 0x08;
+                    unescaped = 0x08;
                     break;
 
                 case 'f':
-                    ch = 0x0C;
+                    unescaped = 0x0C;
                     break;
 
                 case 'n':
-                    ch = 0x0A;
+                    unescaped = 0x0A;
                     break;
 
                 case 'r':
-                    ch = 0x0D;
+                    unescaped = 0x0D;
                     break;
 
                 case 't':
-                    ch = 0x09;
+                    unescaped = 0x09;
                     break;
 
                 case 'u':
@@ -328,7 +366,7 @@ namespace JSON
                         }
                         chcode += tempHex;
                         AssertMsg(chcode == (chcode & 0xFFFF), "Bad unicode code");
-                        ch = (char16)chcode;
+                        unescaped = (char16)chcode;
                     }
                     break;
 
@@ -338,7 +376,7 @@ namespace JSON
                 }
 
                 // flush
-                this->GetCurrentRangeCharacterPairList()->Add(RangeCharacterPair((uint)(bulkStart - inputText), bulkLength, ch));
+                this->GetCurrentRangeCharacterPairList()->Add(RangeCharacterPair((uint)(bulkStart - inputText), bulkLength, unescaped));
 
                 uint oldIndex = currentIndex;
                 currentIndex += bulkLength;
@@ -361,6 +399,7 @@ namespace JSON
             {
                 // continue
                 bulkLength++;
+                bulkBits |= ch;
             }
         }
 
@@ -395,7 +434,7 @@ namespace JSON
         else
         {
             // make currentIndex the length (w/o the \0)
-            currentIndex = bulkLength;
+            this->SetStringFromInput(bulkStart, bulkLength, bulkBits < 0x80);
 
             OUTPUT_TRACE_DEBUGONLY(Js::JSONPhase, _u("ScanString(): direct-mapped string as '%.*s'\n"),
                 GetCurrentStringLen(), GetCurrentString());
@@ -404,7 +443,8 @@ namespace JSON
         return (pToken->tk = tkStrCon);
     }
 
-    void JSONScanner::BuildUnescapedString(bool shouldSkipLastCharacter)
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::BuildUnescapedString(bool shouldSkipLastCharacter)
     {
         AssertMsg(this->allocator != nullptr, "We must have built the allocator");
         AssertMsg(this->currentRangeCharacterPairList != nullptr, "We must have built the currentRangeCharacterPairList");
@@ -412,17 +452,7 @@ namespace JSON
 
         // Step 1: Ensure the buffer has sufficient space
         int requiredSize = this->GetCurrentStringLen();
-        if (requiredSize > this->stringBufferLength)
-        {
-            if (this->stringBuffer)
-            {
-                AdeleteArray(this->allocator, this->stringBufferLength, this->stringBuffer);
-                this->stringBuffer = nullptr;
-            }
-
-            this->stringBuffer = AnewArray(this->allocator, char16, requiredSize);
-            this->stringBufferLength = requiredSize;
-        }
+        this->EnsureStringBuffer(requiredSize);
 
         // Step 2: Copy the data to the buffer
         int totalCopied = 0;
@@ -431,10 +461,9 @@ namespace JSON
         for (int i = 0; i <= lastCharacterIndex; i++)
         {
             RangeCharacterPair data = this->currentRangeCharacterPairList->Item(i);
-            int charactersToCopy = data.m_rangeLength;
-            js_wmemcpy_s(begin_copy, charactersToCopy, this->inputText + data.m_rangeStart, charactersToCopy);
-            begin_copy += charactersToCopy;
-            totalCopied += charactersToCopy;
+            int charactersCopied = CopyInputRange(begin_copy, this->inputText + data.m_rangeStart, data.m_rangeLength);
+            begin_copy += charactersCopied;
+            totalCopied += charactersCopied;
 
             if (i == lastCharacterIndex && shouldSkipLastCharacter)
             {
@@ -446,28 +475,117 @@ namespace JSON
             totalCopied++;
         }
 
-        if (totalCopied != requiredSize)
+        // The ranges were counted in input characters; UTF-8 input decodes to fewer characters than it has bytes
+        // when it isn't all ASCII
+        if (totalCopied > requiredSize || (sizeof(EncodedChar) == sizeof(char16) && totalCopied != requiredSize))
         {
             OUTPUT_TRACE_DEBUGONLY(Js::JSONPhase, _u("BuildUnescapedString(): allocated size = %d != copying size %d\n"), requiredSize, totalCopied);
             AssertMsg(totalCopied == requiredSize, "BuildUnescapedString(): The allocated size and copying size should match.");
         }
+        this->currentIndex = totalCopied;
 
         OUTPUT_TRACE_DEBUGONLY(Js::JSONPhase, _u("BuildUnescapedString(): unescaped string as '%.*s'\n"), GetCurrentStringLen(), this->stringBuffer);
     }
 
-    JSONScanner::RangeCharacterPairList* JSONScanner::GetCurrentRangeCharacterPairList(void)
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::EnsureStringBuffer(int requiredSize)
     {
-        if (this->currentRangeCharacterPairList == nullptr)
+        if (requiredSize > this->stringBufferLength)
         {
-            if (this->allocator == nullptr)
+            ArenaAllocator* allocator = this->GetAllocator();
+            if (this->stringBuffer)
             {
-                this->allocatorObject = this->scriptContext->GetTemporaryGuestAllocator(_u("JSONScanner"));
-                this->allocator = this->allocatorObject->GetAllocator();
+                AdeleteArray(allocator, this->stringBufferLength, this->stringBuffer);
+                this->stringBuffer = nullptr;
             }
 
-            this->currentRangeCharacterPairList = Anew(this->allocator, RangeCharacterPairList, this->allocator, 4);
+            this->stringBuffer = AnewArray(allocator, char16, requiredSize);
+            this->stringBufferLength = requiredSize;
+        }
+    }
+
+    template <>
+    uint JSONScanner<char16>::CopyInputRange(__out_ecount(length) char16* buffer, const char16* start, uint length)
+    {
+        js_wmemcpy_s(buffer, length, start, length);
+        return length;
+    }
+
+    template <>
+    uint JSONScanner<utf8char_t>::CopyInputRange(__out_ecount(length) char16* buffer, const utf8char_t* start, uint length)
+    {
+        // A range never ends inside a character: it is delimited by '"' or '\\', which can't be part of a multi-byte sequence
+        LPCUTF8 current = start;
+        return static_cast<uint>(utf8::DecodeUnitsInto(buffer, current, start + length));
+    }
+
+    template <>
+    void JSONScanner<char16>::SetStringFromInput(const char16* start, uint length, bool isAscii)
+    {
+        this->currentString = const_cast<char16*>(start);
+        this->currentIndex = length;
+    }
+
+    template <>
+    void JSONScanner<utf8char_t>::SetStringFromInput(const utf8char_t* start, uint length, bool isAscii)
+    {
+        if (isAscii)
+        {
+            // Values can be created from the input bytes as they are; only property names need the wide characters
+            this->currentOneByteString = start;
+            this->currentIndex = length;
+            return;
+        }
+
+        this->EnsureStringBuffer(length);
+        this->currentIndex = CopyInputRange(this->stringBuffer, start, length);
+        this->currentString = this->stringBuffer;
+    }
+
+    template <typename EncodedChar>
+    void JSONScanner<EncodedChar>::WidenCurrentString()
+    {
+        AssertMsg(this->currentOneByteString != nullptr, "Only strings taken from UTF-8 input as they are need widening");
+
+        const uint length = this->GetCurrentStringLen();
+        if (length == 0)
+        {
+            this->currentString = const_cast<char16*>(_u(""));
+            return;
+        }
+
+        this->EnsureStringBuffer(length);
+        for (uint i = 0; i < length; i++)
+        {
+            this->stringBuffer[i] = static_cast<char16>(this->currentOneByteString[i]);
+        }
+        this->currentString = this->stringBuffer;
+    }
+
+    template <typename EncodedChar>
+    ArenaAllocator* JSONScanner<EncodedChar>::GetAllocator()
+    {
+        if (this->allocator == nullptr)
+        {
+            this->allocatorObject = this->scriptContext->GetTemporaryGuestAllocator(_u("JSONScanner"));
+            this->allocator = this->allocatorObject->GetAllocator();
+        }
+
+        return this->allocator;
+    }
+
+    template <typename EncodedChar>
+    typename JSONScanner<EncodedChar>::RangeCharacterPairList* JSONScanner<EncodedChar>::GetCurrentRangeCharacterPairList(void)
+    {
+        if (this->currentRangeCharacterPairList == nullptr)
+        {
+            ArenaAllocator* allocator = this->GetAllocator();
+            this->currentRangeCharacterPairList = Anew(allocator, RangeCharacterPairList, allocator, 4);
         }
 
         return this->currentRangeCharacterPairList;
     }
+
+    template class JSONScanner<char16>;
+    template class JSONScanner<utf8char_t>;
 } // namespace JSON
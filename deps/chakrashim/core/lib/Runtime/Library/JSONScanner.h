@@ -6,22 +6,38 @@
 
 namespace JSON
 {
-    class JSONParser;
+    template <typename EncodedChar> class JSONParser;
 
     // Small scanner for exclusive JSON purpose. The general
     // JScript scanner is not appropriate here because of the JSON restricted lexical grammar
     // token enums and structures are shared although the token semantics is slightly different.
+    // EncodedChar is char16 for JavascriptString input and utf8char_t for UTF-8 input; either way
+    // string tokens are returned as UTF-16.
+    template <typename EncodedChar>
     class JSONScanner
     {
     public:
         JSONScanner();
         tokens Scan();
-        void Init(const char16* input, uint len, Token* pOutToken,
-            ::Js::ScriptContext* sc, const char16* current, ArenaAllocator* allocator);
+        void Init(const EncodedChar* input, uint len, Token* pOutToken,
+            ::Js::ScriptContext* sc, const EncodedChar* current, ArenaAllocator* allocator);
 
         void Finalizer();
-        char16* GetCurrentString() { return currentString; } 
+        char16* GetCurrentString()
+        {
+            if (currentString == nullptr)
+            {
+                // ASCII strings in UTF-8 input are only widened when needed, see GetCurrentOneByteString
+                WidenCurrentString();
+            }
+            return currentString;
+        }
         uint GetCurrentStringLen() { return currentIndex; }
+
+        // Returns the current string token as one byte per character if it can be taken from the input
+        // as is (ASCII without escapes in UTF-8 input), or nullptr otherwise.
+        const utf8char_t* GetCurrentOneByteString() { return currentOneByteString; }
+
         uint GetScanPosition() { return uint(currentChar - inputText); }
 
         void __declspec(noreturn) ThrowSyntaxError(int wErr)
@@ -50,35 +66,42 @@ namespace JSON
         Js::TempGuestArenaAllocatorObject* allocatorObject;
         ArenaAllocator* allocator;
         void BuildUnescapedString(bool shouldSkipLastCharacter);
+        void EnsureStringBuffer(int requiredSize);
+        void SetStringFromInput(const EncodedChar* start, uint length, bool isAscii);
+        void WidenCurrentString();
+        static uint CopyInputRange(__out_ecount(length) char16* buffer, const EncodedChar* start, uint length);
 
         RangeCharacterPairList* GetCurrentRangeCharacterPairList(void);
+        ArenaAllocator* GetAllocator();
 
-        inline char16 ReadNextChar(void)
+        inline EncodedChar ReadNextChar(void)
         {
             return *currentChar++;
         }
 
-        inline char16 PeekNextChar(void)
+        inline EncodedChar PeekNextChar(void)
         {
             return *currentChar;
         }
 
         tokens ScanString();
+        tokens ScanNumber();
         bool IsJSONNumber();
 
-        const char16* inputText;
+        const EncodedChar* inputText;
         uint    inputLen;
-        const char16* currentChar;
-        const char16* pTokenString;
+        const EncodedChar* currentChar;
+        const EncodedChar* pTokenString;
 
         Token*   pToken;
         ::Js::ScriptContext* scriptContext;
 
         uint     currentIndex;
         char16* currentString;
+        const utf8char_t* currentOneByteString;
         __field_ecount(stringBufferLength) char16* stringBuffer;
         int      stringBufferLength;
 
-        friend class JSONParser;
+        friend class JSONParser<EncodedChar>;
     };
 } // namespace JSON
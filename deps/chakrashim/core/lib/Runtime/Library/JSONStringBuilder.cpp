@@ -285,4 +285,335 @@ JSONStringBuilder::JSONStringBuilder(
 {
 }
 
+JSONUtf8Reader::JSONUtf8Reader(_In_ ScriptContext* scriptContext, _In_ LazyJSONString* lazyString) :
+    scriptContext(scriptContext),
+    recycler(scriptContext->GetRecycler()),
+    lazyString(lazyString),
+    gap(lazyString->gap),
+    gapLength(lazyString->gapLength),
+    stack(&HeapAllocator::Instance),
+    state(State::Value),
+    value(lazyString->jsonContent),
+    stringCurrent(nullptr),
+    stringEnd(nullptr),
+    isMemberName(false),
+    segmentStart(0),
+    segmentCount(0),
+    segmentOffset(0)
+{
+    // The string is never handed out, so nothing can flatten it and throw the metadata away
+    AssertOrFailFast(this->value != nullptr);
+    this->recycler->RootAddRef(lazyString);
+}
+
+JSONUtf8Reader::~JSONUtf8Reader()
+{
+    this->recycler->RootRelease(this->lazyString);
+}
+
+void
+JSONUtf8Reader::Enqueue(_In_ const char16* text, charcount_t length, uint32 repeat)
+{
+    if (length == 0 || repeat == 0)
+    {
+        return;
+    }
+
+    AssertOrFailFast(this->segmentCount < MaxSegments);
+    Segment& segment = this->segments[(this->segmentStart + this->segmentCount) % MaxSegments];
+    segment.text = text;
+    segment.length = length;
+    segment.repeat = repeat;
+    ++this->segmentCount;
+}
+
+void
+JSONUtf8Reader::EnqueueString(_In_ JavascriptString* str)
+{
+    this->Enqueue(str->GetString(), str->GetLength());
+}
+
+void
+JSONUtf8Reader::EnqueueNewLine(uint32 indentLevel)
+{
+    if (this->gap != nullptr)
+    {
+        this->EnqueueLiteral(_u("\n"));
+        this->Enqueue(this->gap, this->gapLength, indentLevel);
+    }
+}
+
+void
+JSONUtf8Reader::BeginString(_In_ JavascriptString* str, bool isMemberName)
+{
+    this->EnqueueLiteral(_u("\""));
+    this->stringCurrent = str->GetString();
+    this->stringEnd = this->stringCurrent + str->GetLength();
+    this->isMemberName = isMemberName;
+    this->state = State::String;
+}
+
+void
+JSONUtf8Reader::BeginMember(_In_ JSONObjectProperty* member)
+{
+    // The value is written once the name has been
+    this->value = &member->propertyValue;
+    this->BeginString(member->propertyName, true);
+}
+
+void
+JSONUtf8Reader::StepValue()
+{
+    JSONProperty* prop = this->value;
+    this->state = State::AfterValue;
+
+    switch (prop->type)
+    {
+    case JSONContentType::False:
+        this->EnqueueString(this->scriptContext->GetLibrary()->GetFalseDisplayString());
+        return;
+    case JSONContentType::True:
+        this->EnqueueString(this->scriptContext->GetLibrary()->GetTrueDisplayString());
+        return;
+    case JSONContentType::Null:
+        this->EnqueueString(this->scriptContext->GetLibrary()->GetNullDisplayString());
+        return;
+    case JSONContentType::Number:
+        this->EnqueueString(prop->numericValue.string);
+        return;
+    case JSONContentType::String:
+        this->BeginString(prop->stringValue, false);
+        return;
+    case JSONContentType::Object:
+        {
+            if (prop->obj->Count() == 0)
+            {
+                this->EnqueueLiteral(_u("{}"));
+                return;
+            }
+
+            Frame frame;
+            frame.members = prop->obj->GetIterator();
+            frame.elements = nullptr;
+            frame.index = 0;
+            this->stack.Add(frame);
+
+            this->EnqueueLiteral(_u("{"));
+            this->EnqueueNewLine(this->stack.Count());
+
+            Frame& top = this->stack.Last();
+            top.members.Next();
+            JSONObjectProperty& member = top.members.Data();
+            this->BeginMember(&member);
+            return;
+        }
+    case JSONContentType::Array:
+        {
+            if (prop->arr->length == 0)
+            {
+                this->EnqueueLiteral(_u("[]"));
+                return;
+            }
+
+            Frame frame;
+            frame.elements = prop->arr;
+            frame.index = 0;
+            this->stack.Add(frame);
+
+            this->EnqueueLiteral(_u("["));
+            this->EnqueueNewLine(this->stack.Count());
+
+            this->value = &prop->arr->arr[0];
+            this->state = State::Value;
+            return;
+        }
+    default:
+        Assume(UNREACHED);
+    }
+}
+
+void
+JSONUtf8Reader::StepString()
+{
+    // Characters that don't need escaping are written straight from the string, in runs
+    const char16* runStart = this->stringCurrent;
+    while (this->stringCurrent < this->stringEnd)
+    {
+        char16 currentCharacter = *this->stringCurrent;
+        if (currentCharacter < _u(' ') || currentCharacter == _u('"') || currentCharacter == _u('\\'))
+        {
+            break;
+        }
+        ++this->stringCurrent;
+    }
+
+    if (this->stringCurrent != runStart)
+    {
+        this->Enqueue(runStart, static_cast<charcount_t>(this->stringCurrent - runStart));
+        return;
+    }
+
+    if (this->stringCurrent == this->stringEnd)
+    {
+        if (!this->isMemberName)
+        {
+            this->EnqueueLiteral(_u("\""));
+            this->state = State::AfterValue;
+        }
+        else
+        {
+            if (this->gap == nullptr)
+            {
+                this->EnqueueLiteral(_u("\":"));
+            }
+            else
+            {
+                this->EnqueueLiteral(_u("\": "));
+            }
+            this->state = State::Value;
+        }
+        return;
+    }
+
+    char16 currentCharacter = *this->stringCurrent;
+    ++this->stringCurrent;
+
+    // The escape buffer is written out before the next step reuses it
+    this->escape[0] = _u('\\');
+    switch (currentCharacter)
+    {
+    case _u('"'):
+    case _u('\\'):
+        this->escape[1] = currentCharacter;
+        break;
+    case _u('\b'):
+        this->escape[1] = _u('b');
+        break;
+    case _u('\f'):
+        this->escape[1] = _u('f');
+        break;
+    case _u('\n'):
+        this->escape[1] = _u('n');
+        break;
+    case _u('\r'):
+        this->escape[1] = _u('r');
+        break;
+    case _u('\t'):
+        this->escape[1] = _u('t');
+        break;
+    default:
+        {
+            // Other characters less than SPACE are converted into a 4 digit hex code (e.g. \u0010)
+            static const char16 hexDigits[] = _u("0123456789abcdef");
+            this->escape[1] = _u('u');
+            this->escape[2] = _u('0');
+            this->escape[3] = _u('0');
+            this->escape[4] = hexDigits[currentCharacter >> 4];
+            this->escape[5] = hexDigits[currentCharacter & 0xf];
+            this->Enqueue(this->escape, 6);
+            return;
+        }
+    }
+    this->Enqueue(this->escape, 2);
+}
+
+void
+JSONUtf8Reader::StepAfterValue()
+{
+    if (this->stack.Count() == 0)
+    {
+        this->state = State::Done;
+        return;
+    }
+
+    Frame& top = this->stack.Last();
+    if (top.elements != nullptr)
+    {
+        if (++top.index < top.elements->length)
+        {
+            this->EnqueueLiteral(_u(","));
+            this->EnqueueNewLine(this->stack.Count());
+            this->value = &top.elements->arr[top.index];
+            this->state = State::Value;
+            return;
+        }
+
+        this->stack.RemoveAtEnd();
+        this->EnqueueNewLine(this->stack.Count());
+        this->EnqueueLiteral(_u("]"));
+        return;
+    }
+
+    if (top.members.Next())
+    {
+        JSONObjectProperty& member = top.members.Data();
+        this->EnqueueLiteral(_u(","));
+        this->EnqueueNewLine(this->stack.Count());
+        this->BeginMember(&member);
+        return;
+    }
+
+    this->stack.RemoveAtEnd();
+    this->EnqueueNewLine(this->stack.Count());
+    this->EnqueueLiteral(_u("}"));
+}
+
+void
+JSONUtf8Reader::Step()
+{
+    switch (this->state)
+    {
+    case State::Value:
+        this->StepValue();
+        return;
+    case State::String:
+        this->StepString();
+        return;
+    case State::AfterValue:
+        this->StepAfterValue();
+        return;
+    default:
+        Assume(UNREACHED);
+    }
+}
+
+size_t
+JSONUtf8Reader::Read(_Out_writes_(size) utf8char_t* buffer, size_t size)
+{
+    AssertOrFailFast(size >= JSON::MinUtf8ChunkSize);
+
+    size_t written = 0;
+    while (true)
+    {
+        if (this->segmentCount == 0)
+        {
+            if (this->state == State::Done)
+            {
+                break;
+            }
+            this->Step();
+            continue;
+        }
+
+        // Code points are never split between buffers, and an empty buffer always has room for one
+        Segment& segment = this->segments[this->segmentStart];
+        charcount_t cchEncoded;
+        written += utf8::EncodeTrueUtf8IntoTruncated(buffer + written, size - written,
+            segment.text + this->segmentOffset, segment.length - this->segmentOffset, &cchEncoded);
+        this->segmentOffset += cchEncoded;
+        if (this->segmentOffset < segment.length)
+        {
+            break;
+        }
+
+        this->segmentOffset = 0;
+        if (--segment.repeat == 0)
+        {
+            this->segmentStart = (this->segmentStart + 1) % MaxSegments;
+            --this->segmentCount;
+        }
+    }
+    return written;
+}
+
 } //namespace Js
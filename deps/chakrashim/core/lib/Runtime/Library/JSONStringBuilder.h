@@ -38,4 +38,76 @@ class JSONStringBuilder
     void Build();
 };
 
+// Produces the UTF-8 encoding of a stringified value on demand, a buffer at a time. The position in the
+// metadata is kept on an explicit stack between reads, so nothing is encoded before the caller asks for it
+// and the memory used does not depend on the length of the text.
+class JSONUtf8Reader
+{
+private:
+    enum class State : uint8
+    {
+        Value,
+        String,
+        AfterValue,
+        Done
+    };
+
+    // An object or array that is being written
+    struct Frame
+    {
+        JSONObject::Iterator members;
+        JSONArray* elements;
+        uint32 index;
+    };
+
+    // A piece of text, written repeat times
+    struct Segment
+    {
+        const char16* text;
+        charcount_t length;
+        uint32 repeat;
+    };
+
+    static const uint MaxSegments = 4;
+
+    ScriptContext* scriptContext;
+    Recycler* recycler;
+    // Rooted so that the metadata walked by the reader stays alive
+    LazyJSONString* lazyString;
+    const char16* gap;
+    charcount_t gapLength;
+
+    JsUtil::List<Frame, HeapAllocator> stack;
+    State state;
+    JSONProperty* value;
+
+    // The string being escaped, and whether it is a member name
+    const char16* stringCurrent;
+    const char16* stringEnd;
+    bool isMemberName;
+    char16 escape[6];
+
+    Segment segments[MaxSegments];
+    uint segmentStart;
+    uint segmentCount;
+    charcount_t segmentOffset;
+
+    void Enqueue(_In_ const char16* text, charcount_t length, uint32 repeat = 1);
+    template <size_t N> void EnqueueLiteral(const char16 (&text)[N]) { this->Enqueue(text, N - 1); }
+    void EnqueueString(_In_ JavascriptString* str);
+    void EnqueueNewLine(uint32 indentLevel);
+    void BeginString(_In_ JavascriptString* str, bool isMemberName);
+    void BeginMember(_In_ JSONObjectProperty* member);
+    void StepValue();
+    void StepString();
+    void StepAfterValue();
+    void Step();
+
+public:
+    JSONUtf8Reader(_In_ ScriptContext* scriptContext, _In_ LazyJSONString* lazyString);
+    ~JSONUtf8Reader();
+
+    size_t Read(_Out_writes_(size) utf8char_t* buffer, size_t size);
+};
+
 } // namespace Js
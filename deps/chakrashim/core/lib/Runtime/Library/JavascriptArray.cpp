@@ -6822,6 +6822,226 @@ namespace Js
         qsort_s<Element, Field(Var)>(elements, right - left + 1, CompareElements, this);
     }
 
+    // Reads the source of a comparer, one token at a time. Only the few tokens of a comparer that subtracts
+    // one parameter from the other are recognized; anything else, including comments, ends the scan.
+    class NumericComparerReader
+    {
+    public:
+        static const size_t MaxIdentifierLength = 32;
+
+        NumericComparerReader(LPCUTF8 source, size_t length) :
+            current(source), end(source + length), sawLineTerminator(false)
+        {
+        }
+
+        bool AtEnd()
+        {
+            SkipWhitespace();
+            return current == end;
+        }
+
+        // Whether a line terminator was skipped before the last token read
+        bool SawLineTerminator() const
+        {
+            return sawLineTerminator;
+        }
+
+        bool ReadPunctuator(const char* punctuator)
+        {
+            SkipWhitespace();
+            size_t length = strlen(punctuator);
+            if ((size_t)(end - current) < length || memcmp(current, punctuator, length) != 0)
+            {
+                return false;
+            }
+            current += length;
+            return true;
+        }
+
+        bool ReadIdentifier(char (&identifier)[MaxIdentifierLength + 1])
+        {
+            SkipWhitespace();
+            size_t length = 0;
+            while (current < end && IsIdentifierChar(*current, length == 0))
+            {
+                if (length == MaxIdentifierLength)
+                {
+                    return false;
+                }
+                identifier[length++] = (char)*current++;
+            }
+            identifier[length] = '\0';
+            return length != 0;
+        }
+
+        bool ReadKeyword(const char* keyword)
+        {
+            LPCUTF8 start = current;
+            char identifier[MaxIdentifierLength + 1];
+            if (ReadIdentifier(identifier) && strcmp(identifier, keyword) == 0)
+            {
+                return true;
+            }
+            current = start;
+            return false;
+        }
+
+    private:
+        static bool IsIdentifierChar(utf8char_t c, bool isFirst)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$' || (!isFirst && c >= '0' && c <= '9');
+        }
+
+        void SkipWhitespace()
+        {
+            sawLineTerminator = false;
+            for (; current < end; current++)
+            {
+                if (*current == '\n' || *current == '\r')
+                {
+                    sawLineTerminator = true;
+                }
+                else if (*current != ' ' && *current != '\t')
+                {
+                    break;
+                }
+            }
+        }
+
+        LPCUTF8 current;
+        LPCUTF8 end;
+        bool sawLineTerminator;
+    };
+
+    // Reads "a - b" where a and b are the two parameters
+    static NumericSortOrder ReadNumericComparerExpression(NumericComparerReader& reader, const char* first, const char* second, bool allowLineTerminatorBefore)
+    {
+        char left[NumericComparerReader::MaxIdentifierLength + 1];
+        char right[NumericComparerReader::MaxIdentifierLength + 1];
+        if (!reader.ReadIdentifier(left) || (!allowLineTerminatorBefore && reader.SawLineTerminator())
+            || !reader.ReadPunctuator("-") || !reader.ReadIdentifier(right))
+        {
+            return NumericSortOrder_None;
+        }
+
+        if (strcmp(left, first) == 0 && strcmp(right, second) == 0)
+        {
+            return NumericSortOrder_Ascending;
+        }
+        if (strcmp(left, second) == 0 && strcmp(right, first) == 0)
+        {
+            return NumericSortOrder_Descending;
+        }
+        return NumericSortOrder_None;
+    }
+
+    // Reads "return a - b; }" after the opening brace of a function body
+    static NumericSortOrder ReadNumericComparerBody(NumericComparerReader& reader, const char* first, const char* second)
+    {
+        if (!reader.ReadKeyword("return"))
+        {
+            return NumericSortOrder_None;
+        }
+
+        // A line break right after return would return undefined
+        NumericSortOrder order = ReadNumericComparerExpression(reader, first, second, false /* allowLineTerminatorBefore */);
+        if (order == NumericSortOrder_None)
+        {
+            return NumericSortOrder_None;
+        }
+
+        reader.ReadPunctuator(";");
+        return reader.ReadPunctuator("}") ? order : NumericSortOrder_None;
+    }
+
+    //
+    // Recognizes comparers such as (a, b) => a - b and function (a, b) { return b - a; }. They order numbers
+    // by value and have no side effects, so numbers can be sorted without calling them.
+    //
+    NumericSortOrder JavascriptArray::GetNumericSortOrder(RecyclableObject* compFn, ScriptContext* scriptContext)
+    {
+        // Longer sources can't be one of the recognized comparers with reasonably named parameters
+        const uint MaxSourceLength = 128;
+
+        // Don't skip calls that the debugger could stop in
+        if (compFn == nullptr || !ScriptFunction::Is(compFn) || compFn->GetScriptContext() != scriptContext
+            || scriptContext->IsScriptContextInDebugMode())
+        {
+            return NumericSortOrder_None;
+        }
+
+        ScriptFunction* function = ScriptFunction::UnsafeFromVar(compFn);
+        if (function->IsWasmFunction())
+        {
+            return NumericSortOrder_None;
+        }
+
+        ParseableFunctionInfo* info = function->GetFunctionProxy()->EnsureDeserialized();
+        if (info->IsGenerator() || info->IsAsync() || info->GetUtf8SourceInfo()->GetIsLibraryCode()
+            || info->LengthInBytes() > MaxSourceLength)
+        {
+            return NumericSortOrder_None;
+        }
+
+        NumericComparerReader reader(info->GetSource(_u("JavascriptArray::GetNumericSortOrder")), info->LengthInBytes());
+        bool isLambda = info->IsLambda();
+        char name[NumericComparerReader::MaxIdentifierLength + 1];
+        if (!isLambda)
+        {
+            if (!reader.ReadKeyword("function"))
+            {
+                return NumericSortOrder_None;
+            }
+            reader.ReadIdentifier(name);
+        }
+
+        char first[NumericComparerReader::MaxIdentifierLength + 1];
+        char second[NumericComparerReader::MaxIdentifierLength + 1];
+        if (!reader.ReadPunctuator("(") || !reader.ReadIdentifier(first) || !reader.ReadPunctuator(",")
+            || !reader.ReadIdentifier(second) || !reader.ReadPunctuator(")") || strcmp(first, second) == 0)
+        {
+            return NumericSortOrder_None;
+        }
+
+        NumericSortOrder order = NumericSortOrder_None;
+        if (isLambda && !reader.ReadPunctuator("=>"))
+        {
+            return NumericSortOrder_None;
+        }
+
+        if (reader.ReadPunctuator("{"))
+        {
+            order = ReadNumericComparerBody(reader, first, second);
+        }
+        else if (isLambda)
+        {
+            order = ReadNumericComparerExpression(reader, first, second, true /* allowLineTerminatorBefore */);
+        }
+
+        return reader.AtEnd() ? order : NumericSortOrder_None;
+    }
+
+    template <typename T>
+    bool JavascriptArray::TrySortNativeSegment(NumericSortOrder order)
+    {
+        // Only a single segment without missing values can be sorted in place
+        if (head == nullptr || head->next != nullptr || head->left != 0 || head->length != length)
+        {
+            return false;
+        }
+
+        SparseArraySegment<T>* segment = SparseArraySegment<T>::From(head);
+        for (uint32 i = 0; i < segment->length; i++)
+        {
+            if (SparseArraySegment<T>::IsMissingItem(&segment->elements[i]))
+            {
+                return false;
+            }
+        }
+
+        return TrySortNumeric<T>(segment->elements, segment->length, order, false /* isDefaultOrder */);
+    }
+
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -6884,6 +7104,21 @@ namespace Js
                 Js::Throw::FatalInternalError();
             }
 
+            // A native array sorted by a comparer that just subtracts can be sorted by value in place, without
+            // converting it to a var array or calling the comparer.
+            NumericSortOrder order = GetNumericSortOrder(compFn, scriptContext);
+            if (order != NumericSortOrder_None)
+            {
+                if (JavascriptNativeIntArray::Is(arr) && arr->TrySortNativeSegment<int32>(order))
+                {
+                    return args[0];
+                }
+                if (JavascriptNativeFloatArray::Is(arr) && arr->TrySortNativeSegment<double>(order))
+                {
+                    return args[0];
+                }
+            }
+
             EnsureNonNativeArray(arr);
             JS_REENTRANT(jsReentLock, arr->Sort(compFn));
         }
@@ -91,6 +91,14 @@ namespace Js
         ConcatSpreadableState_CheckedAndTrue
     };
 
+    // Order of a sort whose comparer only compares the numeric values of the elements
+    enum NumericSortOrder
+    {
+        NumericSortOrder_None,
+        NumericSortOrder_Ascending,
+        NumericSortOrder_Descending
+    };
+
     class JavascriptArray : public ArrayObject
     {
         template <class TPropertyIndex>
@@ -168,6 +176,9 @@ namespace Js
 
         void Sort(RecyclableObject* compFn);
 
+        static NumericSortOrder GetNumericSortOrder(RecyclableObject* compFn, ScriptContext* scriptContext);
+        template <typename T> static bool TrySortNumeric(__inout_ecount(length) T* elements, uint32 length, NumericSortOrder order, bool isDefaultOrder);
+
         template<typename NativeArrayType, typename T> NativeArrayType * ConvertToNativeArrayInPlace(JavascriptArray *varArray);
 
         template <typename T> T GetNativeValue(Var iVal, ScriptContext * scriptContext);
@@ -632,6 +643,7 @@ namespace Js
 
         static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
         void SortElements(Element* elements, uint32 left, uint32 right);
+        template <typename T> bool TrySortNativeSegment(NumericSortOrder order);
 
         template <typename Fn>
         static void ForEachOwnMissingArrayIndexOfObject(JavascriptArray *baseArr, JavascriptArray *destArray, RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, uint32 destIndex, Fn fn);
@@ -61,6 +61,60 @@ namespace Js
         return current;
     }
 
+    //
+    // Sorts numbers by value without calling a comparer, with NaNs last. In the default order of
+    // TypedArray.prototype.sort -0 comes before +0. A comparer that subtracts finds them equal, and a
+    // stable sort would leave them where they are, so in that case give up if there is a -0.
+    //
+    template <typename T>
+    bool JavascriptArray::TrySortNumeric(__inout_ecount(length) T* elements, uint32 length, NumericSortOrder order, bool isDefaultOrder)
+    {
+        Assert(order != NumericSortOrder_None);
+
+        if (!isDefaultOrder)
+        {
+            for (uint32 i = 0; i < length; i++)
+            {
+                if (JavascriptNumber::IsNegZero((double)elements[i]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        uint32 count = length;
+        for (uint32 i = 0; i < count;)
+        {
+            if (NumberUtilities::IsNan((double)elements[i]))
+            {
+                count--;
+                T nan = elements[i];
+                elements[i] = elements[count];
+                elements[count] = nan;
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (!JsUtil::RadixSort<T>::Sort(elements, count))
+        {
+            return false;
+        }
+
+        if (order == NumericSortOrder_Descending && count > 1)
+        {
+            for (uint32 low = 0, high = count - 1; low < high; low++, high--)
+            {
+                T value = elements[low];
+                elements[low] = elements[high];
+                elements[high] = value;
+            }
+        }
+        return true;
+    }
+
     //
     // Link prev and current. If prev is NULL, make current the head segment.
     //
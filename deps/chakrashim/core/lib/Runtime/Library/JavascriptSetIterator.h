@@ -16,7 +16,7 @@ namespace Js
     {
     private:
         Field(JavascriptSet*)                          m_set;
-        Field(JavascriptSet::SetDataList::Iterator)    m_setIterator;
+        Field(JavascriptSet::SetData::Iterator)        m_setIterator;
         Field(JavascriptSetIteratorKind)               m_kind;
 
     protected:
@@ -319,6 +319,19 @@ namespace Js
         return StringBracketHelper(args, scriptContext, tag, static_cast<charcount_t>(N1 - 1), prop, static_cast<charcount_t>(N2 - 1));
     }
 
+    hash_t JavascriptString::GetHashCode()
+    {
+        if (!this->IsFinalized())
+        {
+            const OneByteString *const oneByteString = OneByteString::TryFromVar(this);
+            if (oneByteString)
+            {
+                return oneByteString->GetOneByteHashCode();
+            }
+        }
+        return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(this->GetString(), this->GetLength());
+    }
+
     BOOL JavascriptString::BufferEquals(__in_ecount(otherLength) LPCWSTR otherBuffer, __in charcount_t otherLength)
     {
         return otherLength == this->GetLength() &&
@@ -579,6 +592,18 @@ namespace Js
 
         if(pstLeft->GetLength() != 1 || pstRight->GetLength() != 1)
         {
+            if(!pstLeft->IsFinalized() && !pstRight->IsFinalized() &&
+                pstLeft->GetLength() + pstRight->GetLength() <= OneByteString::MaxCopyOnConcatLength)
+            {
+                // Short concatenations of one-byte strings stay one-byte
+                OneByteString *const oneByteLeft = OneByteString::TryFromVar(pstLeft);
+                OneByteString *const oneByteRight = OneByteString::TryFromVar(pstRight);
+                if(oneByteLeft && oneByteRight)
+                {
+                    return OneByteString::Concat(oneByteLeft, oneByteRight);
+                }
+            }
+
 #ifdef PROFILE_STRINGS
             StringProfiler::RecordConcatenation(pstLeft->GetScriptContext(), pstLeft->GetLength(), pstRight->GetLength(), ConcatType_ConcatTree);
 #endif
@@ -3041,6 +3066,49 @@ namespace Js
 
     bool JavascriptString::Equals(Var aLeft, Var aRight)
     {
+        JavascriptString *leftString = JavascriptString::UnsafeFromVar(aLeft);
+        JavascriptString *rightString = JavascriptString::UnsafeFromVar(aRight);
+
+        // Compare one-byte strings without widening them
+        if (leftString != rightString && (!leftString->IsFinalized() || !rightString->IsFinalized()))
+        {
+            // Pin both strings, flattening the other string could cause a GC (see strcmp)
+            volatile Js::JavascriptString** keepAliveLeftString = (volatile Js::JavascriptString**)& leftString;
+            volatile Js::JavascriptString** keepAliveRightString = (volatile Js::JavascriptString**)& rightString;
+            auto keepAliveLambda = [&]() {
+                UNREFERENCED_PARAMETER(keepAliveLeftString);
+                UNREFERENCED_PARAMETER(keepAliveRightString);
+            };
+
+            OneByteString *oneByteLeft = OneByteString::TryFromVar(leftString);
+            OneByteString *oneByteRight = OneByteString::TryFromVar(rightString);
+            if (oneByteLeft && oneByteLeft->IsFinalized())
+            {
+                oneByteLeft = nullptr;
+            }
+            if (oneByteRight && oneByteRight->IsFinalized())
+            {
+                oneByteRight = nullptr;
+            }
+
+            if (oneByteLeft || oneByteRight)
+            {
+                if (leftString->GetLength() != rightString->GetLength())
+                {
+                    return false;
+                }
+                if (oneByteLeft && oneByteRight)
+                {
+                    return oneByteLeft->Compare(oneByteRight) == 0;
+                }
+                if (oneByteLeft)
+                {
+                    return !!oneByteLeft->BufferEquals(rightString->GetString(), rightString->GetLength());
+                }
+                return !!oneByteRight->BufferEquals(leftString->GetString(), leftString->GetLength());
+            }
+        }
+
         return JavascriptStringHelpers<JavascriptString>::Equals(aLeft, aRight);
     }
 
@@ -3569,6 +3637,17 @@ namespace Js
             UNREFERENCED_PARAMETER(keepAliveString1);
             UNREFERENCED_PARAMETER(keepAliveString2);
         };
+
+        if (!string1->IsFinalized() && !string2->IsFinalized())
+        {
+            const OneByteString *const oneByteString1 = OneByteString::TryFromVar(string1);
+            const OneByteString *const oneByteString2 = OneByteString::TryFromVar(string2);
+            if (oneByteString1 && oneByteString2)
+            {
+                return oneByteString1->Compare(oneByteString2);
+            }
+        }
+
         int result = wmemcmp(string1->GetString(), string2->GetString(), min(string1Len, string2Len));
 
         return (result == 0) ? (int)(string1Len - string2Len) : result;
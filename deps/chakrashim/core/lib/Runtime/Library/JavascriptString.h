@@ -122,6 +122,7 @@ namespace Js
         virtual RecyclableObject * CloneToScriptContext(ScriptContext* requestContext) override;
 
         virtual BOOL BufferEquals(__in_ecount(otherLength) LPCWSTR otherBuffer, __in charcount_t otherLength);
+        hash_t GetHashCode();   // Same as the hash of GetString(), but does not widen one-byte strings
         char16* GetNormalizedString(PlatformAgnostic::UnicodeText::NormalizationForm, ArenaAllocator*, charcount_t&);
 
         static bool Is(Var aValue);
@@ -382,7 +383,7 @@ namespace Js
 
         inline static hash_t GetHashCode(JavascriptString * str)
         {
-            return JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(str->GetString(), str->GetLength());
+            return str->GetHashCode();
         }
     };
 
@@ -410,6 +411,6 @@ struct DefaultComparer<Js::JavascriptString*>
 
     inline static hash_t GetHashCode(Js::JavascriptString * pStr)
     {
-        return JsUtil::CharacterBuffer<char16>::StaticGetHashCode(pStr->GetString(), pStr->GetLength());
+        return pStr->GetHashCode();
     }
 };
@@ -79,6 +79,8 @@ struct JSONArray
 
 class LazyJSONString : JavascriptString
 {
+    friend class JSONUtf8Reader;
+
 private:
     Field(charcount_t) gapLength;
     Field(JSONProperty*) jsonContent;
@@ -0,0 +1,394 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is an insertion ordered hash table for the entries of ES6 Map and Set
+// objects. Entries live in a single array in insertion order, together with the
+// hash bucket chains (as indices) and the bucket heads, so adding an entry is a
+// store into the array rather than an allocation, and iteration is a walk over
+// the array.
+//
+// Deleting an entry only unlinks it from its chain and clears its key, leaving
+// a hole, so the indices of all other entries stay the same. Holes are dropped
+// when the table is rebuilt, which happens when the array fills up (the table
+// grows if there are too few holes to make room) or when most of the entries
+// have been deleted (the table shrinks).
+//
+// Iterators hold an index into the entry array and must keep their place
+// across rebuilds and clears without the table keeping track of them. Each
+// rebuild or clear moves the entries to a new store, and the old store is left
+// with a link to its successor and the indices of the holes that were dropped,
+// so an iterator still using it can work out its index in the new store. Stores
+// are recycler allocated; an old store is collected once no iterator refers to
+// it.
+
+namespace Js
+{
+    template <typename TData>
+    class MapOrSetData
+    {
+    private:
+        static const int NoEntry = -1;
+        static const uint MinBucketCount = 2;
+        static const uint MaxBucketCount = 1 << 27;
+        static const uint LoadFactor = 2;
+
+        struct Entry
+        {
+            Field(TData) data;
+            Field(int) next;
+            Field(hash_t) hash;
+        };
+
+        class Store
+        {
+        public:
+            // Set once the entries have been moved to another store
+            Field(Store*) nextStore;
+            // Indices of the holes that were dropped on the way to nextStore, in ascending order
+            Field(uint*) removedIndices;
+            Field(uint) removedCount;
+            // Set if the entries were cleared rather than moved to nextStore
+            Field(bool) isCleared;
+
+            Field(uint) bucketCount;
+            Field(uint) capacity;
+            // Number of entries used in the array, including holes
+            Field(uint) usedCount;
+
+            // The entry array and then the buckets follow the store in the same allocation
+
+            Store(uint bucketCount) :
+                nextStore(nullptr), removedIndices(nullptr), removedCount(0), isCleared(false),
+                bucketCount(bucketCount), capacity(bucketCount * LoadFactor), usedCount(0)
+            {
+                int* buckets = GetBuckets();
+                for (uint i = 0; i < bucketCount; i++)
+                {
+                    buckets[i] = NoEntry;
+                }
+            }
+
+            static Store* New(Recycler* recycler, uint bucketCount)
+            {
+                Assert(Math::IsPow2(bucketCount) && bucketCount >= MinBucketCount);
+                if (bucketCount > MaxBucketCount)
+                {
+                    Throw::OutOfMemory();
+                }
+
+                size_t plusSize = bucketCount * LoadFactor * sizeof(Entry) + bucketCount * sizeof(int);
+                return RecyclerNewWithBarrierPlusZ(recycler, plusSize, Store, bucketCount);
+            }
+
+            Entry* GetEntries()
+            {
+                return reinterpret_cast<Entry*>(this + 1);
+            }
+
+            int* GetBuckets()
+            {
+                return reinterpret_cast<int*>(GetEntries() + capacity);
+            }
+
+            int* GetBucket(hash_t hash)
+            {
+                return &GetBuckets()[hash & (bucketCount - 1)];
+            }
+
+            // Maps the index of an iterator that was using this store to its index in nextStore
+            uint GetIndexInNextStore(uint index) const
+            {
+                Assert(nextStore != nullptr);
+                if (isCleared)
+                {
+                    return 0;
+                }
+
+                // Every hole dropped before the index moves it down by one
+                uint low = 0;
+                uint high = removedCount;
+                while (low < high)
+                {
+                    uint mid = low + (high - low) / 2;
+                    if (removedIndices[mid] < index)
+                    {
+                        low = mid + 1;
+                    }
+                    else
+                    {
+                        high = mid;
+                    }
+                }
+                return index - low;
+            }
+        };
+
+        Field(Store*) store;
+        Field(int) count;
+
+        static Var GetKey(Var data)
+        {
+            return data;
+        }
+
+        template <typename TValue>
+        static Var GetKey(const JsUtil::KeyValuePair<Field(Var), TValue>& data)
+        {
+            return data.Key();
+        }
+
+        static bool IsHole(const Entry& entry)
+        {
+            return GetKey(entry.data) == nullptr;
+        }
+
+        static void MakeHole(Field(Var)& data)
+        {
+            data = nullptr;
+        }
+
+        template <typename TValue>
+        static void MakeHole(JsUtil::KeyValuePair<Field(Var), TValue>& data)
+        {
+            data = JsUtil::KeyValuePair<Field(Var), TValue>(nullptr, nullptr);
+        }
+
+        static hash_t GetHashCode(Var key)
+        {
+            return SameValueZeroComparer<Var>::GetHashCode(key);
+        }
+
+        int FindEntry(Var key, hash_t hash) const
+        {
+            Entry* entries = store->GetEntries();
+            for (int i = *store->GetBucket(hash); i != NoEntry; i = entries[i].next)
+            {
+                if (entries[i].hash == hash && SameValueZeroComparer<Var>::Equals(GetKey(entries[i].data), key))
+                {
+                    return i;
+                }
+            }
+            return NoEntry;
+        }
+
+        bool Insert(const TData& data, bool replace, Recycler* recycler)
+        {
+            Var key = GetKey(data);
+            Assert(key != nullptr);
+
+            hash_t hash = GetHashCode(key);
+            int index = FindEntry(key, hash);
+            if (index != NoEntry)
+            {
+                if (replace)
+                {
+                    store->GetEntries()[index].data = data;
+                }
+                return false;
+            }
+
+            if (store->usedCount == store->capacity)
+            {
+                // Grow unless dropping the holes frees up at least half of the array
+                uint bucketCount = store->bucketCount;
+                Rebuild((uint)count >= store->capacity / 2 ? bucketCount * 2 : bucketCount, recycler);
+            }
+
+            Assert(store->usedCount < store->capacity);
+            index = store->usedCount++;
+            Entry* entry = &store->GetEntries()[index];
+            int* bucket = store->GetBucket(hash);
+            entry->data = data;
+            entry->hash = hash;
+            entry->next = *bucket;
+            *bucket = index;
+            count++;
+            return true;
+        }
+
+        void Rebuild(uint bucketCount, Recycler* recycler)
+        {
+            Store* oldStore = store;
+            Store* newStore = Store::New(recycler, bucketCount);
+            Assert((uint)count <= newStore->capacity);
+
+            uint holeCount = oldStore->usedCount - count;
+            uint* removedIndices = holeCount != 0 ? RecyclerNewArrayLeaf(recycler, uint, holeCount) : nullptr;
+
+            Entry* oldEntries = oldStore->GetEntries();
+            Entry* newEntries = newStore->GetEntries();
+            uint removedCount = 0;
+            uint newIndex = 0;
+            for (uint i = 0; i < oldStore->usedCount; i++)
+            {
+                if (IsHole(oldEntries[i]))
+                {
+                    removedIndices[removedCount++] = i;
+                    continue;
+                }
+
+                int* bucket = newStore->GetBucket(oldEntries[i].hash);
+                newEntries[newIndex].data = oldEntries[i].data;
+                newEntries[newIndex].hash = oldEntries[i].hash;
+                newEntries[newIndex].next = *bucket;
+                *bucket = newIndex;
+                newIndex++;
+            }
+            Assert(removedCount == holeCount && newIndex == (uint)count);
+            newStore->usedCount = newIndex;
+
+            // Iterators only need the link and the dropped holes, so don't let the old entries keep
+            // their keys and values alive.
+            memset(oldEntries, 0, oldStore->usedCount * sizeof(Entry));
+            oldStore->removedIndices = removedIndices;
+            oldStore->removedCount = removedCount;
+            oldStore->nextStore = newStore;
+            store = newStore;
+        }
+
+    public:
+        MapOrSetData(VirtualTableInfoCtorEnum) { }
+        MapOrSetData() : store(nullptr), count(0) { }
+
+        class Iterator
+        {
+            Field(Store*) store;
+            Field(uint) index;
+            Field(TData) current;
+
+        public:
+            Iterator() : store(nullptr), index(0) { }
+            Iterator(Store* store) : store(store), index(0) { }
+
+            bool Next()
+            {
+                if (store == nullptr)
+                {
+                    return false;
+                }
+
+                // Catch up with the rebuilds and clears since the last call
+                Store* currentStore = store;
+                uint currentIndex = index;
+                while (currentStore->nextStore != nullptr)
+                {
+                    currentIndex = currentStore->GetIndexInNextStore(currentIndex);
+                    currentStore = currentStore->nextStore;
+                }
+
+                Entry* entries = currentStore->GetEntries();
+                for (; currentIndex < currentStore->usedCount; currentIndex++)
+                {
+                    if (!IsHole(entries[currentIndex]))
+                    {
+                        current = entries[currentIndex].data;
+                        store = currentStore;
+                        index = currentIndex + 1;
+                        return true;
+                    }
+                }
+
+                // Once done, entries added later are not visited
+                store = nullptr;
+                index = 0;
+                return false;
+            }
+
+            const TData& Current() const
+            {
+                return current;
+            }
+        };
+
+        void Initialize(Recycler* recycler)
+        {
+            Assert(store == nullptr);
+            store = Store::New(recycler, MinBucketCount);
+            count = 0;
+        }
+
+        bool IsInitialized() const
+        {
+            return store != nullptr;
+        }
+
+        int Count() const
+        {
+            return count;
+        }
+
+        bool Has(Var key) const
+        {
+            return FindEntry(key, GetHashCode(key)) != NoEntry;
+        }
+
+        bool TryGetData(Var key, TData* data) const
+        {
+            int index = FindEntry(key, GetHashCode(key));
+            if (index == NoEntry)
+            {
+                return false;
+            }
+            *data = store->GetEntries()[index].data;
+            return true;
+        }
+
+        // Adds the data unless an entry with the same key exists. Returns whether it was added.
+        bool Add(const TData& data, Recycler* recycler)
+        {
+            return Insert(data, false /* replace */, recycler);
+        }
+
+        // Adds the data, or replaces the data of the entry with the same key, keeping its position.
+        void Set(const TData& data, Recycler* recycler)
+        {
+            Insert(data, true /* replace */, recycler);
+        }
+
+        bool Remove(Var key, Recycler* recycler)
+        {
+            hash_t hash = GetHashCode(key);
+            Entry* entries = store->GetEntries();
+            int* previous = store->GetBucket(hash);
+            for (int i = *previous; i != NoEntry; previous = &entries[i].next, i = *previous)
+            {
+                if (entries[i].hash == hash && SameValueZeroComparer<Var>::Equals(GetKey(entries[i].data), key))
+                {
+                    *previous = entries[i].next;
+                    MakeHole(entries[i].data);
+                    count--;
+
+                    if ((uint)count < store->capacity / 4 && store->bucketCount > MinBucketCount)
+                    {
+                        Rebuild(store->bucketCount / 2, recycler);
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Clear(Recycler* recycler)
+        {
+            if (store->usedCount == 0)
+            {
+                return;
+            }
+
+            Store* newStore = Store::New(recycler, MinBucketCount);
+            memset(store->GetEntries(), 0, store->usedCount * sizeof(Entry));
+            store->isCleared = true;
+            store->nextStore = newStore;
+            store = newStore;
+            count = 0;
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(store);
+        }
+    };
+}
@@ -0,0 +1,249 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    static void WidenOneByteChars(__out_ecount(count) char16* dst, __in_ecount(count) const byte* src, charcount_t count)
+    {
+        for (charcount_t i = 0; i < count; i++)
+        {
+            dst[i] = static_cast<char16>(src[i]);
+        }
+    }
+
+    OneByteString::OneByteString(const byte* buffer, charcount_t offset, charcount_t length, bool sharesBuffer,
+        ExternalOneByteBuffer* externalBuffer, StaticType* type) :
+        JavascriptString(type),
+        oneByteBuffer(buffer),
+        oneByteOffset(offset),
+        sharesBuffer(sharesBuffer),
+        externalBuffer(externalBuffer)
+    {
+        Assert(buffer != nullptr);
+
+        // Use SetLength to ensure length is valid
+        SetLength(length);
+    }
+
+    JavascriptString* OneByteString::New(__in_ecount(charLength) const byte* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        Assert(content != nullptr || charLength == 0);
+
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        if (charLength == 0)
+        {
+            return library->GetEmptyString();
+        }
+
+        if (charLength == 1)
+        {
+            return library->GetCharStringCache().GetStringForChar(static_cast<char16>(content[0]));
+        }
+
+        if (!IsValidCharCount(charLength))
+        {
+            JavascriptExceptionOperators::ThrowOutOfMemory(scriptContext);
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        byte* buffer = RecyclerNewArrayLeaf(recycler, byte, charLength);
+        js_memcpy_s(buffer, charLength, content, charLength);
+
+        return RecyclerNew(recycler, OneByteString, buffer, 0, charLength, false, nullptr, library->GetStringTypeStatic());
+    }
+
+    JavascriptString* OneByteString::NewExternal(__in_ecount(charLength) const byte* content, charcount_t charLength,
+        ExternalOneByteBuffer* externalBuffer, ScriptContext* scriptContext)
+    {
+        Assert(externalBuffer != nullptr);
+
+        // Short strings come from the library's caches, and externalBuffer is released once it is collected
+        if (charLength <= 1)
+        {
+            return New(content, charLength, scriptContext);
+        }
+
+        if (!IsValidCharCount(charLength))
+        {
+            JavascriptExceptionOperators::ThrowOutOfMemory(scriptContext);
+        }
+
+        return RecyclerNew(scriptContext->GetRecycler(), OneByteString,
+            content, 0, charLength, false, externalBuffer, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    JavascriptString* OneByteString::NewSubString(OneByteString* string, charcount_t start, charcount_t length)
+    {
+        Assert(!string->IsFinalized());
+        AssertOrFailFast(string->GetLength() >= start + length);
+
+        ScriptContext* scriptContext = string->GetScriptContext();
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+        if (length == 0)
+        {
+            return library->GetEmptyString();
+        }
+
+        if (length == 1)
+        {
+            return library->GetCharStringCache().GetStringForChar(static_cast<char16>(string->GetOneByteBuffer()[start]));
+        }
+
+        return RecyclerNew(scriptContext->GetRecycler(), OneByteString,
+            string->oneByteBuffer, string->oneByteOffset + start, length, true, string->externalBuffer,
+            library->GetStringTypeStatic());
+    }
+
+    JavascriptString* OneByteString::Concat(OneByteString* left, OneByteString* right)
+    {
+        Assert(!left->IsFinalized() && !right->IsFinalized());
+
+        const charcount_t leftLength = left->GetLength();
+        const charcount_t rightLength = right->GetLength();
+        const charcount_t length = leftLength + rightLength;
+        Assert(length <= MaxCopyOnConcatLength);
+
+        ScriptContext* scriptContext = left->GetScriptContext();
+        Recycler* recycler = scriptContext->GetRecycler();
+        byte* buffer = RecyclerNewArrayLeaf(recycler, byte, length);
+
+        left->CopyOneByte(buffer, 0, leftLength);
+        right->CopyOneByte(buffer + leftLength, 0, rightLength);
+
+        return RecyclerNew(recycler, OneByteString, buffer, 0, length, false, nullptr, scriptContext->GetLibrary()->GetStringTypeStatic());
+    }
+
+    const byte* OneByteString::GetOneByteBuffer() const
+    {
+        if (this->IsFinalized())
+        {
+            return nullptr;
+        }
+        return this->oneByteBuffer + this->oneByteOffset;
+    }
+
+    void OneByteString::CopyOneByte(__out_ecount(count) byte* buffer, charcount_t start, charcount_t count) const
+    {
+        Assert(!this->IsFinalized());
+        Assert(start + count <= this->GetLength());
+
+        js_memcpy_s(buffer, count, this->GetOneByteBuffer() + start, count);
+    }
+
+    int OneByteString::Compare(const OneByteString* other) const
+    {
+        Assert(!this->IsFinalized() && !other->IsFinalized());
+
+        const charcount_t length = this->GetLength();
+        const charcount_t otherLength = other->GetLength();
+
+        // Latin-1 bytes are code units, so byte order is the same as char16 order
+        const int result = memcmp(this->GetOneByteBuffer(), other->GetOneByteBuffer(), min(length, otherLength));
+        return (result == 0) ? (int)(length - otherLength) : result;
+    }
+
+    hash_t OneByteString::GetOneByteHashCode() const
+    {
+        Assert(!this->IsFinalized());
+
+        // Same as the hash of the widened characters
+        return JsUtil::CharacterBuffer<byte>::StaticGetHashCode(this->GetOneByteBuffer(), this->GetLength());
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        const charcount_t length = this->GetLength();
+        Recycler* recycler = this->GetScriptContext()->GetRecycler();
+        char16* target = RecyclerNewArrayLeaf(recycler, char16, this->SafeSzSize());
+        WidenOneByteChars(target, this->GetOneByteBuffer(), length);
+        target[length] = _u('\0');
+
+        this->SetBuffer(target);
+
+        // The byte buffer is no longer needed (unless it is shared with other strings)
+        this->oneByteBuffer = nullptr;
+        this->oneByteOffset = 0;
+        this->sharesBuffer = false;
+        this->externalBuffer = nullptr;
+
+#ifdef PROFILE_STRINGS
+        StringProfiler::RecordNewString(this->GetScriptContext(), this->UnsafeGetBuffer(), length);
+#endif
+
+        return this->UnsafeGetBuffer();
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());   // CopyVirtual should only be called for unfinalized buffers
+
+        // Widen straight into the destination, e.g. when flattening a concat tree, so that this string
+        // keeps its compact representation
+        WidenOneByteChars(buffer, this->GetOneByteBuffer(), this->GetLength());
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        if (this->IsFinalized())
+        {
+            return __super::GetAllocatedByteCount();
+        }
+        if (this->IsSubstring() || this->externalBuffer != nullptr)
+        {
+            return 0;
+        }
+        return this->GetLength() * sizeof(byte);
+    }
+
+    bool OneByteString::IsSubstring() const
+    {
+        return !this->IsFinalized() && this->sharesBuffer;
+    }
+
+    BOOL OneByteString::BufferEquals(__in_ecount(otherLength) LPCWSTR otherBuffer, __in charcount_t otherLength)
+    {
+        if (this->IsFinalized())
+        {
+            return __super::BufferEquals(otherBuffer, otherLength);
+        }
+
+        if (otherLength != this->GetLength())
+        {
+            return false;
+        }
+
+        const byte* oneByteChars = this->GetOneByteBuffer();
+        for (charcount_t i = 0; i < otherLength; i++)
+        {
+            if (static_cast<char16>(oneByteChars[i]) != otherBuffer[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool OneByteString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<OneByteString>::HasVirtualTable(RecyclableObject::FromVar(var));
+    }
+
+    OneByteString* OneByteString::TryFromVar(Var var)
+    {
+        return OneByteString::Is(var)
+            ? reinterpret_cast<OneByteString*>(var)
+            : nullptr;
+    }
+}
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Owner of the bytes of external one-byte strings, which the host allocated. It is referenced by
+    // every string that uses the bytes (including substrings), and releases them once it is collected.
+    class ExternalOneByteBuffer _ABSTRACT : public FinalizableObject
+    {
+    public:
+        virtual void Finalize(bool isShutdown) override {}
+        virtual void Mark(Recycler* recycler) override { AssertMsg(false, "Mark called on object that isn't TrackableObject"); }
+    };
+
+    // A string whose characters all fit in one byte (Latin-1), e.g. ASCII text created by the host.
+    // The characters are kept in a byte buffer, half the size of a char16 buffer, and are only widened
+    // when a flat char16 buffer is requested (GetString or GetSz). Until then, substrings share the byte
+    // buffer, concat trees copy the bytes straight into the flattened buffer, and comparisons, hashing
+    // and one-byte copies read the bytes directly.
+    // After widening, the string behaves like a LiteralString and the byte buffer is released.
+    // The byte buffer is either allocated by the recycler, or external (see ExternalOneByteBuffer), in
+    // which case the string is created without copying the bytes.
+    class OneByteString sealed : public JavascriptString
+    {
+    private:
+        Field(const byte*) oneByteBuffer;       // Start of the (possibly shared) byte buffer, keeps it alive
+        Field(charcount_t) oneByteOffset;       // Offset of this string's first character in oneByteBuffer
+        Field(bool) sharesBuffer;               // Substring of another one-byte string
+        Field(ExternalOneByteBuffer*) externalBuffer;   // Owner of oneByteBuffer if it is external
+
+        OneByteString(const byte* buffer, charcount_t offset, charcount_t length, bool sharesBuffer,
+            ExternalOneByteBuffer* externalBuffer, StaticType* type);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer,
+            StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+
+    public:
+        // Copies content; every byte is a Latin-1 character
+        static JavascriptString* New(__in_ecount(charLength) const byte* content, charcount_t charLength, ScriptContext* scriptContext);
+        // Does not copy content, which is owned by externalBuffer and must not change
+        static JavascriptString* NewExternal(__in_ecount(charLength) const byte* content, charcount_t charLength,
+            ExternalOneByteBuffer* externalBuffer, ScriptContext* scriptContext);
+        static JavascriptString* NewSubString(OneByteString* string, charcount_t start, charcount_t length);
+        static JavascriptString* Concat(OneByteString* left, OneByteString* right);
+
+        // Returns nullptr once the string has been widened
+        const byte* GetOneByteBuffer() const;
+
+        void CopyOneByte(__out_ecount(count) byte* buffer, charcount_t start, charcount_t count) const;
+        int Compare(const OneByteString* other) const;
+        hash_t GetOneByteHashCode() const;
+
+        virtual const char16* GetSz() override;
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual bool IsSubstring() const override;
+        virtual BOOL BufferEquals(__in_ecount(otherLength) LPCWSTR otherBuffer, __in charcount_t otherLength) override;
+
+        static bool Is(Var var);
+        static OneByteString* TryFromVar(Var var);
+
+        // Longest result for which concatenating two one-byte strings copies the bytes instead of
+        // creating a concat tree
+        static const charcount_t MaxCopyOnConcatLength = 256;
+    };
+}
@@ -20,6 +20,7 @@
 #include "Common/ByteSwap.h"
 #include "Library/DataView.h"
 
+#include "Library/JSON.h"
 #include "Library/JSONString.h"
 #include "Library/LazyJSONString.h"
 #include "Library/JSONStringBuilder.h"
@@ -46,7 +47,7 @@
 #include "Library/JavascriptGenerator.h"
 
 #include "Library/SameValueComparer.h"
-#include "Library/MapOrSetDataList.h"
+#include "Library/MapOrSetData.h"
 #include "Library/JavascriptMap.h"
 #include "Library/JavascriptSet.h"
 #include "Library/JavascriptWeakMap.h"
@@ -31,6 +31,13 @@ namespace Js
             return scriptContext->GetLibrary()->GetEmptyString();
         }
 
+        // Substrings of one-byte strings share their byte buffer instead of widening it
+        OneByteString* oneByteString = OneByteString::TryFromVar(string);
+        if (oneByteString != nullptr && !oneByteString->IsFinalized())
+        {
+            return OneByteString::NewSubString(oneByteString, start, length);
+        }
+
         Recycler* recycler = scriptContext->GetRecycler();
 
         AssertOrFailFast(string->GetLength() >= start + length);
@@ -1642,6 +1642,12 @@ namespace Js
         return newTypedArray;
     }
 
+    template <typename TypeName, bool clamped, bool virtualAllocated>
+    bool TypedArray<TypeName, clamped, virtualAllocated>::TrySortNumeric(NumericSortOrder order, bool isDefaultOrder)
+    {
+        return JavascriptArray::TrySortNumeric<TypeName>(reinterpret_cast<TypeName*>(buffer), GetLength(), order, isDefaultOrder);
+    }
+
     // %TypedArray%.from as described in ES6.0 (draft 22) Section 22.2.2.1
     Var TypedArrayBase::EntryFrom(RecyclableObject* function, CallInfo callInfo, ...)
     {
@@ -2472,6 +2478,13 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        // Without a comparer, or with one that just subtracts, sort by value without any callbacks
+        NumericSortOrder order = compareFn == nullptr ? NumericSortOrder_Ascending : JavascriptArray::GetNumericSortOrder(compareFn, scriptContext);
+        if (order != NumericSortOrder_None && typedArrayBase->TrySortNumeric(order, compareFn == nullptr /* isDefaultOrder */))
+        {
+            return typedArrayBase;
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
@@ -3632,6 +3645,12 @@ namespace Js
         JavascriptError::ThrowTypeError(GetScriptContext(), JSERR_This_NeedTypedArray);
     }
 
+    inline bool CharArray::TrySortNumeric(NumericSortOrder order, bool isDefaultOrder)
+    {
+        // char16 isn't a distinct type on every platform, so sort the code units as uint16
+        return JavascriptArray::TrySortNumeric<uint16>(reinterpret_cast<uint16*>(buffer), GetLength(), order, isDefaultOrder);
+    }
+
     inline CharArray* CharArray::FromVar(Var aValue)
     {
         AssertOrFailFastMsg(CharArray::Is(aValue), "invalid CharArray");
@@ -200,6 +200,10 @@ namespace Js
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
 
+        // Sorts the elements by value without calling a comparer. Returns false if they are left for the
+        // generic sort.
+        virtual bool TrySortNumeric(NumericSortOrder order, bool isDefaultOrder) = 0;
+
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         Field(int32) BYTES_PER_ELEMENT;
         Field(uint32) byteOffset;
@@ -261,6 +265,7 @@ namespace Js
         static Var EntrySet(RecyclableObject* function, CallInfo callInfo, ...);
 
         Var Subarray(uint32 begin, uint32 end);
+        bool TrySortNumeric(NumericSortOrder order, bool isDefaultOrder);
 
         static BOOL Is(Var aValue);
         static TypedArray<TypeName, clamped, virtualAllocated>* FromVar(Var aValue);
@@ -545,6 +550,7 @@ namespace Js
         static BOOL Is(Var aValue);
 
         Var Subarray(uint32 begin, uint32 end);
+        bool TrySortNumeric(NumericSortOrder order, bool isDefaultOrder);
         static CharArray* FromVar(Var aValue);
         static CharArray* UnsafeFromVar(Var aValue);
 
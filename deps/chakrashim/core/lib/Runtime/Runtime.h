@@ -515,6 +515,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Library/CompoundString.h"
 #include "Library/PropertyString.h"
 #include "Library/SingleCharString.h"
+#include "Library/OneByteString.h"
 
 #include "Library/JavascriptTypedNumber.h"
 #include "Library/SparseArraySegment.h"
@@ -198,7 +198,7 @@ namespace Js
 
 namespace JSON
 {
-    class JSONParser;
+    template <typename EncodedChar> class JSONParser;
 }
 
 //
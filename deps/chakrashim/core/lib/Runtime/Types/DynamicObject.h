@@ -74,7 +74,7 @@ namespace Js
         friend class PathTypeHandlerNoAttr;
         friend class JavascriptLibrary;  // for ReplaceType
         friend class ScriptFunction; // for ReplaceType;
-        friend class JSON::JSONParser; //for ReplaceType
+        template <typename EncodedChar> friend class JSON::JSONParser; //for ReplaceType
         friend class ModuleNamespace; // for slot setting.
 
 #if ENABLE_OBJECT_SOURCE_TRACKING
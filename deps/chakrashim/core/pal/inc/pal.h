@@ -3259,6 +3259,7 @@ SetErrorMode(
 #define MEM_TOP_DOWN                    0x100000
 #define MEM_WRITE_WATCH                 0x200000
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
+#define MEM_RESERVE_HUGEPAGES           0x10000000 // hint that committed pages may be backed by transparent huge pages
 
 PALIMPORT
 HANDLE
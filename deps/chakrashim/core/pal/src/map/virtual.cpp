@@ -1191,6 +1191,15 @@ static LPVOID VIRTUALCommitMemory(
                     temp += VIRTUAL_PAGE_SIZE;
                 }
 #endif // MMAP_DOESNOT_ALLOW_REMAP
+#ifdef MADV_HUGEPAGE
+                if ((pInformation->allocationType & MEM_RESERVE_HUGEPAGES) != 0)
+                {
+                    // Committing maps new pages over the reservation, so the
+                    // hint is given for every commit. It is only a hint: if
+                    // it fails, the pages just stay at the base page size.
+                    madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE);
+                }
+#endif // MADV_HUGEPAGE
             }
             else
             {
@@ -1261,6 +1270,82 @@ static LPVOID VIRTUALCommitMemory(
     return pRetVal;
 }
 
+/******
+ *
+ *  VIRTUALResetMemory() - Helper function for MEM_RESET. Tells the OS
+ *  that the contents of committed pages are no longer needed, so it can
+ *  reclaim them without writing them out. The pages stay committed and
+ *  accessible, and read back either as their old contents or as zeros.
+ *
+ *  MADV_FREE reclaims lazily, only under memory pressure, and pages that
+ *  are written again before that keep their frames. Kernels that don't
+ *  support it fail with EINVAL, in which case MADV_DONTNEED is used,
+ *  which drops the pages right away.
+ *
+ */
+static LPVOID VIRTUALResetMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN LPVOID lpAddress,        /* Region to reset */
+                IN SIZE_T dwSize)           /* Size of Region */
+{
+    UINT_PTR StartBoundary;
+    SIZE_T MemSize;
+    PCMI pInformation;
+    SIZE_T runStart;
+    SIZE_T index;
+
+    StartBoundary = (UINT_PTR)lpAddress & ~VIRTUAL_PAGE_MASK;
+    MemSize = ( ((UINT_PTR)lpAddress + dwSize + VIRTUAL_PAGE_MASK) & ~VIRTUAL_PAGE_MASK ) -
+              StartBoundary;
+
+    pInformation = VIRTUALFindRegionInformation( StartBoundary );
+    if ( !pInformation )
+    {
+        ERROR( "Trying to reset memory that was not reserved.\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+        return NULL;
+    }
+
+    runStart = (StartBoundary - pInformation->startBoundary) / VIRTUAL_PAGE_SIZE;
+    if ( MemSize / VIRTUAL_PAGE_SIZE > pInformation->memSize / VIRTUAL_PAGE_SIZE - runStart )
+    {
+        ERROR( "Trying to reset beyond the end of the region!\n" );
+        pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+        return NULL;
+    }
+
+    for ( index = runStart; index < runStart + MemSize / VIRTUAL_PAGE_SIZE; index++ )
+    {
+        if ( !VIRTUALIsPageCommitted( index, pInformation ) )
+        {
+            ERROR( "Trying to reset memory that was not committed.\n" );
+            pthrCurrent->SetLastError( ERROR_INVALID_ADDRESS );
+            return NULL;
+        }
+    }
+
+#ifdef MADV_FREE
+    if ( madvise( (void *) StartBoundary, MemSize, MADV_FREE ) == 0 )
+    {
+        return lpAddress;
+    }
+    if ( errno != EINVAL )
+    {
+        ERROR( "madvise(MADV_FREE) failed! Error(%d)=%s\n", errno, strerror(errno) );
+        pthrCurrent->SetLastError( ERROR_INTERNAL_ERROR );
+        return NULL;
+    }
+#endif // MADV_FREE
+
+    if ( madvise( (void *) StartBoundary, MemSize, MADV_DONTNEED ) != 0 )
+    {
+        ERROR( "madvise(MADV_DONTNEED) failed! Error(%d)=%s\n", errno, strerror(errno) );
+        pthrCurrent->SetLastError( ERROR_INTERNAL_ERROR );
+        return NULL;
+    }
+    return lpAddress;
+}
+
 #if MMAP_IGNORES_HINT
 /*++
 Function:
@@ -1632,11 +1717,27 @@ VirtualAlloc_(
         goto done;
     }
 
+    if ( flAllocationType & MEM_RESET )
+    {
+        if ( flAllocationType != MEM_RESET )
+        {
+            ASSERT( "MEM_RESET cannot be combined with other flags.\n" );
+            pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
+            goto done;
+        }
+
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        pRetVal = VIRTUALResetMemory( pthrCurrent, lpAddress, dwSize );
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+        goto done;
+    }
+
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE |
+                                 MEM_RESERVE_HUGEPAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, or MEM_RESERVE_HUGEPAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -1716,9 +1817,12 @@ VirtualAlloc(
 
     if (reserve || commit)
     {
-        char *address = (char*) VirtualAlloc_(nullptr, dwSize, MEM_RESERVE, flProtect);
+        // The hint is recorded with the reservation and applies to later commits
+        DWORD reserveType = MEM_RESERVE | (flAllocationType & MEM_RESERVE_HUGEPAGES);
+        char *address = (char*) VirtualAlloc_(nullptr, dwSize, reserveType, flProtect);
         if (!address) return nullptr;
 
+        flAllocationType &= ~MEM_RESERVE_HUGEPAGES;
         if (reserve)
         {
             flAllocationType &= ~MEM_RESERVE;
@@ -1731,12 +1835,12 @@ VirtualAlloc(
             char *addr64 = address + (KB64 - diff);
 
             // try reserving from the same address space
-            address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+            address = (char*) VirtualAlloc_(addr64, dwSize, reserveType, flProtect);
 
             if (!address)
             {   // looks like ``pushed new address + dwSize`` is not available
                 // try on a bigger surface
-                address = (char*) VirtualAlloc_(nullptr, dwSize + KB64, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(nullptr, dwSize + KB64, reserveType, flProtect);
                 if (!address) return nullptr;
 
                 diff = ((ULONG_PTR)address % KB64);
@@ -1745,7 +1849,7 @@ VirtualAlloc(
                 CPalThread *pthrCurrent = InternalGetCurrentThread();
                 InternalEnterCriticalSection(pthrCurrent, &virtual_realloc);
                 VirtualFree(address, 0, MEM_RELEASE);
-                address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(addr64, dwSize, reserveType, flProtect);
                 InternalLeaveCriticalSection(pthrCurrent, &virtual_realloc);
 
                 if (!address) return nullptr;
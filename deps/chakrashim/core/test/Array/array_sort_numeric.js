@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Sorts by value that skip the comparer (native arrays and typed arrays sorted with a comparer that
+// subtracts, and typed arrays sorted without a comparer) must match sorts that call the comparer.
+
+function check(actual, expected, message) {
+    if (actual.length !== expected.length) {
+        throw new Error(message + ": length " + actual.length + " !== " + expected.length);
+    }
+    for (var i = 0; i < expected.length; i++) {
+        if (!Object.is(actual[i], expected[i])) {
+            throw new Error(message + ": [" + i + "] " + actual[i] + " !== " + expected[i]);
+        }
+    }
+}
+
+// Not recognized, so always called
+function ascending(a, b) { var d = a - b; return d; }
+function descending(a, b) { var d = b - a; return d; }
+
+var seed = 1;
+function random() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed;
+}
+
+function ints(length, range) {
+    var a = [];
+    for (var i = 0; i < length; i++) {
+        a.push((random() % range) - (range >> 1));
+    }
+    return a;
+}
+
+function doubles(length) {
+    var a = [];
+    for (var i = 0; i < length; i++) {
+        a.push(((random() % 20000) - 10000) / 7);
+    }
+    return a;
+}
+
+[0, 1, 2, 10, 63, 64, 65, 500, 5000].forEach(function (length) {
+    var a = ints(length, 1000);
+    check(a.slice().sort((x, y) => x - y), a.slice().sort(ascending), "int (x, y) => x - y, length " + length);
+    check(a.slice().sort((x, y) => y - x), a.slice().sort(descending), "int (x, y) => y - x, length " + length);
+    check(a.slice().sort(function (x, y) { return x - y; }), a.slice().sort(ascending), "int function, length " + length);
+    check(a.slice().sort((x, y) => { return y - x }), a.slice().sort(descending), "int block, length " + length);
+
+    var big = ints(length, 0x7fffffff);
+    check(big.slice().sort((x, y) => x - y), big.slice().sort(ascending), "wide int, length " + length);
+
+    var d = doubles(length);
+    check(d.slice().sort((x, y) => x - y), d.slice().sort(ascending), "double, length " + length);
+    check(d.slice().sort((x, y) => y - x), d.slice().sort(descending), "double descending, length " + length);
+});
+
+// -0 and +0 compare equal, so their order is kept
+var zeros = [1.5, 0, -0, -1.5, -0, 0];
+check(zeros.sort((x, y) => x - y), [-1.5, 0, -0, -0, 0, 1.5], "zeros");
+
+// Arrays with missing values take their values from the prototype
+var holes = [3, , 1, 2];
+Array.prototype[1] = 0;
+check(holes.sort((x, y) => x - y), [0, 1, 2, 3], "holes");
+delete Array.prototype[1];
+
+// A line break after return returns undefined, so nothing is sorted by value
+var unsorted = [3, 1, 2];
+unsorted.sort(function (x, y) { return
+    x - y; });
+check(unsorted.length, 3, "return with line break");
+
+// Typed arrays sort by value without a comparer, with -0 before +0 and NaNs last
+[Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array].forEach(function (TypedArray) {
+    [0, 1, 10, 64, 1000].forEach(function (length) {
+        var values = ints(length, 0x7fffffff);
+        var expected = Array.from(new TypedArray(values)).sort(ascending);
+        check(new TypedArray(values).sort(), expected, TypedArray.name + " default, length " + length);
+        check(new TypedArray(values).sort((x, y) => x - y), expected, TypedArray.name + " ascending, length " + length);
+        check(new TypedArray(values).sort((x, y) => y - x), expected.reverse(), TypedArray.name + " descending, length " + length);
+    });
+});
+
+[Float32Array, Float64Array].forEach(function (TypedArray) {
+    [10, 100].forEach(function (length) {
+        var values = doubles(length).concat([NaN, 0, -0, Infinity, -Infinity, NaN, -0]);
+        var sorted = new TypedArray(values).sort();
+        var expected = Array.from(new TypedArray(values)).filter(x => x === x).sort(function (x, y) {
+            return x - y || (Object.is(x, -0) ? -1 : 0) + (Object.is(y, -0) ? 1 : 0);
+        }).concat([NaN, NaN]);
+        check(sorted, expected, TypedArray.name + " default, length " + length);
+    });
+});
+
+WScript.Echo("pass");
@@ -819,6 +819,47 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+
+    {
+        name: "Iterators should keep their position when the map's storage is compacted, grown or shrunk",
+        body: function() {
+            var map = new Map();
+            var i;
+            for (i = 0; i < 1000; i++) {
+                map.set(i, i * 2);
+            }
+
+            var iterator = map.entries();
+            for (i = 0; i < 100; i++) {
+                assert.areEqual([i, i * 2], iterator.next().value, "entries are visited in insertion order");
+            }
+
+            // Deleting most entries shrinks the map, and adding more grows it again
+            for (i = 0; i < 990; i++) {
+                map.delete(i);
+            }
+            assert.areEqual(10, map.size, "990 of the 1000 entries were deleted");
+            for (i = 1000; i < 3000; i++) {
+                map.set(i, i * 2);
+            }
+
+            for (i = 990; i < 3000; i++) {
+                assert.areEqual([i, i * 2], iterator.next().value, "iteration continues after the deleted entries and visits the new ones");
+            }
+            assert.isTrue(iterator.next().done, "all entries were visited");
+
+            iterator = map.keys();
+            assert.areEqual(990, iterator.next().value, "a new iterator starts at the first entry");
+            map.clear();
+            for (i = 0; i < 100; i++) {
+                map.set("key" + i, i);
+            }
+            for (i = 0; i < 100; i++) {
+                assert.areEqual("key" + i, iterator.next().value, "iteration continues with the entries added after clear");
+            }
+            assert.isTrue(iterator.next().done, "all entries added after clear were visited");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -742,6 +742,39 @@ var tests = [
             assert.isTrue(set.has(value), "1.0 should be equal to the value 1 and set has it");
         }
     },
+
+    {
+        name: "Iterators should keep their position when the set's storage is compacted, grown or shrunk",
+        body: function() {
+            var set = new Set();
+            var i;
+            for (i = 0; i < 1000; i++) {
+                set.add(i);
+            }
+
+            var iterator = set.values();
+            for (i = 0; i < 100; i++) {
+                assert.areEqual(i, iterator.next().value, "values are visited in insertion order");
+            }
+
+            // Deleting every other value leaves holes that are dropped when the set runs out of room
+            for (i = 0; i < 1000; i += 2) {
+                set.delete(i);
+            }
+            for (i = 1000; i < 3000; i++) {
+                set.add(i);
+            }
+
+            for (i = 101; i < 1000; i += 2) {
+                assert.areEqual(i, iterator.next().value, "deleted values are skipped");
+            }
+            for (i = 1000; i < 3000; i++) {
+                assert.areEqual(i, iterator.next().value, "values added during iteration are visited");
+            }
+            assert.isTrue(iterator.next().done, "all values were visited");
+            assert.areEqual(2500, set.size, "500 of the first 1000 values were deleted");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -100,6 +100,8 @@ class PropertyDescriptor;
 
 namespace jsrt {
 class IsolateShim;
+class LocalHandleStack;
+struct LocalHandleBlock;
 
 JsErrorCode CreateV8PropertyDescriptor(JsValueRef descriptor,
   v8::PropertyDescriptor* result);
@@ -602,16 +604,19 @@ class PersistentBase {
   template<class F1, class F2> friend class Persistent;
   template <class F> friend class Global;
 
-  explicit V8_INLINE PersistentBase(T* val)
-      : val_(val), _weakWrapper(nullptr) {}
+  explicit V8_INLINE PersistentBase(T* val, JsGlobalHandle handle = nullptr)
+      : val_(val), _handle(handle), _weakWrapper(nullptr) {}
   PersistentBase(PersistentBase& other) = delete;  // NOLINT
   void operator=(PersistentBase&) = delete;
-  V8_INLINE static T* New(Isolate* isolate, T* that);
+  V8_INLINE static JsGlobalHandle New(Isolate* isolate, T* that);
 
   template <typename P, typename Callback>
   void SetWeakCommon(P* parameter, Callback callback);
 
   T* val_;
+  // Global handle keeping val_ alive while strong. nullptr if val_ was
+  // JsAddRef'ed instead, or is a weak copy of another persistent.
+  JsGlobalHandle _handle;
   chakrashim::WeakReferenceCallbackWrapper* _weakWrapper;
 };
 
@@ -651,13 +656,13 @@ class Persistent : public PersistentBase<T> {
 
   template <class S>
   V8_INLINE Persistent(Isolate* isolate, Handle<S> that)
-      : PersistentBase<T>(PersistentBase<T>::New(isolate, *that)) {
+      : PersistentBase<T>(*that, PersistentBase<T>::New(isolate, *that)) {
     TYPE_CHECK(T, S);
   }
 
   template <class S, class M2>
   V8_INLINE Persistent(Isolate* isolate, const Persistent<S, M2>& that)
-    : PersistentBase<T>(PersistentBase<T>::New(isolate, *that)) {
+    : PersistentBase<T>(*that, PersistentBase<T>::New(isolate, *that)) {
     TYPE_CHECK(T, S);
   }
 
@@ -709,7 +714,7 @@ class Persistent : public PersistentBase<T> {
   friend class PromiseResolverData;
 
   V8_INLINE Persistent(T* that)
-    : PersistentBase<T>(PersistentBase<T>::New(nullptr, that)) { }
+    : PersistentBase<T>(that, PersistentBase<T>::New(nullptr, that)) { }
 
   V8_INLINE T* operator*() const { return this->val_; }
   V8_INLINE T* operator->() const { return this->val_; }
@@ -735,19 +740,21 @@ class Global : public PersistentBase<T> {
 
   template <class S>
   V8_INLINE Global(Isolate* isolate, Handle<S> that)
-    : PersistentBase<T>(PersistentBase<T>::New(isolate, *that)) {
+    : PersistentBase<T>(*that, PersistentBase<T>::New(isolate, *that)) {
     TYPE_CHECK(T, S);
   }
 
   template <class S>
   V8_INLINE Global(Isolate* isolate, const PersistentBase<S>& that)
-    : PersistentBase<T>(PersistentBase<T>::New(isolate, that.val_)) {
+    : PersistentBase<T>(that.val_, PersistentBase<T>::New(isolate, that.val_)) {
     TYPE_CHECK(T, S);
   }
 
-  V8_INLINE Global(Global&& other) : PersistentBase<T>(other.val_) {
+  V8_INLINE Global(Global&& other)
+      : PersistentBase<T>(other.val_, other._handle) {
     this->_weakWrapper = other._weakWrapper;
     other.val_ = nullptr;
+    other._handle = nullptr;
     other._weakWrapper = nullptr;
   }
 
@@ -759,8 +766,10 @@ class Global : public PersistentBase<T> {
     if (this != &rhs) {
       this->Reset();
       this->val_ = rhs.val_;
+      this->_handle = rhs._handle;
       this->_weakWrapper = rhs._weakWrapper;
       rhs.val_ = nullptr;
+      rhs._handle = nullptr;
       rhs._weakWrapper = nullptr;
     }
     return *this;
@@ -819,14 +828,16 @@ class V8_EXPORT HandleScope {
  private:
   friend class EscapableHandleScope;
   template <class T> friend class Local;
-  static const int kOnStackLocals = 8;  // Arbitrary number of refs on stack
-
   HandleScope *_prev;
 
-  // Save some refs on stack. 1st element on stack
-  // is the JavascriptArray where other refs go.
-  JsValueRef _locals[kOnStackLocals + 1];
-  int _count;
+  // Locals go on the isolate's handle stack; this is its position when the
+  // scope was entered, which the scope resets it to on exit.
+  jsrt::LocalHandleStack *_handleStack;
+  jsrt::LocalHandleBlock *_handleBlock;
+  JsValueRef *_handleTop;
+
+  // Value escaped to _prev, added to it once this scope's locals are released
+  JsValueRef _escapedValue;
   JsContextRef _contextRef;
   struct AddRefRecord {
     JsRef _ref;
@@ -836,6 +847,7 @@ class V8_EXPORT HandleScope {
   bool AddLocal(JsValueRef value);
   bool AddLocalContext(JsContextRef value);
   bool AddLocalAddRef(JsRef value);
+  bool Escape(JsValueRef value);
 
   static HandleScope *GetCurrent();
 
@@ -930,21 +942,36 @@ class V8_EXPORT Script {
 class V8_EXPORT ScriptCompiler {
  public:
   struct CachedData {
-    // CHAKRA-TODO: Not implemented
     enum BufferPolicy {
       BufferNotOwned,
       BufferOwned
     };
 
+    CachedData()
+      : data(nullptr), length(0), rejected(false),
+        buffer_policy(BufferNotOwned) {
+    }
+
+    CachedData(const uint8_t* data, int length,
+               BufferPolicy buffer_policy = BufferNotOwned)
+      : data(data), length(length), rejected(false),
+        buffer_policy(buffer_policy) {
+    }
+
+    ~CachedData() {
+      if (buffer_policy == BufferOwned) {
+        delete[] data;
+      }
+    }
+
     const uint8_t* data;
     int length;
-    bool rejected = true;
+    bool rejected;
     BufferPolicy buffer_policy;
 
-    CachedData();
-    CachedData(const uint8_t* data, int length,
-               BufferPolicy buffer_policy = BufferNotOwned) {
-    }
+   private:
+    CachedData(const CachedData&);
+    CachedData& operator=(const CachedData&);
   };
 
   class Source {
@@ -953,20 +980,29 @@ class V8_EXPORT ScriptCompiler {
       Local<String> source_string,
       const ScriptOrigin& origin,
       CachedData * cached_data = nullptr)
-      : source_string(source_string), resource_name(origin.ResourceName()) {
+      : source_string(source_string), resource_name(origin.ResourceName()),
+        cached_data(cached_data) {
     }
 
     Source(Local<String> source_string,  // NOLINT(runtime/explicit)
            CachedData * cached_data = nullptr)
-      : source_string(source_string) {
+      : source_string(source_string), cached_data(cached_data) {
     }
 
-    const CachedData* GetCachedData() const { return nullptr; }
+    ~Source() {
+      delete cached_data;
+    }
+
+    const CachedData* GetCachedData() const { return cached_data; }
 
    private:
     friend ScriptCompiler;
+    Source(const Source&);
+    Source& operator=(const Source&);
+
     Local<String> source_string;
     Handle<Value> resource_name;
+    CachedData* cached_data;
   };
 
   enum CompileOptions {
@@ -999,9 +1035,7 @@ class V8_EXPORT ScriptCompiler {
     Isolate* isolate, Source* source);
 
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script,
-                                     Local<String> source) {
-    return nullptr;
-  }
+                                     Local<String> source);
 };
 
 class V8_EXPORT Message {
@@ -1229,8 +1263,8 @@ class V8_EXPORT String : public Name {
 
   int Length() const;
   int Utf8Length() const;
-  bool IsOneByte() const { return false; }
-  bool ContainsOnlyOneByte() const { return false; }
+  bool IsOneByte() const;
+  bool ContainsOnlyOneByte() const;
 
   enum WriteOptions {
     NO_OPTIONS = 0,
@@ -2176,6 +2210,30 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
     Local<Context> context, Local<Object> json_object,
     Local<String> gap = Local<String>());
+
+  // Not part of the V8 API: parses UTF-8 text without first creating a
+  // string from it.
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> ParseUtf8(
+    Local<Context> context, const char* data, size_t length);
+
+  // Not part of the V8 API: reads the UTF-8 text of
+  // JSON.stringify(value, undefined, gap) a part at a time, without creating
+  // it as a string.
+  class V8_EXPORT Utf8Reader {
+   public:
+    virtual ~Utf8Reader() {}
+
+    // Writes the next part of the text to |buffer|, which must hold at least
+    // 4 bytes, without ending in the middle of a character. Returns the
+    // number of bytes written, which is only 0 once all of the text has been
+    // read. No script is run.
+    virtual size_t Read(char* buffer, size_t size) = 0;
+  };
+
+  // Any script run by the serialization runs here. The reader is owned by
+  // the caller and is nullptr when JSON.stringify would return undefined.
+  static V8_WARN_UNUSED_RESULT Maybe<Utf8Reader*> NewUtf8Reader(
+    Local<Context> context, Local<Value> value, Local<Value> gap);
 };
 
 class V8_EXPORT ValueSerializer {
@@ -2627,12 +2685,17 @@ class V8_EXPORT HeapStatistics {
 
 class V8_EXPORT HeapSpaceStatistics {
  public:
-  HeapSpaceStatistics() {}
-  const char* space_name() { return ""; }
-  size_t space_size() { return 0; }
-  size_t space_used_size() { return 0; }
-  size_t space_available_size() { return 0; }
-  size_t physical_space_size() { return 0; }
+  HeapSpaceStatistics()
+    : space_name_(""),
+      space_size_(0),
+      space_used_size_(0),
+      space_available_size_(0),
+      physical_space_size_(0) {}
+  const char* space_name() { return space_name_; }
+  size_t space_size() { return space_size_; }
+  size_t space_used_size() { return space_used_size_; }
+  size_t space_available_size() { return space_available_size_; }
+  size_t physical_space_size() { return physical_space_size_; }
 
  private:
   const char* space_name_;
@@ -2846,6 +2909,18 @@ class V8_EXPORT V8 {
   static void FromJustIsNothing();
   static void ToLocalEmpty();
   static void ShutdownPlatform() {}
+
+  // Not part of the V8 API: dynamic profiles are cached in |directory| across
+  // processes, so hot functions are JIT'd right away when a script runs
+  // again. Must be called before any isolate is created.
+  static bool SetProfileCacheDirectory(const char* directory);
+  // Not part of the V8 API: saves the profiles of the scripts run in the
+  // current context to the profile cache directory.
+  static void SaveProfileCache();
+  // Not part of the V8 API: options for the pages of the garbage collected
+  // heap, see JsSetRecyclerPageOptions. Must be called before any isolate is
+  // created.
+  static bool SetRecyclerPageOptions(bool huge_pages, bool idle_reset_pages);
 };
 
 template <class T>
@@ -3107,11 +3182,14 @@ Local<T> MaybeLocal<T>::ToLocalChecked() {
 //
 
 template <class T>
-T* PersistentBase<T>::New(Isolate* isolate, T* that) {
-  if (that) {
+JsGlobalHandle PersistentBase<T>::New(Isolate* isolate, T* that) {
+  JsGlobalHandle handle = nullptr;
+  if (that &&
+      JsCreateGlobalHandle(static_cast<JsRef>(that), false, &handle) !=
+          JsNoError) {
     JsAddRef(static_cast<JsRef>(that), nullptr);
   }
-  return that;
+  return handle;
 }
 
 template <class T, class M>
@@ -3124,7 +3202,7 @@ void Persistent<T, M>::Copy(const Persistent<S, M2>& that) {
   this->val_ = that.val_;
   this->_weakWrapper = that._weakWrapper;
   if (this->val_ && !this->IsWeak()) {
-    JsAddRef(this->val_, nullptr);
+    this->_handle = New(nullptr, this->val_);
   }
 
   M::Copy(that, this);
@@ -3150,10 +3228,15 @@ void PersistentBase<T>::Reset() {
       delete _weakWrapper;
       _weakWrapper = nullptr;
     }
-  } else {
+  } else if (_handle == nullptr) {
     JsRelease(val_, nullptr);
   }
 
+  if (_handle != nullptr) {
+    JsReleaseGlobalHandle(_handle);
+    _handle = nullptr;
+  }
+
   val_ = nullptr;
 }
 
@@ -3163,7 +3246,8 @@ void PersistentBase<T>::Reset(Isolate* isolate, const Handle<S>& other) {
   TYPE_CHECK(T, S);
   Reset();
   if (other.IsEmpty()) return;
-  this->val_ = New(isolate, other.val_);
+  this->val_ = other.val_;
+  this->_handle = New(isolate, other.val_);
 }
 
 template <class T>
@@ -3173,7 +3257,8 @@ void PersistentBase<T>::Reset(Isolate* isolate,
   TYPE_CHECK(T, S);
   Reset();
   if (other.IsEmpty()) return;
-  this->val_ = New(isolate, other.val_);
+  this->val_ = other.val_;
+  this->_handle = New(isolate, other.val_);
 }
 
 template <class T>
@@ -3185,7 +3270,11 @@ void PersistentBase<T>::SetWeakCommon(P* parameter, Callback callback) {
   chakrashim::SetObjectWeakReferenceCallback(val_, callback, parameter,
                                              &_weakWrapper);
   if (wasStrong) {
-    JsRelease(val_, nullptr);
+    if (_handle != nullptr) {
+      JsSetGlobalHandleWeak(_handle, true);
+    } else {
+      JsRelease(val_, nullptr);
+    }
   }
 }
 
@@ -3219,7 +3308,14 @@ P* PersistentBase<T>::ClearWeak() {
     _weakWrapper = nullptr;
   }
 
-  JsAddRef(val_, nullptr);
+  if (_handle != nullptr &&
+      JsSetGlobalHandleWeak(_handle, false) != JsNoError) {
+    JsReleaseGlobalHandle(_handle);
+    _handle = nullptr;
+  }
+  if (_handle == nullptr) {
+    JsAddRef(val_, nullptr);
+  }
   return parameters;
 }
 
@@ -3238,7 +3334,7 @@ void PersistentBase<T>::SetWrapperClassId(uint16_t class_id) {
 
 template <class T>
 Local<T> HandleScope::Close(Handle<T> value) {
-  if (_prev == nullptr || !_prev->AddLocal(*value)) {
+  if (_prev == nullptr || !Escape(*value)) {
     return Local<T>();
   }
 
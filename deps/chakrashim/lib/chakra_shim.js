@@ -394,9 +394,6 @@
     };
   }
 
-  // Simulate v8 micro tasks queue
-  const microTasks = [];
-
   function patchUtils(utils) {
     const isUintRegex = /^(0|[1-9]\d*)$/;
 
@@ -609,14 +606,6 @@
 
     utils.ensureDebug = ensureDebug;
 
-    utils.enqueueMicrotask = function(task) {
-      microTasks.push(task);
-    };
-
-    utils.dequeueMicrotask = function(task) {
-      return microTasks.shift();
-    };
-
     utils.isProxy = function(value) {
       // CHAKRA-TODO: Need to add JSRT API to detect this
       return false;
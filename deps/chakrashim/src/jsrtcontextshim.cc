@@ -58,7 +58,7 @@ ContextShim * ContextShim::New(IsolateShim * isolateShim, bool exposeGC,
     return nullptr;
   }
 
-  return new ContextShim(isolateShim, context, exposeGC,
+  return new ContextShim(isolateShim, context, exposeGC, useGlobalTTState,
                          globalObjectTemplateInstance);
 }
 
@@ -67,6 +67,7 @@ ContextShim * ContextShim::New(IsolateShim * isolateShim, bool exposeGC,
 ContextShim::ContextShim(IsolateShim * isolateShim,
                          JsContextRef context,
                          bool exposeGC,
+                         bool useGlobalTTState,
                          JsValueRef globalObjectTemplateInstance)
     : isolateShim(isolateShim),
       context(context),
@@ -80,6 +81,7 @@ ContextShim::ContextShim(IsolateShim * isolateShim,
       zero(JS_INVALID_REFERENCE),
       globalObject(JS_INVALID_REFERENCE),
       proxyOfGlobal(JS_INVALID_REFERENCE),
+      microtaskQueue(isolateShim, useGlobalTTState),
 #include "jsrtcachedpropertyidref.inc"
 #undef DEF_IS_TYPE
       cloneObjectFunction(JS_INVALID_REFERENCE),
@@ -95,8 +97,6 @@ ContextShim::ContextShim(IsolateShim * isolateShim,
       getSymbolKeyForFunction(JS_INVALID_REFERENCE),
       getSymbolForFunction(JS_INVALID_REFERENCE),
       ensureDebugFunction(JS_INVALID_REFERENCE),
-      enqueueMicrotaskFunction(JS_INVALID_REFERENCE),
-      dequeueMicrotaskFunction(JS_INVALID_REFERENCE),
       getPropertyAttributesFunction(JS_INVALID_REFERENCE),
       getOwnPropertyNamesFunction(JS_INVALID_REFERENCE),
       jsonParseFunction(JS_INVALID_REFERENCE),
@@ -484,21 +484,17 @@ void ContextShim::SetAlignedPointerInEmbedderData(int index, void * value) {
   }
 }
 
-void ContextShim::RunMicrotasks() {
-  JsValueRef dequeueMicrotaskFunction = GetdequeueMicrotaskFunction();
+void ContextShim::EnqueueMicrotask(JsValueRef task) {
+  CHAKRA_VERIFY(microtaskQueue.Enqueue(task));
+}
 
-  for (;;) {
-    JsValueRef task;
-    if (jsrt::CallFunction(dequeueMicrotaskFunction, &task) != JsNoError ||
-      reinterpret_cast<v8::Value*>(task)->IsUndefined()) {
-      break;
-    }
+void ContextShim::EnqueueMicrotask(MicrotaskQueue::NativeCallback callback,
+                                   void * data) {
+  CHAKRA_VERIFY(microtaskQueue.Enqueue(callback, data));
+}
 
-    JsValueRef notUsed;
-    if (jsrt::CallFunction(task, &notUsed) != JsNoError) {
-      JsGetAndClearException(&notUsed);  // swallow any exception from task
-    }
-  }
+void ContextShim::RunMicrotasks() {
+  microtaskQueue.Run();
 }
 
 // check initialization state first instead of calling
@@ -615,8 +611,6 @@ CHAKRASHIM_FUNCTION_GETTER(getStackTrace)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor)
 CHAKRASHIM_FUNCTION_GETTER(getSymbolFor)
 CHAKRASHIM_FUNCTION_GETTER(ensureDebug)
-CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
 CHAKRASHIM_FUNCTION_GETTER(getPropertyAttributes);
 CHAKRASHIM_FUNCTION_GETTER(getOwnPropertyNames);
 CHAKRASHIM_FUNCTION_GETTER(jsonParse);
@@ -97,13 +97,15 @@ class ContextShim {
 
   void * GetAlignedPointerFromEmbedderData(int index);
   void SetAlignedPointerInEmbedderData(int index, void * value);
+  void EnqueueMicrotask(JsValueRef task);
+  void EnqueueMicrotask(MicrotaskQueue::NativeCallback callback, void * data);
   void RunMicrotasks();
 
   static ContextShim * GetCurrent();
 
  private:
   ContextShim(IsolateShim * isolateShim, JsContextRef context, bool exposeGC,
-              JsValueRef globalObjectTemplateInstance);
+              bool useGlobalTTState, JsValueRef globalObjectTemplateInstance);
   bool DoInitializeContextShim();
   bool InitializeBuiltIns();
   bool InitializeProxyOfGlobal();
@@ -138,6 +140,7 @@ class ContextShim {
 
   JsValueRef globalPrototypeFunction[GlobalPrototypeFunction::_FunctionCount];
   std::vector<void*> embedderData;
+  MicrotaskQueue microtaskQueue;
 
 #define DECLARE_CHAKRASHIM_FUNCTION_GETTER(F) \
  public: \
@@ -162,8 +165,6 @@ class ContextShim {
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolKeyFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getSymbolFor);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(ensureDebug);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(enqueueMicrotask);
-  DECLARE_CHAKRASHIM_FUNCTION_GETTER(dequeueMicrotask);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getPropertyAttributes);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(getOwnPropertyNames);
   DECLARE_CHAKRASHIM_FUNCTION_GETTER(jsonParse);
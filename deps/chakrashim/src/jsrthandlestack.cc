@@ -0,0 +1,77 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8.h"
+#include "jsrtutils.h"
+#include <new>
+
+namespace jsrt {
+
+LocalHandleStack::~LocalHandleStack() {
+  // The runtime, and with it the registered root ranges, is already gone
+  LocalHandleBlock * block = first;
+  while (block != nullptr) {
+    LocalHandleBlock * next = block->next;
+    delete block;
+    block = next;
+  }
+}
+
+bool LocalHandleStack::Grow() {
+  LocalHandleBlock * next = (current != nullptr) ? current->next : first;
+  if (next == nullptr) {
+    next = new (std::nothrow) LocalHandleBlock(current);
+    if (next == nullptr) {
+      return false;
+    }
+
+    if (JsRegisterRootRange(runtime, next->slots, &next->top) != JsNoError) {
+      delete next;
+      return false;
+    }
+
+    if (current != nullptr) {
+      current->next = next;
+    } else {
+      first = next;
+    }
+  }
+
+  CHAKRA_ASSERT(next->top == next->slots);
+  current = next;
+  return true;
+}
+
+void LocalHandleStack::Reset(LocalHandleBlock * block, JsValueRef * top) {
+  // Blocks are filled in order, so the ones in use end at the first empty one
+  LocalHandleBlock * used = (block != nullptr) ? block->next : first;
+  while (used != nullptr && used->top != used->slots) {
+    used->top = used->slots;
+    used = used->next;
+  }
+
+  if (block != nullptr) {
+    CHAKRA_ASSERT(top >= block->slots && top <= block->top);
+    block->top = top;
+  }
+  current = block;
+}
+
+}  // namespace jsrt
@@ -0,0 +1,81 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
+
+namespace jsrt {
+
+// A block of local handle slots. The slots in [slots, top) are registered with
+// the runtime as a root range, so the GC reads top at scan time and values
+// only need to be stored in a slot to stay alive.
+struct LocalHandleBlock {
+  static const int kSlotCount = 1021;  // Block fills 1024 pointers
+
+  explicit LocalHandleBlock(LocalHandleBlock * prev)
+      : prev(prev), next(nullptr), top(slots) {}
+
+  JsValueRef * End() { return slots + kSlotCount; }
+
+  LocalHandleBlock * prev;
+  LocalHandleBlock * next;
+  JsValueRef * top;
+  JsValueRef slots[kSlotCount];
+};
+
+// Stack of the values referenced by v8::Local handles. HandleScopes save the
+// position when they are entered and reset the stack to it when they exit, so
+// adding a local is a pointer bump and exiting a scope releases all of its
+// locals at once. Blocks are kept for reuse once they have been allocated.
+class LocalHandleStack {
+ public:
+  explicit LocalHandleStack(JsRuntimeHandle runtime)
+      : runtime(runtime), first(nullptr), current(nullptr) {}
+  ~LocalHandleStack();
+
+  LocalHandleBlock * GetBlock() const { return current; }
+  JsValueRef * GetTop() const {
+    return current != nullptr ? current->top : nullptr;
+  }
+
+  bool Push(JsValueRef value) {
+    if (current == nullptr || current->top == current->End()) {
+      if (!Grow()) {
+        return false;
+      }
+    }
+    *current->top++ = value;
+    return true;
+  }
+
+  // Releases all values pushed since GetBlock()/GetTop() returned block/top
+  void Reset(LocalHandleBlock * block, JsValueRef * top);
+
+ private:
+  bool Grow();
+
+  JsRuntimeHandle runtime;
+  LocalHandleBlock * first;
+  LocalHandleBlock * current;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTHANDLESTACK_H_
@@ -229,6 +229,7 @@ IsolateShim::IsolateShim(JsRuntimeHandle runtime)
       isDisposing(false),
       contextScopeStack(nullptr),
       tryCatchStackTop(nullptr),
+      localHandleStack(runtime),
       embeddedData() {
   // CHAKRA-TODO: multithread locking for s_isolateList?
   this->prevnext = &s_isolateList;
@@ -613,6 +614,130 @@ void IsolateShim::RemoveMessageListeners(void * that) {
   messageListeners.erase(i, messageListeners.end());
 }
 
+bool IsolateShim::AddGCCallback(bool prologue,
+                                v8::Isolate::GCCallbackWithData callback,
+                                void* data, v8::GCType gcTypeFilter) {
+  if (gcPrologueCallbacks.empty() && gcEpilogueCallbacks.empty() &&
+      JsSetRuntimeGarbageCollectionCallback(runtime, this,
+                                            GarbageCollectionCallback)
+          != JsNoError) {
+    return false;
+  }
+
+  try {
+    (prologue ? gcPrologueCallbacks : gcEpilogueCallbacks).push_back(
+      { callback, data, gcTypeFilter });
+    return true;
+  } catch(...) {
+    return false;
+  }
+}
+
+void IsolateShim::RemoveGCCallback(bool prologue,
+                                   v8::Isolate::GCCallbackWithData callback,
+                                   void* data) {
+  std::vector<GCCallbackInfo>& callbacks =
+    prologue ? gcPrologueCallbacks : gcEpilogueCallbacks;
+  for (auto i = callbacks.begin(); i != callbacks.end(); i++) {
+    if (i->callback == callback && i->data == data) {
+      callbacks.erase(i);
+      break;
+    }
+  }
+
+  if (gcPrologueCallbacks.empty() && gcEpilogueCallbacks.empty()) {
+    JsSetRuntimeGarbageCollectionCallback(runtime, nullptr, nullptr);
+  }
+}
+
+/* static */
+void CHAKRA_CALLBACK IsolateShim::GarbageCollectionCallback(
+    JsGarbageCollectionEvent gcEvent, JsGarbageCollectionKind kind,
+    double durationInMilliseconds, void *callbackState) {
+  IsolateShim* isolateShim = static_cast<IsolateShim*>(callbackState);
+
+  // Partial collections only collect recently allocated pages, which is the
+  // closest to a scavenge. Concurrent collections mark in the background like
+  // V8's incremental marking.
+  v8::GCType type;
+  if (kind & JsGarbageCollectionKind_Partial) {
+    type = v8::kGCTypeScavenge;
+  } else if (kind & JsGarbageCollectionKind_Concurrent) {
+    type = v8::kGCTypeIncrementalMarking;
+  } else {
+    type = v8::kGCTypeMarkSweepCompact;
+  }
+
+  // Copy the callbacks, they may add or remove callbacks
+  std::vector<GCCallbackInfo> callbacks(
+    gcEvent == JsGarbageCollectionEvent_Begin ?
+      isolateShim->gcPrologueCallbacks : isolateShim->gcEpilogueCallbacks);
+  v8::Isolate* isolate = ToIsolate(isolateShim);
+  for (const GCCallbackInfo& info : callbacks) {
+    if (info.gcTypeFilter & type) {
+      info.callback(isolate, type, v8::kNoGCCallbackFlags, info.data);
+    }
+  }
+}
+
+bool IsolateShim::AddSerializedScriptSource(JsSourceContext sourceContext,
+                                            JsValueRef source) {
+  ReleaseUnloadedScriptSources();
+
+  if (JsAddRef(source, nullptr) != JsNoError) {
+    return false;
+  }
+
+  try {
+    serializedScriptSources[sourceContext] = source;
+    return true;
+  } catch(...) {
+    JsRelease(source, nullptr);
+    return false;
+  }
+}
+
+bool IsolateShim::TakeSerializedScriptSource(JsSourceContext sourceContext,
+                                             JsValueRef* source) {
+  auto i = serializedScriptSources.find(sourceContext);
+  if (i == serializedScriptSources.end()) {
+    return false;
+  }
+
+  // The engine copies the source as soon as the load callback returns, the
+  // value stays reachable from the native stack until then.
+  *source = i->second;
+  serializedScriptSources.erase(i);
+  JsRelease(*source, nullptr);
+  return true;
+}
+
+void IsolateShim::UnloadSerializedScriptSource(JsSourceContext sourceContext) {
+  // Called while the engine collects the script, the source can only be
+  // released once the collection is over
+  if (serializedScriptSources.find(sourceContext) ==
+      serializedScriptSources.end()) {
+    return;
+  }
+
+  try {
+    unloadedScriptSources.push_back(sourceContext);
+  } catch(...) {
+    // The source stays alive until the isolate is disposed
+  }
+}
+
+void IsolateShim::ReleaseUnloadedScriptSources() {
+  for (JsSourceContext sourceContext : unloadedScriptSources) {
+    auto i = serializedScriptSources.find(sourceContext);
+    if (i != serializedScriptSources.end()) {
+      JsRelease(i->second, nullptr);
+      serializedScriptSources.erase(i);
+    }
+  }
+  unloadedScriptSources.clear();
+}
+
 void IsolateShim::SetData(uint32_t slot, void* data) {
   if (slot >= _countof(this->embeddedData)) {
     CHAKRA_UNIMPLEMENTED_("Invalid embedded data index");
@@ -122,6 +122,23 @@ class IsolateShim {
     }
   }
 
+  // GC prologue/epilogue callbacks, called at the start and at the end of
+  // every collection of the runtime
+  bool AddGCCallback(bool prologue, v8::Isolate::GCCallbackWithData callback,
+                     void* data, v8::GCType gcTypeFilter);
+  void RemoveGCCallback(bool prologue,
+                        v8::Isolate::GCCallbackWithData callback,
+                        void* data);
+
+  // Sources of scripts loaded from serialized bytecode, handed back to the
+  // engine the first time it needs the script text, or released once the
+  // engine unloads the script without having needed it
+  bool AddSerializedScriptSource(JsSourceContext sourceContext,
+                                 JsValueRef source);
+  bool TakeSerializedScriptSource(JsSourceContext sourceContext,
+                                  JsValueRef* source);
+  void UnloadSerializedScriptSource(JsSourceContext sourceContext);
+
   JsValueRef GetChakraShimJsArrayBuffer();
   JsValueRef GetChakraInspectorShimJsArrayBuffer();
 
@@ -163,6 +180,10 @@ class IsolateShim {
 
   void SetPromiseRejectCallback(v8::PromiseRejectCallback callback);
 
+  inline LocalHandleStack* GetLocalHandleStack() {
+    return &localHandleStack;
+  }
+
  private:
   // Construction/Destruction should go thru New/Dispose
   explicit IsolateShim(JsRuntimeHandle runtime);
@@ -170,8 +191,12 @@ class IsolateShim {
   static v8::Isolate * ToIsolate(IsolateShim * isolate);
   static void CHAKRA_CALLBACK JsContextBeforeCollectCallback(JsRef contextRef,
                                                              void *data);
+  static void CHAKRA_CALLBACK GarbageCollectionCallback(
+      JsGarbageCollectionEvent gcEvent, JsGarbageCollectionKind kind,
+      double durationInMilliseconds, void *callbackState);
   static void CHAKRA_CALLBACK PromiseRejectionCallback(
       JsValueRef promise, JsValueRef reason, bool handled, void *callbackState);
+  void ReleaseUnloadedScriptSources();
 
   JsRuntimeHandle runtime;
   JsPropertyIdRef symbolPropertyIdRefs[CachedSymbolPropertyIdRef::SymbolCount];
@@ -185,8 +210,20 @@ class IsolateShim {
   friend class v8::TryCatch;
   v8::TryCatch * tryCatchStackTop;
 
+  LocalHandleStack localHandleStack;
+
   std::vector<void *> messageListeners;
 
+  struct GCCallbackInfo {
+    v8::Isolate::GCCallbackWithData callback;
+    void* data;
+    v8::GCType gcTypeFilter;
+  };
+  std::vector<GCCallbackInfo> gcPrologueCallbacks;
+  std::vector<GCCallbackInfo> gcEpilogueCallbacks;
+  std::unordered_map<JsSourceContext, JsValueRef> serializedScriptSources;
+  std::vector<JsSourceContext> unloadedScriptSources;
+
   // Node only has 4 slots (internals::Internals::kNumIsolateDataSlots = 4)
   void * embeddedData[4];
 
@@ -0,0 +1,171 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "v8.h"
+#include "jsrtutils.h"
+#include <new>
+
+namespace jsrt {
+
+MicrotaskQueue::MicrotaskQueue(IsolateShim * isolateShim, bool addRefFunctions)
+    : isolateShim(isolateShim),
+      addRefFunctions(addRefFunctions),
+      functions(nullptr),
+      functionsEnd(nullptr),
+      nativeTasks(nullptr),
+      capacity(0),
+      head(0),
+      count(0) {
+}
+
+MicrotaskQueue::~MicrotaskQueue() {
+  if (isolateShim->IsDisposing()) {
+    // The runtime, and with it the registered root range, is already gone
+    delete[] functions;
+    delete[] nativeTasks;
+    return;
+  }
+
+  if (addRefFunctions) {
+    for (size_t i = 0; i < count; i++) {
+      JsValueRef function = functions[(head + i) & (capacity - 1)];
+      if (function != JS_INVALID_REFERENCE) {
+        JsRelease(function, nullptr);
+      }
+    }
+  }
+  Free();
+}
+
+bool MicrotaskQueue::Enqueue(JsValueRef function) {
+  if (count == capacity && !Grow()) {
+    return false;
+  }
+  if (addRefFunctions && JsAddRef(function, nullptr) != JsNoError) {
+    return false;
+  }
+
+  functions[(head + count) & (capacity - 1)] = function;
+  count++;
+  return true;
+}
+
+bool MicrotaskQueue::Enqueue(NativeCallback callback, void * data) {
+  if (count == capacity && !Grow()) {
+    return false;
+  }
+
+  const size_t index = (head + count) & (capacity - 1);
+  functions[index] = JS_INVALID_REFERENCE;
+  nativeTasks[index].callback = callback;
+  nativeTasks[index].data = data;
+  count++;
+  return true;
+}
+
+void MicrotaskQueue::Run() {
+  // Tasks can queue more tasks, and the buffers can be reallocated while a
+  // task runs, so the state is reloaded for every task.
+  while (count != 0) {
+    const size_t index = head;
+    JsValueRef function = functions[index];
+    const NativeTask nativeTask = nativeTasks[index];
+
+    // The function is kept alive by this frame from here on
+    functions[index] = JS_INVALID_REFERENCE;
+    head = (head + 1) & (capacity - 1);
+    count--;
+
+    if (function == JS_INVALID_REFERENCE) {
+      nativeTask.callback(nativeTask.data);
+      continue;
+    }
+
+    JsValueRef notUsed;
+    if (CallFunction(function, &notUsed) != JsNoError) {
+      JsGetAndClearException(&notUsed);  // swallow any exception from task
+    }
+
+    if (addRefFunctions) {
+      JsRelease(function, nullptr);
+    }
+  }
+
+  if (capacity > kMaxIdleCapacity) {
+    Free();
+  }
+}
+
+bool MicrotaskQueue::Grow() {
+  const size_t newCapacity = capacity != 0 ? capacity * 2 : kInitialCapacity;
+  JsValueRef * newFunctions = new (std::nothrow) JsValueRef[newCapacity]();
+  NativeTask * newNativeTasks = new (std::nothrow) NativeTask[newCapacity];
+  if (newFunctions == nullptr || newNativeTasks == nullptr) {
+    delete[] newFunctions;
+    delete[] newNativeTasks;
+    return false;
+  }
+
+  // Unwrap the queued tasks to the start of the new buffers
+  for (size_t i = 0; i < count; i++) {
+    const size_t index = (head + i) & (capacity - 1);
+    newFunctions[i] = functions[index];
+    newNativeTasks[i] = nativeTasks[index];
+  }
+
+  // Nothing can trigger a GC until functionsEnd is updated below, so the new
+  // range can briefly share the end of the old one.
+  JsRuntimeHandle runtime = isolateShim->GetRuntimeHandle();
+  if (JsRegisterRootRange(runtime, newFunctions, &functionsEnd) !=
+      JsNoError) {
+    delete[] newFunctions;
+    delete[] newNativeTasks;
+    return false;
+  }
+  if (functions != nullptr) {
+    JsUnregisterRootRange(runtime, functions);
+  }
+
+  delete[] functions;
+  delete[] nativeTasks;
+  functions = newFunctions;
+  functionsEnd = newFunctions + newCapacity;
+  nativeTasks = newNativeTasks;
+  capacity = newCapacity;
+  head = 0;
+  return true;
+}
+
+void MicrotaskQueue::Free() {
+  if (functions != nullptr) {
+    JsUnregisterRootRange(isolateShim->GetRuntimeHandle(), functions);
+  }
+
+  delete[] functions;
+  delete[] nativeTasks;
+  functions = nullptr;
+  functionsEnd = nullptr;
+  nativeTasks = nullptr;
+  capacity = 0;
+  head = 0;
+  count = 0;
+}
+
+}  // namespace jsrt
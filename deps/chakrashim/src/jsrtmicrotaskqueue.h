@@ -0,0 +1,80 @@
+// Copyright Microsoft. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and / or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef DEPS_CHAKRASHIM_SRC_JSRTMICROTASKQUEUE_H_
+#define DEPS_CHAKRASHIM_SRC_JSRTMICROTASKQUEUE_H_
+
+namespace jsrt {
+
+class IsolateShim;
+
+// FIFO of the microtasks of a context: the promise jobs queued by the engine
+// and the native callbacks queued with v8::Isolate::EnqueueMicrotask. Tasks
+// are kept in a ring buffer. The function slots are registered with the
+// runtime as a root range, so queuing a promise job is a store and the queued
+// functions stay alive until they have run.
+class MicrotaskQueue {
+ public:
+  typedef void (*NativeCallback)(void* data);
+
+  // With addRefFunctions, queued functions are also AddRef'd, so that a TTD
+  // recording sees them as host references.
+  MicrotaskQueue(IsolateShim * isolateShim, bool addRefFunctions);
+  ~MicrotaskQueue();
+
+  bool IsEmpty() const { return count == 0; }
+
+  bool Enqueue(JsValueRef function);
+  bool Enqueue(NativeCallback callback, void * data);
+
+  // Runs tasks until the queue is empty, including the tasks queued by the
+  // tasks that run. Exceptions thrown by tasks are swallowed.
+  void Run();
+
+ private:
+  static const size_t kInitialCapacity = 256;
+  // Capacity above which the buffers are freed once the queue is drained, so
+  // the GC doesn't keep scanning the slots of a past burst of tasks
+  static const size_t kMaxIdleCapacity = 16 * 1024;
+
+  struct NativeTask {
+    NativeCallback callback;
+    void * data;
+  };
+
+  bool Grow();
+  void Free();
+
+  IsolateShim * isolateShim;
+  bool addRefFunctions;
+
+  // A task is either a function, or a native callback when its function slot
+  // is JS_INVALID_REFERENCE. Both arrays have `capacity` entries, a power of 2.
+  JsValueRef * functions;
+  JsValueRef * functionsEnd;
+  NativeTask * nativeTasks;
+  size_t capacity;
+  size_t head;
+  size_t count;
+};
+
+}  // namespace jsrt
+
+#endif  // DEPS_CHAKRASHIM_SRC_JSRTMICROTASKQUEUE_H_
@@ -59,7 +59,9 @@ inline size_t _countof(T (&)[N]) {
 #endif
 
 #include "jsrtproxyutils.h"
+#include "jsrtmicrotaskqueue.h"
 #include "jsrtcontextshim.h"
+#include "jsrthandlestack.h"
 #include "jsrtisolateshim.h"
 
 #define IfComFailError(v) \
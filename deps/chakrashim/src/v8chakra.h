@@ -273,6 +273,19 @@ class Utils {
     unsigned short argumentCount,  // NOLINT(runtime/int)
     void *callbackState);
 
+  // Native interceptor callbacks (see JsCreateInterceptorObject)
+  static bool CHAKRA_CALLBACK InterceptorGetCallback(
+    JsValueRef object, JsValueRef key, JsValueRef *value);
+  static bool CHAKRA_CALLBACK InterceptorSetCallback(
+    JsValueRef object, JsValueRef key, JsValueRef value);
+  static bool CHAKRA_CALLBACK InterceptorQueryCallback(
+    JsValueRef object, JsValueRef key, int *attributes);
+  static bool CHAKRA_CALLBACK InterceptorDeleteCallback(
+    JsValueRef object, JsValueRef key, bool *result);
+  static bool CHAKRA_CALLBACK InterceptorOwnKeysCallback(
+    JsValueRef object, JsValueRef *keys);
+  static const JsInterceptorCallbacks interceptorCallbacks;
+
   static void CHAKRA_CALLBACK WeakReferenceCallbackWrapperCallback(
       JsRef ref, void *data);
 
@@ -25,19 +25,40 @@ namespace v8 {
 
 THREAD_LOCAL HandleScope *current = nullptr;
 
+static jsrt::LocalHandleStack * GetCurrentHandleStack() {
+  jsrt::IsolateShim * isolateShim = jsrt::IsolateShim::GetCurrent();
+  return isolateShim != nullptr ? isolateShim->GetLocalHandleStack() : nullptr;
+}
+
 HandleScope::HandleScope(Isolate* isolate)
     : _prev(current),
-      _locals(),
-      _count(0),
+      _handleStack(GetCurrentHandleStack()),
+      _handleBlock(nullptr),
+      _handleTop(nullptr),
+      _escapedValue(JS_INVALID_REFERENCE),
       _contextRef(JS_INVALID_REFERENCE),
       _addRefRecordHead(nullptr) {
-  _locals[0] = JS_INVALID_REFERENCE;
+  if (_handleStack != nullptr) {
+    _handleBlock = _handleStack->GetBlock();
+    _handleTop = _handleStack->GetTop();
+  }
   current = this;
 }
 
 HandleScope::~HandleScope() {
   current = _prev;
 
+  if (_handleStack != nullptr) {
+    _handleStack->Reset(_handleBlock, _handleTop);
+  }
+
+  if (_escapedValue != JS_INVALID_REFERENCE) {
+    // Don't crash even if we fail to keep the escaped value alive
+    bool added = _prev->AddLocal(_escapedValue);
+    CHAKRA_ASSERT(added);
+    UNUSED(added);
+  }
+
   AddRefRecord * currRecord = this->_addRefRecordHead;
   while (currRecord != nullptr) {
     AddRefRecord * nextRecord = currRecord->_next;
@@ -58,28 +79,24 @@ Isolate* HandleScope::GetIsolate() const {
   return Isolate::GetCurrent();
 }
 
-
 bool HandleScope::AddLocal(JsValueRef value) {
-  // _locals is full, save them in _locals[0]
-  if (_count == kOnStackLocals) {
-    if (_locals[0] == JS_INVALID_REFERENCE) {
-      if (JsCreateArray(0, &_locals[0]) != JsNoError) {
-        return AddLocalAddRef(value);
-      }
-    }
-
-    JsValueRef arrayPushFunction =
-        jsrt::ContextShim::GetCurrent()->GetArrayPushFunction();
-
-    JsValueRef result;
-    if (JsCallFunction(arrayPushFunction, _locals,
-                       _countof(_locals), &result) != JsNoError) {
-      return AddLocalAddRef(value);
-    }
-    _count = 0;
+  if (_handleStack != nullptr && _handleStack->Push(value)) {
+    return true;
   }
-  _locals[1 + _count++] = value;
-  return true;
+
+  return AddLocalAddRef(value);
+}
+
+bool HandleScope::Escape(JsValueRef value) {
+  // The handle stack above this scope's position is released when the scope
+  // exits, so _prev only gets the value then. Until that, the value is kept
+  // alive by whichever scope it is a local of.
+  if (_escapedValue == JS_INVALID_REFERENCE) {
+    _escapedValue = value;
+    return true;
+  }
+
+  return _prev->AddLocalAddRef(value);
 }
 
 bool HandleScope::AddLocalContext(JsContextRef value) {
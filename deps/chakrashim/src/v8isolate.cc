@@ -78,9 +78,13 @@ void Isolate::Dispose() {
 
 int64_t Isolate::AdjustAmountOfExternalAllocatedMemory(
     int64_t change_in_bytes) {
-  // CHAKRA-TODO: We don't support adding external memory pressure at the
-  // moment.
-  return 0;
+  size_t usage;
+  if (JsAdjustExternalMemoryUsage(
+          jsrt::IsolateShim::FromIsolate(this)->GetRuntimeHandle(),
+          change_in_bytes, &usage) != JsNoError) {
+    return 0;
+  }
+  return static_cast<int64_t>(usage);
 }
 
 void Isolate::SetData(uint32_t slot, void* data) {
@@ -146,10 +150,7 @@ void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
 }
 
 void Isolate::EnqueueMicrotask(MicrotaskCallback microtask, void* data) {
-  // CHAKRA-TODO: Current microTask implementation only support queueing
-  // javascript functions. Need to add support to queue native functions
-  // And update dequeue code to check and call appropriate function
-  // (native vs. javascript)
+  jsrt::ContextShim::GetCurrent()->EnqueueMicrotask(microtask, data);
 }
 
 void Isolate::RunMicrotasks() {
@@ -175,34 +176,56 @@ CpuProfiler* Isolate::GetCpuProfiler() {
   return &dummyCpuProfiler;
 }
 
+// Callbacks without data are registered with the callback itself as data
+static void CallGCCallbackWithoutData(Isolate* isolate, GCType type,
+                                      GCCallbackFlags flags, void* data) {
+  reinterpret_cast<Isolate::GCCallback>(data)(isolate, type, flags);
+}
+
 void Isolate::AddGCPrologueCallback(
   GCCallbackWithData callback, void* data, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCCallback(
+    true, callback, data, gc_type_filter);
 }
 
 void Isolate::AddGCPrologueCallback(
   GCCallback callback, GCType gc_type_filter) {
+  AddGCPrologueCallback(CallGCCallbackWithoutData,
+                        reinterpret_cast<void*>(callback), gc_type_filter);
 }
 
 void Isolate::RemoveGCPrologueCallback(
   GCCallbackWithData callback, void* data) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCCallback(
+    true, callback, data);
 }
 
 void Isolate::RemoveGCPrologueCallback(GCCallback callback) {
+  RemoveGCPrologueCallback(CallGCCallbackWithoutData,
+                           reinterpret_cast<void*>(callback));
 }
 
 void Isolate::AddGCEpilogueCallback(
   GCCallbackWithData callback, void* data, GCType gc_type_filter) {
+  jsrt::IsolateShim::FromIsolate(this)->AddGCCallback(
+    false, callback, data, gc_type_filter);
 }
 
 void Isolate::AddGCEpilogueCallback(
   GCCallback callback, GCType gc_type_filter) {
+  AddGCEpilogueCallback(CallGCCallbackWithoutData,
+                        reinterpret_cast<void*>(callback), gc_type_filter);
 }
 
 void Isolate::RemoveGCEpilogueCallback(
   GCCallbackWithData callback, void* data) {
+  jsrt::IsolateShim::FromIsolate(this)->RemoveGCCallback(
+    false, callback, data);
 }
 
 void Isolate::RemoveGCEpilogueCallback(GCCallback callback) {
+  RemoveGCEpilogueCallback(CallGCCallbackWithoutData,
+                           reinterpret_cast<void*>(callback));
 }
 
 void Isolate::CancelTerminateExecution() {
@@ -252,23 +275,72 @@ int Isolate::ContextDisposedNotification() {
   return 0;
 }
 
+static const char* const kHeapSpaceNames[] = {
+  "small_normal_space",
+  "small_leaf_space",
+  "small_finalizable_space",
+  "medium_normal_space",
+  "medium_leaf_space",
+  "medium_finalizable_space",
+  "large_object_space"
+};
+static_assert(sizeof(kHeapSpaceNames) / sizeof(kHeapSpaceNames[0]) ==
+              JsHeapSpace_Count,
+              "every JsHeapSpace needs a name");
+
 void Isolate::GetHeapStatistics(HeapStatistics *heap_statistics) {
+  JsRuntimeHandle runtime =
+    jsrt::IsolateShim::FromIsolate(this)->GetRuntimeHandle();
   size_t memoryUsage;
-  if (!jsrt::IsolateShim::FromIsolate(this)->GetMemoryUsage(&memoryUsage)) {
+  if (JsGetRuntimeMemoryUsage(runtime, &memoryUsage) != JsNoError) {
     return;
   }
-  // CONSIDER: V8 distinguishes between "total" size and "used" size
-  heap_statistics->set_heap_size(memoryUsage);
+  heap_statistics->total_heap_size_ = memoryUsage;
+  heap_statistics->total_physical_size_ = memoryUsage;
+
+  JsHeapSpaceStatistics stats[JsHeapSpace_Count];
+  size_t usedSize = 0;
+  if (JsGetRuntimeHeapSpaceStatistics(runtime, stats,
+                                      JsHeapSpace_Count) == JsNoError) {
+    for (int i = 0; i < JsHeapSpace_Count; i++) {
+      usedSize += stats[i].usedBytes;
+    }
+  }
+  heap_statistics->used_heap_size_ = usedSize;
+
+  size_t memoryLimit;
+  if (JsGetRuntimeMemoryLimit(runtime, &memoryLimit) == JsNoError &&
+      memoryLimit != static_cast<size_t>(-1)) {
+    heap_statistics->heap_size_limit_ = memoryLimit;
+    heap_statistics->total_available_size_ =
+      memoryLimit > memoryUsage ? memoryLimit - memoryUsage : 0;
+  }
 }
 
 size_t Isolate::NumberOfHeapSpaces() {
-  // Chakra doesn't expose HEAP space stats
-  return 0;
+  return JsHeapSpace_Count;
 }
 
 bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                                      size_t index) {
-  // Chakra doesn't expose HEAP space stats
+  if (index >= JsHeapSpace_Count) {
+    return false;
+  }
+
+  JsHeapSpaceStatistics stats[JsHeapSpace_Count];
+  if (JsGetRuntimeHeapSpaceStatistics(
+        jsrt::IsolateShim::FromIsolate(this)->GetRuntimeHandle(),
+        stats, JsHeapSpace_Count) != JsNoError) {
+    return false;
+  }
+
+  const JsHeapSpaceStatistics& space = stats[index];
+  space_statistics->space_name_ = kHeapSpaceNames[index];
+  space_statistics->space_size_ = space.totalBytes;
+  space_statistics->space_used_size_ = space.usedBytes;
+  space_statistics->space_available_size_ =
+    space.totalBytes > space.usedBytes ? space.totalBytes - space.usedBytes : 0;
+  space_statistics->physical_space_size_ = space.totalBytes;
   return true;
 }
 
@@ -48,6 +48,119 @@ namespace v8 {
     return Local<Value>::New(obj);
   }
 
+  MaybeLocal<Value> JSON::ParseUtf8(Local<Context> context,
+                                    const char* data,
+                                    size_t length) {
+    JsValueRef obj = JS_INVALID_REFERENCE;
+    JsErrorCode error = JsParseJsonUtf8(
+        reinterpret_cast<const uint8_t*>(data), length, &obj);
+
+    if (error == JsErrorNotImplemented) {
+      // Not available while recording or replaying a TTD trace
+      Local<String> json_string;
+      if (!String::NewFromUtf8(context->GetIsolate(), data,
+                               NewStringType::kNormal,
+                               static_cast<int>(length))
+               .ToLocal(&json_string)) {
+        return Local<Value>();
+      }
+      return JSON::Parse(context, json_string);
+    }
+
+    if (error != JsNoError) {
+      return Local<Value>();
+    }
+
+    return Local<Value>::New(obj);
+  }
+
+  class EngineUtf8Reader : public JSON::Utf8Reader {
+   public:
+    explicit EngineUtf8Reader(JsJsonUtf8Reader reader) : reader_(reader) {}
+    ~EngineUtf8Reader() override {
+      JsReleaseJsonUtf8Reader(reader_);
+    }
+
+    size_t Read(char* buffer, size_t size) override {
+      size_t written = 0;
+      JsErrorCode error = JsReadJsonUtf8(
+          reader_, reinterpret_cast<uint8_t*>(buffer), size, &written);
+      assert(error == JsNoError);
+      (void)error;
+      return written;
+    }
+
+   private:
+    JsJsonUtf8Reader reader_;
+  };
+
+  // Reads a UTF-8 copy of the text, for when the engine can't serialize it
+  // lazily
+  class CopyUtf8Reader : public JSON::Utf8Reader {
+   public:
+    explicit CopyUtf8Reader(Local<String> text)
+        : utf8_(text), next_(*utf8_), remaining_(utf8_.length()) {}
+
+    size_t Read(char* buffer, size_t size) override {
+      size_t length = remaining_ < size ? remaining_ : size;
+      if (length < remaining_) {
+        // Don't split a character
+        while ((static_cast<uint8_t>(next_[length]) & 0xC0) == 0x80) {
+          length--;
+        }
+      }
+      memcpy(buffer, next_, length);
+      next_ += length;
+      remaining_ -= length;
+      return length;
+    }
+
+   private:
+    String::Utf8Value utf8_;
+    const char* next_;
+    size_t remaining_;
+  };
+
+  Maybe<JSON::Utf8Reader*> JSON::NewUtf8Reader(Local<Context> context,
+                                               Local<Value> value,
+                                               Local<Value> gap) {
+    JsJsonUtf8Reader reader = nullptr;
+    JsErrorCode error = JsCreateJsonUtf8Reader(
+        *value, gap.IsEmpty() ? JS_INVALID_REFERENCE : *gap, &reader);
+
+    if (error == JsErrorNotImplemented) {
+      // Not available while recording or replaying a TTD trace
+      jsrt::ContextShim *contextShim = jsrt::IsolateShim::GetContextShim(
+          (JsContextRef)*context);
+      JsValueRef str = JS_INVALID_REFERENCE;
+      if (jsrt::CallFunction(contextShim->GetjsonStringifyFunction(), *value,
+                             jsrt::GetUndefined(),
+                             gap.IsEmpty() ? jsrt::GetUndefined() : *gap,
+                             &str) != JsNoError) {
+        return Nothing<Utf8Reader*>();
+      }
+
+      JsValueType type;
+      if (JsGetValueType(str, &type) != JsNoError) {
+        return Nothing<Utf8Reader*>();
+      }
+      if (type != JsString) {
+        return Just<Utf8Reader*>(nullptr);
+      }
+
+      return Just<Utf8Reader*>(new CopyUtf8Reader(Local<String>::New(str)));
+    }
+
+    if (error != JsNoError) {
+      return Nothing<Utf8Reader*>();
+    }
+
+    if (reader == nullptr) {
+      return Just<Utf8Reader*>(nullptr);
+    }
+    return Just<Utf8Reader*>(new EngineUtf8Reader(reader));
+  }
+
   MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                      Local<Object> json_object,
                                      Local<String> gap) {
@@ -83,6 +83,16 @@ class ObjectTemplateData : public TemplateData {
     */
   }
 
+  // Definer and descriptor interceptors need the full set of Proxy traps,
+  // everything else is handled by native interceptor objects.
+  bool CanUseNativeInterceptors() {
+    return setterGetterInterceptor == nullptr ||
+     (setterGetterInterceptor->namedPropertyDefiner == nullptr &&
+      setterGetterInterceptor->namedPropertyDescriptor == nullptr &&
+      setterGetterInterceptor->indexedPropertyDefiner == nullptr &&
+      setterGetterInterceptor->indexedPropertyDescriptor == nullptr);
+  }
+
   virtual JsValueRef NewInstance(JsValueRef templateRef) {
 #ifdef DEBUG
     ObjectTemplateData* data;
@@ -822,6 +832,238 @@ JsValueRef CHAKRA_CALLBACK Utils::DefinePropertyCallback(
   return jsrt::GetTrue();
 }
 
+// Callbacks used with native interceptor objects. The engine passes indexed
+// property keys as numbers and named property keys as strings or symbols, and
+// only falls back to default JS behavior when a callback does not intercept.
+static bool GetInterceptorKeyIndex(JsValueRef key, unsigned int* index) {
+  JsValueType keyType;
+  double value;
+  if (JsGetValueType(key, &keyType) != JsNoError ||
+      keyType != JsValueType::JsNumber ||
+      JsNumberToDouble(key, &value) != JsNoError) {
+    return false;
+  }
+
+  *index = static_cast<unsigned int>(value);
+  return true;
+}
+
+static bool IsSelfSymbol(JsValueRef key) {
+  JsValueType keyType;
+  JsPropertyIdRef idRef;
+  return JsGetValueType(key, &keyType) == JsNoError &&
+         keyType == JsValueType::JsSymbol &&
+         JsGetPropertyIdFromSymbol(key, &idRef) == JsNoError &&
+         idRef == jsrt::IsolateShim::GetCurrent()->GetSelfSymbolPropertyIdRef();
+}
+
+static SetterGetterInterceptor* GetInterceptor(JsValueRef object) {
+  ObjectData* objectData = nullptr;
+  if (!ExternalData::TryGet(object, &objectData)) {
+    return nullptr;
+  }
+  return objectData->setterGetterInterceptor;
+}
+
+bool CHAKRA_CALLBACK Utils::InterceptorGetCallback(JsValueRef object,
+                                                   JsValueRef key,
+                                                   JsValueRef *value) {
+  SetterGetterInterceptor* sgi = GetInterceptor(object);
+  if (sgi == nullptr || IsSelfSymbol(key)) {
+    return false;
+  }
+
+  JsValueRef result = JS_INVALID_REFERENCE;
+  unsigned int index;
+  if (GetInterceptorKeyIndex(key, &index)) {
+    if (sgi->indexedPropertyGetter != nullptr) {
+      PropertyCallbackInfo<Value> info(
+        *(sgi->indexedPropertyInterceptorData),
+        reinterpret_cast<Object*>(object),
+        /*holder*/reinterpret_cast<Object*>(object));
+      sgi->indexedPropertyGetter(index, info);
+      result = reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+    }
+  } else if (sgi->namedPropertyGetter != nullptr) {
+    PropertyCallbackInfo<Value> info(
+      *(sgi->namedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->namedPropertyGetter(reinterpret_cast<String*>(key), info);
+    result = reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+  }
+
+  if (result == JS_INVALID_REFERENCE) {
+    return false;
+  }
+
+  *value = result;
+  return true;  // intercepted
+}
+
+bool CHAKRA_CALLBACK Utils::InterceptorSetCallback(JsValueRef object,
+                                                   JsValueRef key,
+                                                   JsValueRef value) {
+  SetterGetterInterceptor* sgi = GetInterceptor(object);
+  if (sgi == nullptr || IsSelfSymbol(key)) {
+    return false;
+  }
+
+  unsigned int index;
+  if (GetInterceptorKeyIndex(key, &index)) {
+    if (sgi->indexedPropertySetter != nullptr) {
+      PropertyCallbackInfo<Value> info(
+        *(sgi->indexedPropertyInterceptorData),
+        reinterpret_cast<Object*>(object),
+        /*holder*/reinterpret_cast<Object*>(object));
+      sgi->indexedPropertySetter(
+        index, reinterpret_cast<Value*>(value), info);
+      return info.GetReturnValue().Get() != JS_INVALID_REFERENCE;
+    }
+  } else if (sgi->namedPropertySetter != nullptr) {
+    PropertyCallbackInfo<Value> info(
+      *(sgi->namedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->namedPropertySetter(
+      reinterpret_cast<String*>(key), reinterpret_cast<Value*>(value), info);
+    return info.GetReturnValue().Get() != JS_INVALID_REFERENCE;
+  }
+
+  return false;
+}
+
+bool CHAKRA_CALLBACK Utils::InterceptorQueryCallback(JsValueRef object,
+                                                     JsValueRef key,
+                                                     int *attributes) {
+  SetterGetterInterceptor* sgi = GetInterceptor(object);
+  if (sgi == nullptr || IsSelfSymbol(key)) {
+    return false;
+  }
+
+  JsValueRef queryResult = JS_INVALID_REFERENCE;
+  unsigned int index;
+  bool isIndex = GetInterceptorKeyIndex(key, &index);
+
+  if (isIndex && sgi->indexedPropertyQuery != nullptr) {
+    HandleScope scope(nullptr);
+    PropertyCallbackInfo<Integer> info(
+      *(sgi->indexedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->indexedPropertyQuery(index, info);
+    queryResult = reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+  } else if (!isIndex && sgi->namedPropertyQuery != nullptr) {
+    HandleScope scope(nullptr);
+    PropertyCallbackInfo<Integer> info(
+      *(sgi->namedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->namedPropertyQuery(reinterpret_cast<String*>(key), info);
+    queryResult = reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+  } else {
+    // No query callback, a property exists if the getter intercepts it
+    JsValueRef value;
+    if (!InterceptorGetCallback(object, key, &value)) {
+      return false;
+    }
+    *attributes = JsInterceptorPropertyAttributes_None;
+    return true;
+  }
+
+  int queryValue;
+  if (queryResult == JS_INVALID_REFERENCE ||
+      jsrt::ValueToIntLikely(queryResult, &queryValue) != JsNoError) {
+    return false;
+  }
+
+  *attributes = queryValue;
+  return true;  // intercepted
+}
+
+bool CHAKRA_CALLBACK Utils::InterceptorDeleteCallback(JsValueRef object,
+                                                      JsValueRef key,
+                                                      bool *result) {
+  SetterGetterInterceptor* sgi = GetInterceptor(object);
+  if (sgi == nullptr || IsSelfSymbol(key)) {
+    return false;
+  }
+
+  JsValueRef deleteResult = JS_INVALID_REFERENCE;
+  unsigned int index;
+  if (GetInterceptorKeyIndex(key, &index)) {
+    if (sgi->indexedPropertyDeleter != nullptr) {
+      PropertyCallbackInfo<Boolean> info(
+        *(sgi->indexedPropertyInterceptorData),
+        reinterpret_cast<Object*>(object),
+        /*holder*/reinterpret_cast<Object*>(object));
+      sgi->indexedPropertyDeleter(index, info);
+      deleteResult = info.GetReturnValue().Get();
+    }
+  } else if (sgi->namedPropertyDeleter != nullptr) {
+    PropertyCallbackInfo<Boolean> info(
+      *(sgi->namedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->namedPropertyDeleter(reinterpret_cast<String*>(key), info);
+    deleteResult = info.GetReturnValue().Get();
+  }
+
+  if (deleteResult == JS_INVALID_REFERENCE) {
+    return false;
+  }
+
+  return jsrt::ValueToBoolLikely(deleteResult, result) == JsNoError;
+}
+
+bool CHAKRA_CALLBACK Utils::InterceptorOwnKeysCallback(JsValueRef object,
+                                                       JsValueRef *keys) {
+  SetterGetterInterceptor* sgi = GetInterceptor(object);
+  if (sgi == nullptr) {
+    return false;
+  }
+
+  JsValueRef indexedProperties = JS_INVALID_REFERENCE;
+  if (sgi->indexedPropertyEnumerator != nullptr) {
+    PropertyCallbackInfo<Array> info(
+      *(sgi->indexedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->indexedPropertyEnumerator(info);
+    indexedProperties =
+      reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+  }
+
+  JsValueRef namedProperties = JS_INVALID_REFERENCE;
+  if (sgi->namedPropertyEnumerator != nullptr) {
+    PropertyCallbackInfo<Array> info(
+      *(sgi->namedPropertyInterceptorData),
+      reinterpret_cast<Object*>(object),
+      /*holder*/reinterpret_cast<Object*>(object));
+    sgi->namedPropertyEnumerator(info);
+    namedProperties = reinterpret_cast<JsValueRef>(info.GetReturnValue().Get());
+  }
+
+  if (indexedProperties == JS_INVALID_REFERENCE) {
+    *keys = namedProperties;
+  } else if (namedProperties == JS_INVALID_REFERENCE) {
+    *keys = indexedProperties;
+  } else if (jsrt::ConcatArray(indexedProperties, namedProperties,
+                               keys) != JsNoError) {
+    return false;
+  }
+
+  return *keys != JS_INVALID_REFERENCE;
+}
+
+const JsInterceptorCallbacks Utils::interceptorCallbacks = {
+  Utils::InterceptorGetCallback,
+  Utils::InterceptorSetCallback,
+  Utils::InterceptorQueryCallback,
+  Utils::InterceptorDeleteCallback,
+  Utils::InterceptorOwnKeysCallback,
+};
+
 Local<ObjectTemplate> ObjectTemplate::New(Isolate* isolate,
                                           Local<FunctionTemplate> constructor) {
   JsValueRef objectTemplateRef;
@@ -881,24 +1123,38 @@ Local<Object> ObjectTemplate::NewInstance(Handle<Function> constructor) {
 
   ObjectData *objectData = new ObjectData(this, objectTemplateData);
   JsValueRef newInstanceRef = JS_INVALID_REFERENCE;
-  if (JsCreateExternalObjectWithPrototype(objectData,
+
+  // Objects with getter/setter/query/deleter/enumerator interceptors are
+  // created as native interceptor objects, the engine calls back into the
+  // shim on property access without the cost of going through a Proxy.
+  bool useNativeInterceptors = objectTemplateData->AreInterceptorsRequired() &&
+                               objectTemplateData->CanUseNativeInterceptors();
+  JsErrorCode error = useNativeInterceptors ?
+      JsCreateInterceptorObject(objectData,
+                                ObjectData::FinalizeCallback,
+                                prototype,
+                                &Utils::interceptorCallbacks,
+                                &newInstanceRef) :
+      JsCreateExternalObjectWithPrototype(objectData,
                                           ObjectData::FinalizeCallback,
                                           prototype,
-                                          &newInstanceRef) != JsNoError) {
+                                          &newInstanceRef);
+  if (error != JsNoError) {
     delete objectData;
     return Local<Object>();
   }
 
-  // In case the object should support index or named properties interceptors,
-  // we will use Proxies We will also support in case there is an overrdien
-  // toString method on the intercepted object (like Buffer), by returning an
-  // object which has the proxy as it prorotype - This is needed due to the fact
-  // that proxy implements comparison to other by reference in case the proxy is
-  // in the left side of the comparison, and does not call a toString method
-  // (like different objects) when compared to string For Node, such comparision
-  // is used for Buffers.
-
-  if (objectTemplateData->AreInterceptorsRequired()) {
+  // In case the object should support definer or descriptor interceptors
+  // (like contextified globals), we will use Proxies We will also support in
+  // case there is an overrdien toString method on the intercepted object (like
+  // Buffer), by returning an object which has the proxy as it prorotype - This
+  // is needed due to the fact that proxy implements comparison to other by
+  // reference in case the proxy is in the left side of the comparison, and
+  // does not call a toString method (like different objects) when compared to
+  // string For Node, such comparision is used for Buffers.
+
+  if (objectTemplateData->AreInterceptorsRequired() &&
+      !useNativeInterceptors) {
     JsValueRef newInstanceTargetRef = newInstanceRef;
 
     JsNativeFunction proxyConf[jsrt::ProxyTraps::TrapCount] = {};
@@ -948,7 +1204,7 @@ Local<Object> ObjectTemplate::NewInstance(Handle<Function> constructor) {
           Utils::DefinePropertyCallback;
     }
 
-    JsErrorCode error =
+    error =
         jsrt::CreateProxy(newInstanceTargetRef, proxyConf, &newInstanceRef);
 
     if (error != JsNoError) {
@@ -19,6 +19,8 @@
 // IN THE SOFTWARE.
 
 #include "v8chakra.h"
+#include "ChakraCoreVersion.h"
+#include <stdlib.h>
 #include <memory>
 
 namespace v8 {
@@ -245,11 +247,194 @@ Local<UnboundScript> ScriptCompiler::CompileUnbound(
   return FromMaybe(CompileUnboundScript(isolate, source, options));
 }
 
+// Cached data produced by CreateCodeCache is a CodeCacheHeader followed by
+// the bytecode from JsSerialize. The header lets us reject data produced by a
+// different engine build or for a different source before handing the
+// bytecode to the engine. The source is hashed as UTF-16, which only reads the
+// string in place and is much cheaper than encoding it for a parse.
+struct CodeCacheHeader {
+  uint32_t versionTag;
+  uint32_t sourceLength;  // In UTF-16 code units
+  uint32_t sourceHash;
+  uint32_t byteCodeLength;
+};
+
+static uint32_t HashBytes(uint32_t hash, const void* data, size_t length) {
+  // FNV-1a
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static bool HashSource(JsValueRef source, int length, uint32_t* hash) {
+  const int kChunkLength = 1024;
+  uint16_t chunk[kChunkLength];
+  *hash = 2166136261u;
+  for (int start = 0; start < length; start += kChunkLength) {
+    size_t count = 0;
+    if (JsCopyStringUtf16(source, start, kChunkLength, chunk,
+                          &count) != JsNoError) {
+      return false;
+    }
+    *hash = HashBytes(*hash, chunk, count * sizeof(chunk[0]));
+  }
+  return true;
+}
+
+static void CHAKRA_CALLBACK FreeScriptBuffer(void* data) {
+  free(data);
+}
+
+// Copy the UTF-8 script (with the same strict mode prefix jsrt::ParseScript
+// uses) into an external ArrayBuffer that JsSerialize and JsParseSerialized
+// accept as script source.
+static JsErrorCode CreateScriptBuffer(const jsrt::StringUtf8& script,
+                                      JsValueRef* buffer) {
+  static const char useStrictTag[] = "'use strict'; ";
+  size_t prefixLength = g_useStrict ? sizeof(useStrictTag) - 1 : 0;
+  size_t length = prefixLength + script.length();
+
+  char* data = static_cast<char*>(malloc(length));
+  if (data == nullptr) {
+    return JsErrorOutOfMemory;
+  }
+  memcpy(data, useStrictTag, prefixLength);
+  memcpy(data + prefixLength, static_cast<const char*>(script),
+         script.length());
+
+  JsErrorCode error = JsCreateExternalArrayBuffer(
+    data, static_cast<unsigned int>(length), FreeScriptBuffer, data, buffer);
+  if (error != JsNoError) {
+    free(data);
+  }
+  return error;
+}
+
+// The script text is only encoded if the engine ever needs it, e.g. for
+// Function.prototype.toString or to parse a function that wasn't serialized.
+static bool CHAKRA_CALLBACK LoadSerializedScriptSource(
+    JsSourceContext sourceContext,
+    JsValueRef *value,
+    JsParseScriptAttributes *parseAttributes) {
+  *parseAttributes = JsParseScriptAttributeNone;
+
+  JsValueRef source;
+  jsrt::StringUtf8 script;
+  return jsrt::IsolateShim::GetCurrent()->TakeSerializedScriptSource(
+           sourceContext, &source) &&
+         script.From(source) == JsNoError &&
+         CreateScriptBuffer(script, value) == JsNoError;
+}
+
+static void CHAKRA_CALLBACK UnloadSerializedScriptSource(
+    JsSourceContext sourceContext) {
+  jsrt::IsolateShim::GetCurrent()->UnloadSerializedScriptSource(
+    sourceContext);
+}
+
+// Load a script from cached data. Returns an empty handle (without a pending
+// exception) if the cached data does not match this engine or source.
+static MaybeLocal<Script> CompileWithCodeCache(
+    Handle<String> source,
+    ScriptOrigin* origin,
+    const ScriptCompiler::CachedData* cachedData) {
+  CodeCacheHeader header;
+  if (cachedData->data == nullptr ||
+      cachedData->length < static_cast<int>(sizeof(header))) {
+    return Local<Script>();
+  }
+  memcpy(&header, cachedData->data, sizeof(header));
+
+  if (header.versionTag != ScriptCompiler::CachedDataVersionTag() ||
+      header.byteCodeLength !=
+        static_cast<uint32_t>(cachedData->length) - sizeof(header)) {
+    return Local<Script>();
+  }
+
+  JsValueRef sourceRef = *source;
+  int sourceLength;
+  uint32_t sourceHash;
+  if (JsGetStringLength(sourceRef, &sourceLength) != JsNoError ||
+      header.sourceLength != static_cast<uint32_t>(sourceLength) ||
+      !HashSource(sourceRef, sourceLength, &sourceHash) ||
+      header.sourceHash != sourceHash) {
+    return Local<Script>();
+  }
+
+  // The engine keeps referencing the bytecode for deferred functions, copy it
+  // out of the (possibly not owned) cached data buffer
+  uint8_t* byteCode = static_cast<uint8_t*>(malloc(header.byteCodeLength));
+  if (byteCode == nullptr) {
+    return Local<Script>();
+  }
+  memcpy(byteCode, cachedData->data + sizeof(header), header.byteCodeLength);
+
+  JsValueRef byteCodeRef;
+  if (JsCreateExternalArrayBuffer(byteCode, header.byteCodeLength,
+                                  FreeScriptBuffer, byteCode,
+                                  &byteCodeRef) != JsNoError) {
+    free(byteCode);
+    return Local<Script>();
+  }
+
+  JsValueRef filenameRef = *origin->ResourceName();
+  if (filenameRef == JS_INVALID_REFERENCE &&
+      JsCreateString("", 0, &filenameRef) != JsNoError) {
+    return Local<Script>();
+  }
+
+  jsrt::IsolateShim* iso = jsrt::IsolateShim::GetCurrent();
+  JsSourceContext sourceContext = currentContext++;
+  if (!iso->AddSerializedScriptSource(sourceContext, sourceRef)) {
+    return Local<Script>();
+  }
+
+  JsValueRef scriptFunction;
+  if (JsParseSerializedWithUnloadCallback(byteCodeRef,
+                                          LoadSerializedScriptSource,
+                                          UnloadSerializedScriptSource,
+                                          sourceContext, filenameRef,
+                                          &scriptFunction) != JsNoError) {
+    JsValueRef unused;
+    iso->TakeSerializedScriptSource(sourceContext, &unused);
+    return Local<Script>();
+  }
+
+  JsValueRef scriptObject;
+  if (CreateScriptObject(sourceRef, filenameRef, scriptFunction,
+                         &scriptObject) != JsNoError) {
+    return Local<Script>();
+  }
+
+  return Utils::ToLocal(static_cast<Script*>(scriptObject));
+}
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            Source* source,
                                            CompileOptions options) {
   ScriptOrigin origin(source->resource_name);
-  return Script::Compile(context, source->source_string, &origin);
+
+  if (options == kConsumeCodeCache && source->cached_data != nullptr) {
+    MaybeLocal<Script> script = CompileWithCodeCache(
+      source->source_string, &origin, source->cached_data);
+    source->cached_data->rejected = script.IsEmpty();
+    if (!script.IsEmpty()) {
+      return script;
+    }
+  }
+
+  MaybeLocal<Script> script =
+    Script::Compile(context, source->source_string, &origin);
+
+  if (options == kProduceCodeCache && !script.IsEmpty()) {
+    delete source->cached_data;
+    source->cached_data = CreateCodeCache(
+      FromMaybe(script)->GetUnboundScript(), source->source_string);
+  }
+
+  return script;
 }
 
 Local<Script> ScriptCompiler::Compile(Isolate* isolate,
@@ -258,8 +443,60 @@ Local<Script> ScriptCompiler::Compile(Isolate* isolate,
   return FromMaybe(Compile(Local<Context>(), source, options));
 }
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
+    Local<UnboundScript> unbound_script, Local<String> source) {
+  jsrt::StringUtf8 script;
+  if (script.From(*source) != JsNoError) {
+    return nullptr;
+  }
+
+  JsValueRef scriptBufferRef;
+  if (CreateScriptBuffer(script, &scriptBufferRef) != JsNoError) {
+    return nullptr;
+  }
+
+  JsValueRef byteCodeRef;
+  BYTE* byteCode;
+  unsigned int byteCodeLength;
+  if (JsSerialize(scriptBufferRef, &byteCodeRef,
+                  JsParseScriptAttributeNone) != JsNoError ||
+      JsGetArrayBufferStorage(byteCodeRef, &byteCode,
+                              &byteCodeLength) != JsNoError) {
+    return nullptr;
+  }
+
+  int sourceLength;
+  uint32_t sourceHash;
+  if (JsGetStringLength(*source, &sourceLength) != JsNoError ||
+      !HashSource(*source, sourceLength, &sourceHash)) {
+    return nullptr;
+  }
+
+  CodeCacheHeader header;
+  header.versionTag = CachedDataVersionTag();
+  header.sourceLength = static_cast<uint32_t>(sourceLength);
+  header.sourceHash = sourceHash;
+  header.byteCodeLength = byteCodeLength;
+
+  size_t length = sizeof(header) + byteCodeLength;
+  uint8_t* data = new uint8_t[length];
+  memcpy(data, &header, sizeof(header));
+  memcpy(data + sizeof(header), byteCode, byteCodeLength);
+
+  return new CachedData(data, static_cast<int>(length),
+                        CachedData::BufferOwned);
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
-  return 0;
+  static const uint32_t version[] = {
+    CHAKRA_CORE_MAJOR_VERSION,
+    CHAKRA_CORE_MINOR_VERSION,
+    CHAKRA_CORE_PATCH_VERSION,
+    static_cast<uint32_t>(sizeof(void*))
+  };
+
+  uint32_t hash = HashBytes(2166136261u, version, sizeof(version));
+  return HashBytes(hash, &g_useStrict, sizeof(g_useStrict));
 }
 
 MaybeLocal<Module> ScriptCompiler::CompileModule(
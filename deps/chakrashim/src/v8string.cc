@@ -20,9 +20,6 @@
 
 #include "v8chakra.h"
 
-// utf8 multibyte codepoint start check
-#define UTF8_MULTIBYTE_START(c) (((c) & 0xC0) == 0xC0)
-
 namespace v8 {
 
 String::Utf8Value::Utf8Value(Handle<v8::Value> obj)
@@ -76,6 +73,37 @@ int String::Length() const {
   return length;
 }
 
+bool String::IsOneByte() const {
+  bool isOneByte = false;
+  if (JsIsStringOneByte((JsValueRef)this, &isOneByte) != JsNoError) {
+    return false;
+  }
+  return isOneByte;
+}
+
+bool String::ContainsOnlyOneByte() const {
+  if (IsOneByte()) {
+    return true;
+  }
+
+  const int kChunkLength = 256;
+  const int length = Length();
+  uint16_t chunk[kChunkLength];
+  for (int start = 0; start < length; start += kChunkLength) {
+    size_t count = 0;
+    if (JsCopyStringUtf16((JsValueRef)this, start, kChunkLength,
+                          chunk, &count) != JsNoError) {
+      return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+      if (chunk[i] > 0xFF) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 int String::Utf8Length() const {
   jsrt::StringUtf8 str;
   if (str.LengthFrom((JsValueRef)this) != JsNoError) {
@@ -114,78 +142,37 @@ int String::WriteOneByte(
 int String::WriteUtf8(
     char *buffer, int length, int *nchars_ref, int options) const {
   size_t count = 0;
-  if (length < 0) {
+  size_t nchars = 0;
+  if (length < 0 || buffer == nullptr) {
     // in case length was not provided we want to copy the whole string
-    length = String::kMaxLength;
-  } else if (buffer != nullptr) {
-    JsCopyString((JsValueRef)this, nullptr, 0, &count);
-
-    if (length < count ||
-        (length == count && !(options & String::NO_NULL_TERMINATION))
-      ) {
-      // if length == count there is no space for null terminator
-      // Slow path: must implement truncation here.
-      char* fullBuffer = static_cast<char *>(malloc(count));
-      CHAKRA_VERIFY(fullBuffer != nullptr);
-
-      JsCopyString((JsValueRef)this, fullBuffer, count, nullptr);
-      memmove(buffer, fullBuffer, sizeof(char) * length);
-      free(fullBuffer);
-
-      // Find the start of the last codepoint
-      int lastIndex = length - 1;
-      bool overflow = false;
-      if (length > 0 && ((buffer[length-1] & 0x80) == 0)) {
-        lastIndex = length-1;
-      } else if (length > 0 && UTF8_MULTIBYTE_START(buffer[length-1])) {
-        // Last byte starts a multibyte codepoint
-        lastIndex = length-1;
-        overflow = true;
-      } else if (length > 1 && UTF8_MULTIBYTE_START(buffer[length-2])) {
-        // Second last byte starts a multibyte codepoint
-        lastIndex = length-2;
-        // 0xE0 = 0b1110 0000
-        // 3 leading 1s indicates a 3+ byte character
-        overflow = (buffer[length-2] & 0xE0) == 0xE0;
-      } else if (length > 2 && UTF8_MULTIBYTE_START(buffer[length-3])) {
-        // Third last byte starts a multibyte codepoint
-        lastIndex = length-3;
-        // 0xF0 = 0b1111 0000
-        // 4 leading 1s indicates a 4 byte character
-        overflow = (buffer[length-2] & 0xF0) == 0xF0;
-      } else if (length > 3 && UTF8_MULTIBYTE_START(buffer[length-4])) {
-        // Fourth last byte starts a multibyte codepoint
-        lastIndex = length-4;
-        // No overflow; utf8 is at most 4 bytes per codepoint
-      }
-
-      if (lastIndex >= 0 && !(options & String::NO_NULL_TERMINATION)) {
-        buffer[lastIndex] = '\0';
-        length = lastIndex;
-      } else if (overflow) {
-        length = lastIndex;
-      }
-
-      if (nchars_ref) {
-        *nchars_ref = count;
+    if (JsCopyString((JsValueRef)this,
+                     buffer, String::kMaxLength, &count) == JsNoError) {
+      if (buffer != nullptr && !(options & String::NO_NULL_TERMINATION)) {
+        // Utf8 version count includes null terminator
+        buffer[count++] = 0;
       }
+    }
 
-      return length;
+    if (nchars_ref) {
+      *nchars_ref = Length();
     }
-  }
 
+    return static_cast<int>(count);
+  }
 
-  if (JsCopyString((JsValueRef)this,
-                   buffer, length, &count) == JsNoError) {
-    if (buffer != nullptr && count < (unsigned)length &&
-        !(options & String::NO_NULL_TERMINATION)) {
-      // Utf8 version count includes null terminator
+  // Encodes up to the last code point that fits, in a single pass
+  if (JsCopyStringTruncated((JsValueRef)this, buffer, length,
+                            &count, &nchars) == JsNoError) {
+    // Like V8, only terminate a string that was written completely
+    if (count < static_cast<size_t>(length) &&
+        !(options & String::NO_NULL_TERMINATION) &&
+        nchars == static_cast<size_t>(Length())) {
       buffer[count++] = 0;
     }
   }
 
   if (nchars_ref) {
-    *nchars_ref = count;
+    *nchars_ref = static_cast<int>(nchars);
   }
 
   return static_cast<int>(count);
@@ -213,6 +200,15 @@ MaybeLocal<String> Utils::NewString(const char *data, int length) {
   return Local<String>::New(strRef);
 }
 
+static bool IsAscii(const char* data, int length) {
+  for (int i = 0; i < length; i++) {
+    if (static_cast<uint8_t>(data[i]) >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
 MaybeLocal<String> String::NewFromUtf8(Isolate* isolate,
                                        const char* data,
                                        v8::NewStringType type,
@@ -221,8 +217,19 @@ MaybeLocal<String> String::NewFromUtf8(Isolate* isolate,
     length = strlen(data);
   }
 
+  // ASCII data is stored as a one-byte string, half the size of the UTF-16
+  // representation. Internalized strings are used as property names and are
+  // widened right away, so they are not worth the check.
+  JsErrorCode error;
   JsValueRef strRef;
-  if (JsCreateString(data, length, &strRef) != JsNoError) {
+  if (type == v8::NewStringType::kNormal && IsAscii(data, length)) {
+    error = JsCreateStringOneByte(reinterpret_cast<const uint8_t*>(data),
+                                  length, &strRef);
+  } else {
+    error = JsCreateString(data, length, &strRef);
+  }
+
+  if (error != JsNoError) {
     return Local<String>();
   }
 
@@ -245,28 +252,8 @@ MaybeLocal<String> String::NewFromOneByte(Isolate* isolate,
     length = strlen((const char*)data);
   }
 
-  // convert latin-1 to utf8 for JsCreateString
-  uint8_t* utf8 = new uint8_t[length*2];
-  uint8_t* p = utf8;
-
-  for (size_t i = 0; i < length; i++) {
-    uint8_t ch = data[i];
-    if (ch < 0x80) {
-      *p++ = ch;
-    } else {
-      *p++ = 0xc0 | ch >> 6;
-      *p++ = 0x80 | (ch & 0x3f);
-    }
-  }
-
-  size_t utf8length = p - utf8;
-
   JsValueRef strRef;
-  JsErrorCode ret = JsCreateString((const char*)utf8, utf8length, &strRef);
-
-  delete[] utf8;
-
-  if (ret != JsNoError) {
+  if (JsCreateStringOneByte(data, length, &strRef) != JsNoError) {
     return Local<String>();
   }
 
@@ -350,17 +337,26 @@ Local<String> String::NewExternal(Isolate* isolate,
   return FromMaybe(NewExternalTwoByte(isolate, resource));
 }
 
+static void CHAKRA_CALLBACK DisposeExternalOneByteStringResource(void* data) {
+  static_cast<String::ExternalOneByteStringResource*>(data)->Dispose();
+}
+
 MaybeLocal<String> String::NewExternalOneByte(
     Isolate* isolate, ExternalOneByteStringResource* resource) {
   if (resource->data() != nullptr) {
-    auto newStr = NewFromOneByte(
-      nullptr,
-      reinterpret_cast<const uint8_t*>(resource->data()),
-      v8::NewStringType::kNormal,
-      static_cast<int>(resource->length()));
+    // The string keeps the resource, and disposes it once it is collected.
+    // If creating the string fails, the caller keeps the resource.
+    JsValueRef strRef;
+    if (JsCreateExternalStringOneByte(
+            reinterpret_cast<const uint8_t*>(resource->data()),
+            resource->length(),
+            DisposeExternalOneByteStringResource,
+            resource,
+            &strRef) != JsNoError) {
+      return Local<String>();
+    }
 
-    resource->Dispose();
-    return newStr;
+    return Local<String>::New(strRef);
   }
 
   // otherwise the resource is empty just delete it and return an empty string
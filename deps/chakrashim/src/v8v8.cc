@@ -199,6 +199,27 @@ bool V8::Dispose() {
   return true;
 }
 
+bool V8::SetProfileCacheDirectory(const char* directory) {
+  return JsSetProfileCacheDirectory(directory) == JsNoError;
+}
+
+void V8::SaveProfileCache() {
+  // Best effort; without a current context there is nothing to save
+  JsSaveProfileCache();
+}
+
+bool V8::SetRecyclerPageOptions(bool huge_pages, bool idle_reset_pages) {
+  int options = JsRecyclerPageOptionNone;
+  if (huge_pages) {
+    options |= JsRecyclerPageOptionHugePages;
+  }
+  if (idle_reset_pages) {
+    options |= JsRecyclerPageOptionIdleResetPages;
+  }
+  return JsSetRecyclerPageOptions(
+    static_cast<JsRecyclerPageOptions>(options)) == JsNoError;
+}
+
 void V8::TerminateExecution(Isolate* isolate) {
   isolate->TerminateExecution();
 }
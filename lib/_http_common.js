@@ -56,17 +56,20 @@ function parserOnHeaders(headers, url) {
 }
 
 // `headers` and `url` are set only if .onHeaders() has not been called for
-// this request.
+// this request. `headersObject` is set along with `headers` and is the headers
+// object built from them by the parser, with the same rules as
+// IncomingMessage.prototype._addHeaderLine().
 // `url` is not set for response parsers but that's not applicable here since
 // all our parsers are request parsers.
 function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
                                  url, statusCode, statusMessage, upgrade,
-                                 shouldKeepAlive) {
+                                 shouldKeepAlive, headersObject) {
   var parser = this;
 
   if (!headers) {
     headers = parser._headers;
     parser._headers = [];
+    headersObject = undefined;
   }
 
   if (!url) {
@@ -90,7 +93,7 @@ function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
   if (parser.maxHeaderPairs > 0)
     n = Math.min(n, parser.maxHeaderPairs);
 
-  parser.incoming._addHeaderLines(headers, n);
+  parser.incoming._addHeaderLines(headers, n, headersObject);
 
   if (typeof method === 'number') {
     // server only
@@ -97,7 +97,7 @@ IncomingMessage.prototype.destroy = function destroy(error) {
 
 
 IncomingMessage.prototype._addHeaderLines = _addHeaderLines;
-function _addHeaderLines(headers, n) {
+function _addHeaderLines(headers, n, headersObject) {
   if (headers && headers.length) {
     var dest;
     if (this.complete) {
@@ -106,6 +106,15 @@ function _addHeaderLines(headers, n) {
     } else {
       this.rawHeaders = headers;
       dest = this.headers;
+
+      // The parser already built the headers object from all of the headers.
+      // It can't be used if some of them are over the limit, or if
+      // _addHeaderLine() has been overridden.
+      if (headersObject !== undefined && n === headers.length &&
+          this._addHeaderLine === _addHeaderLine) {
+        this.headers = headersObject;
+        return;
+      }
     }
 
     for (var i = 0; i < n; i += 2) {
@@ -122,9 +131,9 @@ function _addHeaderLines(headers, n) {
 // 'no duplicates' field, a `0` byte is prepended as a flag. The one exception
 // to this is the Set-Cookie header which is indicated by a `1` byte flag, since
 // it is an 'array' field and thus is treated differently in _addHeaderLines().
-// TODO: perhaps http_parser could be returning both raw and lowercased versions
-// of known header names to avoid us having to call toLowerCase() for those
-// headers.
+// The HTTP parser binding combines duplicates of the known headers in its
+// table (HTTP_KNOWN_HEADERS in src/node_http_parser.h) by the same rules, so
+// the table has to be kept in sync with this function.
 
 // 'array' header list is taken from:
 // https://mxr.mozilla.org/mozilla/source/netwerk/protocol/http/src/nsHttpHeaderArray.cpp
@@ -31,6 +31,7 @@ const common = require('_http_common');
 const checkIsHttpToken = common._checkIsHttpToken;
 const checkInvalidHeaderChar = common._checkInvalidHeaderChar;
 const { outHeadersKey } = require('internal/http');
+const { JSONReader } = process.binding('serdes');
 const {
   defaultTriggerAsyncIdScope,
   symbols: { async_id_symbol }
@@ -802,6 +803,47 @@ OutgoingMessage.prototype.end = function end(chunk, encoding, callback) {
 };
 
 
+// Equivalent of end(JSON.stringify(value, null, space), callback). On
+// ChakraCore the JSON text is never created as a string: it is read from the
+// engine a chunk at a time, and reading pauses whenever the socket is full
+// until it has drained, so the memory used doesn't grow with the size of the
+// body.
+OutgoingMessage.prototype.endJSON = function endJSON(value, space, callback) {
+  if (typeof space === 'function') {
+    callback = space;
+    space = undefined;
+  }
+
+  if (JSONReader === undefined)
+    return this.end(JSON.stringify(value, null, space), callback);
+
+  // Any toJSON() method or getter runs here, before anything is written.
+  const reader = new JSONReader(value, space);
+
+  // A body that fits in a single chunk is sent with a Content-Length.
+  const first = reader.read();
+  var chunk = reader.read();
+  if (chunk === undefined)
+    return this.end(first, callback);
+
+  const msg = this;
+  var ret = this.write(first);
+  (function writeChunks() {
+    while (chunk !== undefined) {
+      if (ret === false) {
+        ret = true;
+        msg.once('drain', writeChunks);
+        return;
+      }
+      ret = msg.write(chunk);
+      chunk = reader.read();
+    }
+    msg.end(callback);
+  })();
+
+  return this;
+};
+
 OutgoingMessage.prototype._finish = function _finish() {
   assert(this.connection);
   this.emit('prefinish');
@@ -0,0 +1,108 @@
+'use strict';
+
+// On-disk bytecode cache for the CommonJS loader, enabled with
+// --chakra-bytecode-cache=dir. The vm.Script cached data of every compiled
+// module is stored in dir, keyed by the module's path and tagged with its
+// modification time. The engine also checks the cached data against the
+// length and a hash of the module source before loading functions from it
+// lazily, so a module edited without its mtime changing is not run from stale
+// bytecode. A mismatch simply causes the module to be compiled (and cached)
+// again.
+
+const { Buffer } = require('buffer');
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+// Cache files start with the module's mtime (as a double)
+const kHeaderLength = 8;
+
+let cacheDirectory =
+  path.resolve(process.binding('config').chakraBytecodeCache);
+try {
+  fs.mkdirSync(cacheDirectory);
+} catch (e) {
+  if (e.code !== 'EEXIST')
+    cacheDirectory = undefined;
+}
+
+// FNV-1a, only used to spread modules with the same name over the cache
+function hashString(str) {
+  var hash = 0x811c9dc5;
+  for (var i = 0; i < str.length; i++) {
+    hash ^= str.charCodeAt(i);
+    hash = Math.imul(hash, 0x01000193);
+  }
+  return (hash >>> 0).toString(16);
+}
+
+function getCacheFile(filename) {
+  return path.join(cacheDirectory,
+                   `${hashString(filename)}-${path.basename(filename)}.bin`);
+}
+
+function readCache(cacheFile, mtimeMs) {
+  var data;
+  try {
+    data = fs.readFileSync(cacheFile);
+  } catch (e) {
+    return undefined;
+  }
+  if (data.length <= kHeaderLength || data.readDoubleLE(0) !== mtimeMs)
+    return undefined;
+  return data.slice(kHeaderLength);
+}
+
+function writeCache(cacheFile, mtimeMs, cachedData) {
+  const header = Buffer.allocUnsafe(kHeaderLength);
+  header.writeDoubleLE(mtimeMs, 0);
+
+  // Write to a temporary file first so that concurrent processes never read
+  // a partially written cache file.
+  const tmpFile = `${cacheFile}.${process.pid}`;
+  try {
+    fs.writeFileSync(tmpFile, Buffer.concat([header, cachedData]));
+    fs.renameSync(tmpFile, cacheFile);
+  } catch (e) {
+    try {
+      fs.unlinkSync(tmpFile);
+    } catch (e) {}
+  }
+}
+
+// Equivalent of vm.runInThisContext(wrapper, { filename, displayErrors })
+// that goes through the cache.
+function runInThisContext(wrapper, filename) {
+  var mtimeMs;
+  try {
+    mtimeMs = fs.statSync(filename).mtimeMs;
+  } catch (e) {
+    return vm.runInThisContext(wrapper, {
+      filename,
+      lineOffset: 0,
+      displayErrors: true
+    });
+  }
+
+  const cacheFile = getCacheFile(filename);
+  const cachedData = readCache(cacheFile, mtimeMs);
+
+  // Cached data is only produced when there was none or it was rejected
+  const script = new vm.Script(wrapper, {
+    filename,
+    lineOffset: 0,
+    displayErrors: true,
+    cachedData,
+    produceCachedData: true
+  });
+
+  if (script.cachedDataProduced)
+    writeCache(cacheFile, mtimeMs, script.cachedData);
+
+  return script.runInThisContext({ displayErrors: true });
+}
+
+module.exports = {
+  enabled: cacheDirectory !== undefined,
+  runInThisContext
+};
@@ -38,6 +38,9 @@ const { safeGetenv } = process.binding('util');
 const internalModule = require('internal/module');
 const preserveSymlinks = !!process.binding('config').preserveSymlinks;
 const experimentalModules = !!process.binding('config').experimentalModules;
+const bytecodeCache =
+  process.binding('config').chakraBytecodeCache !== undefined ?
+    require('internal/bytecode_cache') : undefined;
 
 const {
   ERR_INVALID_ARG_TYPE,
@@ -134,20 +137,23 @@ Module._debug = util.deprecate(debug, 'Module._debug is deprecated.',
 // check if the directory is a package.json dir
 const packageMainCache = Object.create(null);
 
+const nativeParsesPackageJSON = process.jsEngine === 'chakracore';
+
 function readPackage(requestPath) {
   const entry = packageMainCache[requestPath];
   if (entry)
     return entry;
 
   const jsonPath = path.resolve(requestPath, 'package.json');
-  const json = internalModuleReadJSON(path.toNamespacedPath(jsonPath));
-
-  if (json === undefined) {
-    return false;
-  }
 
   try {
-    var pkg = packageMainCache[requestPath] = JSON.parse(json).main;
+    // With ChakraCore the binding parses the file itself.
+    const json = internalModuleReadJSON(path.toNamespacedPath(jsonPath));
+    if (json === undefined) {
+      return false;
+    }
+    const parsed = nativeParsesPackageJSON ? json : JSON.parse(json);
+    var pkg = packageMainCache[requestPath] = parsed.main;
   } catch (e) {
     e.path = jsonPath;
     e.message = 'Error parsing ' + jsonPath + ': ' + e.message;
@@ -636,11 +642,16 @@ Module.prototype._compile = function(content, filename) {
   // create wrapper function
   var wrapper = Module.wrap(content);
 
-  var compiledWrapper = vm.runInThisContext(wrapper, {
-    filename: filename,
-    lineOffset: 0,
-    displayErrors: true
-  });
+  var compiledWrapper;
+  if (bytecodeCache !== undefined && bytecodeCache.enabled) {
+    compiledWrapper = bytecodeCache.runInThisContext(wrapper, filename);
+  } else {
+    compiledWrapper = vm.runInThisContext(wrapper, {
+      filename: filename,
+      lineOffset: 0,
+      displayErrors: true
+    });
+  }
 
   var inspectorWrapper = null;
   if (process._breakFirstLine && process._eval == null) {
@@ -83,6 +83,7 @@
       'lib/zlib.js',
       'lib/internal/async_hooks.js',
       'lib/internal/buffer.js',
+      'lib/internal/bytecode_cache.js',
       'lib/internal/child_process.js',
       'lib/internal/cluster/child.js',
       'lib/internal/cluster/master.js',
@@ -385,6 +386,7 @@
         'src/node_file.h',
         'src/node_http2.h',
         'src/node_http2_state.h',
+        'src/node_http_parser.h',
         'src/node_internals.h',
         'src/node_javascript.h',
         'src/node_mutex.h',
@@ -989,6 +991,7 @@
         'test/cctest/test_base64.cc',
         'test/cctest/test_node_postmortem_metadata.cc',
         'test/cctest/test_environment.cc',
+        'test/cctest/test_string_search.cc',
         'test/cctest/test_util.cc',
         'test/cctest/test_url.cc'
       ],
@@ -469,6 +469,23 @@ inline void Environment::set_http_parser_buffer(char* buffer) {
   http_parser_buffer_ = buffer;
 }
 
+inline char* Environment::stream_read_buffer() const {
+  return stream_read_buffer_;
+}
+
+inline void Environment::set_stream_read_buffer(char* buffer) {
+  stream_read_buffer_ = buffer;
+}
+
+inline HttpHeaderNames* Environment::http_header_names() const {
+  return http_header_names_;
+}
+
+inline void Environment::set_http_header_names(HttpHeaderNames* names) {
+  CHECK_EQ(http_header_names_, nullptr);  // Should be set only once.
+  http_header_names_ = names;
+}
+
 inline http2::http2_state* Environment::http2_state() const {
   return http2_state_.get();
 }
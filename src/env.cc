@@ -1,6 +1,7 @@
 #include "node_internals.h"
 #include "async_wrap.h"
 #include "node_buffer.h"
+#include "node_http_parser.h"
 #include "node_platform.h"
 
 #include <stdio.h>
@@ -144,6 +145,8 @@ Environment::~Environment() {
   delete[] heap_statistics_buffer_;
   delete[] heap_space_statistics_buffer_;
   delete[] http_parser_buffer_;
+  free(stream_read_buffer_);
+  delete http_header_names_;
 }
 
 void Environment::Start(int argc,
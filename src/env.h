@@ -332,6 +332,7 @@ struct PackageConfig {
   V(fs_use_promises_symbol, v8::Symbol)
 
 class Environment;
+class HttpHeaderNames;
 
 class IsolateData {
  public:
@@ -637,6 +638,12 @@ class Environment {
   inline char* http_parser_buffer() const;
   inline void set_http_parser_buffer(char* buffer);
 
+  inline char* stream_read_buffer() const;
+  inline void set_stream_read_buffer(char* buffer);
+
+  inline HttpHeaderNames* http_header_names() const;
+  inline void set_http_header_names(HttpHeaderNames* names);
+
   inline http2::http2_state* http2_state() const;
   inline void set_http2_state(std::unique_ptr<http2::http2_state> state);
 
@@ -817,6 +824,8 @@ class Environment {
   double* heap_space_statistics_buffer_ = nullptr;
 
   char* http_parser_buffer_;
+  char* stream_read_buffer_ = nullptr;
+  HttpHeaderNames* http_header_names_ = nullptr;
   std::unique_ptr<http2::http2_state> http2_state_;
 
   // stat fields contains twice the number of entries because `fs.StatWatcher`
@@ -266,6 +266,21 @@ bool config_pending_deprecation = false;
 // Set in node.cc by ParseArgs when --redirect-warnings= is used.
 std::string config_warning_file;  // NOLINT(runtime/string)
 
+#ifdef NODE_ENGINE_CHAKRACORE
+// Set in node.cc by ParseArgs when --chakra-bytecode-cache= is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/bytecode_cache.js
+std::string config_chakra_bytecode_cache;  // NOLINT(runtime/string)
+
+// Set in node.cc by ParseArgs when --chakra-profile-cache= is used.
+static std::string chakra_profile_cache;  // NOLINT(runtime/string)
+
+// Set in node.cc by ParseArgs when --chakra-recycler-huge-pages or
+// --chakra-idle-reset-pages is used.
+static bool chakra_recycler_huge_pages = false;
+static bool chakra_idle_reset_pages = false;
+#endif
+
 // Set in node.cc by ParseArgs when --expose-internals or --expose_internals is
 // used.
 // Used in node_config.cc to set a constant on process.binding('config')
@@ -2008,6 +2023,11 @@ static void Exit(const FunctionCallbackInfo<Value>& args) {
   if (trace_enabled) {
     v8_platform.StopTracingAgent();
   }
+#ifdef NODE_ENGINE_CHAKRACORE
+  if (!chakra_profile_cache.empty()) {
+    V8::SaveProfileCache();
+  }
+#endif
   exit(args[0]->Int32Value());
 }
 
@@ -3552,6 +3572,20 @@ static void PrintHelp() {
          "  --break-first            break at first statement when running\n"
          "                           in --replay-debug mode\n"
  #endif
+#ifdef NODE_ENGINE_CHAKRACORE
+         "  --chakra-bytecode-cache=dir\n"
+         "                             cache compiled bytecode of CommonJS\n"
+         "                             modules in dir\n"
+         "  --chakra-profile-cache=dir\n"
+         "                             cache JIT profiles of scripts in dir\n"
+         "  --chakra-recycler-huge-pages\n"
+         "                             back the JS heap with transparent\n"
+         "                             huge pages (Linux only)\n"
+         "  --chakra-idle-reset-pages\n"
+         "                             keep free JS heap pages committed\n"
+         "                             when idle, the OS reclaims them\n"
+         "                             lazily\n"
+#endif
          "  --track-heap-objects       track heap object allocations for heap "
          "snapshots\n"
          "  --prof-process             process v8 profiler output generated\n"
@@ -3703,6 +3737,12 @@ static void CheckIfAllowedInEnv(const char* exe, bool is_env,
     "--trace-events-enabled",
     "--trace-event-categories",
     "--trace-event-file-pattern",
+#ifdef NODE_ENGINE_CHAKRACORE
+    "--chakra-bytecode-cache",
+    "--chakra-profile-cache",
+    "--chakra-recycler-huge-pages",
+    "--chakra-idle-reset-pages",
+#endif
     "--track-heap-objects",
     "--zero-fill-buffers",
     "--v8-pool-size",
@@ -3901,6 +3941,16 @@ static void ParseArgs(int* argc,
       TTDFlagWarning(arg, "--record-interval=num");
     } else if (strstr(arg, "-TTHistoryLength:") == arg) {
       TTDFlagWarning(arg, "--record-history=num");
+#endif
+#ifdef NODE_ENGINE_CHAKRACORE
+    } else if (strncmp(arg, "--chakra-bytecode-cache=", 24) == 0) {
+      config_chakra_bytecode_cache = arg + 24;
+    } else if (strncmp(arg, "--chakra-profile-cache=", 23) == 0) {
+      chakra_profile_cache = arg + 23;
+    } else if (strcmp(arg, "--chakra-recycler-huge-pages") == 0) {
+      chakra_recycler_huge_pages = true;
+    } else if (strcmp(arg, "--chakra-idle-reset-pages") == 0) {
+      chakra_idle_reset_pages = true;
 #endif
     } else if (strcmp(arg, "--track-heap-objects") == 0) {
       track_heap_objects = true;
@@ -4415,6 +4465,24 @@ void Init(int* argc,
     v8::Debug::EnableInspector();
 #endif
   }
+
+  // The engine only reads profiles for scripts created after this.
+  if (!chakra_profile_cache.empty()) {
+    uv_fs_t req;
+    uv_fs_mkdir(nullptr, &req, chakra_profile_cache.c_str(), 0777, nullptr);
+    uv_fs_req_cleanup(&req);
+    if (!V8::SetProfileCacheDirectory(chakra_profile_cache.c_str())) {
+      fprintf(stderr, "%s: --chakra-profile-cache is not supported\n",
+              argv[0]);
+      exit(9);
+    }
+  }
+
+  // Page allocators read these when the isolate is created.
+  if (chakra_recycler_huge_pages || chakra_idle_reset_pages) {
+    V8::SetRecyclerPageOptions(chakra_recycler_huge_pages,
+                               chakra_idle_reset_pages);
+  }
 #endif
 
   // Needed for access to V8 intrinsics.  Disabled again during bootstrapping,
@@ -4675,6 +4743,11 @@ inline int Start(Isolate* isolate, void* isolate_context,
 
   const int exit_code = EmitExit(&env);
   RunAtExit(&env);
+#ifdef NODE_ENGINE_CHAKRACORE
+  if (!chakra_profile_cache.empty()) {
+    V8::SaveProfileCache();
+  }
+#endif
 
   v8_platform.DrainVMTasks(isolate);
   v8_platform.CancelVMTasks(isolate);
@@ -913,65 +913,38 @@ void IndexOfString(const FunctionCallbackInfo<Value>& args) {
 
   size_t result = haystack_length;
 
-  if (enc == UCS2) {
-    String::Value needle_value(needle);
-    if (*needle_value == nullptr)
-      return args.GetReturnValue().Set(-1);
+  if (enc != UCS2 && enc != UTF8 && enc != LATIN1)
+    return args.GetReturnValue().Set(-1);
 
-    if (haystack_length < 2 || needle_value.length() < 1) {
-      return args.GetReturnValue().Set(-1);
-    }
+  // Needles are usually short, so they are encoded on the stack instead of
+  // into a temporary copy on the heap.
+  StringBytes::InlineDecoder decoder;
+  if (!decoder.Decode(Environment::GetCurrent(args), needle, args[3], UTF8))
+    return;
 
-    if (IsBigEndian()) {
-      StringBytes::InlineDecoder decoder;
-      decoder.Decode(Environment::GetCurrent(args), needle, args[3], UCS2);
-      const uint16_t* decoded_string =
-          reinterpret_cast<const uint16_t*>(decoder.out());
-
-      if (decoded_string == nullptr)
-        return args.GetReturnValue().Set(-1);
-
-      result = SearchString(reinterpret_cast<const uint16_t*>(haystack),
-                            haystack_length / 2,
-                            decoded_string,
-                            decoder.size() / 2,
-                            offset / 2,
-                            is_forward);
-    } else {
-      result = SearchString(reinterpret_cast<const uint16_t*>(haystack),
-                            haystack_length / 2,
-                            reinterpret_cast<const uint16_t*>(*needle_value),
-                            needle_value.length(),
-                            offset / 2,
-                            is_forward);
-    }
-    result *= 2;
-  } else if (enc == UTF8) {
-    String::Utf8Value needle_value(needle);
-    if (*needle_value == nullptr)
+  if (enc == UCS2) {
+    if (haystack_length < 2 || decoder.size() < 2) {
       return args.GetReturnValue().Set(-1);
+    }
 
-    result = SearchString(reinterpret_cast<const uint8_t*>(haystack),
-                          haystack_length,
-                          reinterpret_cast<const uint8_t*>(*needle_value),
-                          needle_length,
-                          offset,
+    result = SearchString(reinterpret_cast<const uint16_t*>(haystack),
+                          haystack_length / 2,
+                          reinterpret_cast<const uint16_t*>(decoder.out()),
+                          decoder.size() / 2,
+                          offset / 2,
                           is_forward);
-  } else if (enc == LATIN1) {
-    uint8_t* needle_data = node::UncheckedMalloc<uint8_t>(needle_length);
-    if (needle_data == nullptr) {
+    result *= 2;
+  } else {
+    if (decoder.size() == 0) {
       return args.GetReturnValue().Set(-1);
     }
-    needle->WriteOneByte(
-        needle_data, 0, needle_length, String::NO_NULL_TERMINATION);
 
     result = SearchString(reinterpret_cast<const uint8_t*>(haystack),
                           haystack_length,
-                          needle_data,
-                          needle_length,
+                          reinterpret_cast<const uint8_t*>(decoder.out()),
+                          decoder.size(),
                           offset,
                           is_forward);
-    free(needle_data);
   }
 
   args.GetReturnValue().Set(
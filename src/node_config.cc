@@ -108,6 +108,18 @@ static void InitConfig(Local<Object> target,
         ReadOnly).FromJust();
   }
 
+#ifdef NODE_ENGINE_CHAKRACORE
+  if (!config_chakra_bytecode_cache.empty()) {
+    target->DefineOwnProperty(
+        context,
+        FIXED_ONE_BYTE_STRING(isolate, "chakraBytecodeCache"),
+        String::NewFromUtf8(isolate,
+                            config_chakra_bytecode_cache.data(),
+                            v8::NewStringType::kNormal).ToLocalChecked(),
+        ReadOnly).FromJust();
+  }
+#endif
+
   Local<Object> debugOptions = Object::New(isolate);
 
   target->DefineOwnProperty(
@@ -924,13 +924,21 @@ class ContextifyScript : public BaseObject {
     contextify_script->script_.Reset(env->isolate(),
                                      v8_script.ToLocalChecked());
 
+    bool cached_data_rejected = false;
     if (compile_options == ScriptCompiler::kConsumeCodeCache) {
+      cached_data_rejected = source.GetCachedData()->rejected;
       args.This()->Set(
           env->cached_data_rejected_string(),
-          Boolean::New(env->isolate(), source.GetCachedData()->rejected));
-    } else if (produce_cached_data) {
-      const ScriptCompiler::CachedData* cached_data =
-        ScriptCompiler::CreateCodeCache(v8_script.ToLocalChecked(), code);
+          Boolean::New(env->isolate(), cached_data_rejected));
+    }
+
+    // Rejected cached data is replaced from the script that was just compiled
+    // so callers don't have to compile the code a second time to refresh it.
+    if (produce_cached_data &&
+        (compile_options != ScriptCompiler::kConsumeCodeCache ||
+         cached_data_rejected)) {
+      std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+        ScriptCompiler::CreateCodeCache(v8_script.ToLocalChecked(), code));
       bool cached_data_produced = cached_data != nullptr;
       if (cached_data_produced) {
         MaybeLocal<Object> buf = Buffer::Copy(
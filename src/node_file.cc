@@ -699,12 +699,22 @@ static void InternalModuleReadJSON(const FunctionCallbackInfo<Value>& args) {
   if (size == 0 || size == SearchString(&chars[start], size, "\"main\"")) {
     return;
   } else {
+#ifdef NODE_ENGINE_CHAKRACORE
+    // Parse straight from the file contents; on failure the SyntaxError is
+    // left pending for the caller to decorate.
+    Local<Value> json;
+    if (v8::JSON::ParseUtf8(env->context(), &chars[start], size)
+            .ToLocal(&json)) {
+      args.GetReturnValue().Set(json);
+    }
+#else
     Local<String> chars_string =
         String::NewFromUtf8(env->isolate(),
                             &chars[start],
                             String::kNormalString,
                             size);
     args.GetReturnValue().Set(chars_string);
+#endif
   }
 }
 
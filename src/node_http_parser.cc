@@ -21,6 +21,7 @@
 
 #include "node.h"
 #include "node_buffer.h"
+#include "node_http_parser.h"
 
 #include "async_wrap-inl.h"
 #include "env-inl.h"
@@ -32,6 +33,8 @@
 #include <stdlib.h>  // free()
 #include <string.h>  // strdup()
 
+#include <string>
+
 // This is a binding to http_parser (https://github.com/nodejs/http-parser)
 // The goal is to decouple sockets from parsing for more javascript-level
 // agility. A Buffer is read from a socket and passed to parser.execute().
@@ -45,6 +48,91 @@
 
 
 namespace node {
+
+namespace {
+
+struct KnownHeader {
+  const char* name;
+  size_t length;
+  const char* key;
+};
+
+const KnownHeader kKnownHeaders[] = {
+#define V(id, name, key) { name, sizeof(name) - 1, key },
+  HTTP_KNOWN_HEADERS(V)
+#undef V
+};
+
+}  // anonymous namespace
+
+
+HttpHeaderNames::HttpHeaderNames(v8::Isolate* isolate) : isolate_(isolate) {
+  v8::HandleScope handle_scope(isolate);
+
+  for (size_t i = 0; i < kCount; i++) {
+    const KnownHeader& header = kKnownHeaders[i];
+    char lowercase[32];
+    CHECK_LE(header.length, sizeof(lowercase));
+    for (size_t j = 0; j < header.length; j++)
+      lowercase[j] = ToLower(header.name[j]);
+
+    names_[i].Reset(isolate,
+                    OneByteString(isolate, header.name, header.length));
+    lowercase_names_[i].Reset(isolate,
+                              OneByteString(isolate, lowercase, header.length));
+  }
+}
+
+
+HttpHeaderNames::Index HttpHeaderNames::Find(const char* name,
+                                             size_t length) {
+  for (size_t i = 0; i < kCount; i++) {
+    const KnownHeader& header = kKnownHeaders[i];
+    if (header.length == length &&
+        StringEqualNoCaseN(name, header.name, length)) {
+      return static_cast<Index>(i);
+    }
+  }
+  return kCount;
+}
+
+
+HttpHeaderNames::Duplicates HttpHeaderNames::GetDuplicates(Index index) {
+  if (index == kCount)
+    return kJoinWithComma;
+
+  const KnownHeader& header = kKnownHeaders[index];
+  switch (header.key[0]) {
+    case '\0':
+      return kJoinWithComma;
+    case '\x01':
+      return kArray;
+    case '\x02':
+      return kJoinWithSemicolon;
+    default:
+      return kDropDuplicates;
+  }
+}
+
+
+v8::Local<v8::String> HttpHeaderNames::ToString(Index index,
+                                                const char* name,
+                                                size_t length) const {
+  if (index != kCount) {
+    if (memcmp(name, kKnownHeaders[index].name, length) == 0)
+      return PersistentToLocal(isolate_, names_[index]);
+
+    bool is_lowercase = true;
+    for (size_t i = 0; i < length && is_lowercase; i++)
+      is_lowercase = (name[i] < 'A' || name[i] > 'Z');
+    if (is_lowercase)
+      return PersistentToLocal(isolate_, lowercase_names_[index]);
+  }
+
+  return OneByteString(isolate_, name, length);
+}
+
+
 namespace {
 
 using v8::Array;
@@ -57,6 +145,7 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
 using v8::Object;
@@ -138,6 +227,25 @@ struct StringPtr {
   }
 
 
+  void AppendTo(std::string* s) const {
+    if (size_ > 0)
+      s->append(str_, size_);
+  }
+
+
+  // Like ToString(), for a header name. Known header names are interned, and
+  // `index` is set to which one this is, or to HttpHeaderNames::kCount.
+  Local<String> ToHeaderName(Environment* env,
+                             HttpHeaderNames* names,
+                             HttpHeaderNames::Index* index) const {
+    *index = HttpHeaderNames::Find(str_, size_);
+    if (str_)
+      return names->ToString(*index, str_, size_);
+    else
+      return String::Empty(env->isolate());
+  }
+
+
   const char* str_;
   bool on_heap_;
   size_t size_;
@@ -237,6 +345,7 @@ class Parser : public AsyncWrap, public StreamListener {
       A_STATUS_MESSAGE,
       A_UPGRADE,
       A_SHOULD_KEEP_ALIVE,
+      A_HEADERS_OBJECT,
       A_MAX
     };
 
@@ -255,8 +364,10 @@ class Parser : public AsyncWrap, public StreamListener {
       // Slow case, flush remaining headers.
       Flush();
     } else {
-      // Fast case, pass headers and URL to JS land.
-      argv[A_HEADERS] = CreateHeaders();
+      // Fast case, pass headers, the headers object and URL to JS land.
+      Local<Object> headers_object;
+      argv[A_HEADERS] = CreateHeaders(&headers_object);
+      argv[A_HEADERS_OBJECT] = headers_object;
       if (parser_.type == HTTP_REQUEST)
         argv[A_URL] = url_.ToString(env());
     }
@@ -606,17 +717,32 @@ class Parser : public AsyncWrap, public StreamListener {
     return scope.Escape(nparsed_obj);
   }
 
-  Local<Array> CreateHeaders() {
+  HttpHeaderNames* header_names() {
+    HttpHeaderNames* names = env()->http_header_names();
+    if (names == nullptr) {
+      names = new HttpHeaderNames(env()->isolate());
+      env()->set_http_header_names(names);
+    }
+    return names;
+  }
+
+
+  // If `headers_object` isn't null, it is set to the headers object that
+  // IncomingMessage.prototype._addHeaderLines() would build from the headers.
+  Local<Array> CreateHeaders(Local<Object>* headers_object = nullptr) {
     Local<Array> headers = Array::New(env()->isolate());
     Local<Function> fn = env()->push_values_to_array_function();
     Local<Value> argv[NODE_PUSH_VAL_TO_ARRAY_MAX * 2];
+    Local<Value> values[arraysize(values_)];
+    HttpHeaderNames::Index indexes[arraysize(fields_)];
+    HttpHeaderNames* names = header_names();
     size_t i = 0;
 
     do {
       size_t j = 0;
       while (i < num_values_ && j < arraysize(argv) / 2) {
-        argv[j * 2] = fields_[i].ToString(env());
-        argv[j * 2 + 1] = values_[i].ToString(env());
+        argv[j * 2] = fields_[i].ToHeaderName(env(), names, &indexes[i]);
+        argv[j * 2 + 1] = values[i] = values_[i].ToString(env());
         i++;
         j++;
       }
@@ -625,10 +751,95 @@ class Parser : public AsyncWrap, public StreamListener {
       }
     } while (i < num_values_);
 
+    if (headers_object != nullptr)
+      *headers_object = CreateHeadersObject(names, indexes, values);
+
     return headers;
   }
 
 
+  bool IsSameHeader(const HttpHeaderNames::Index* indexes,
+                    size_t a,
+                    size_t b) const {
+    if (indexes[a] != indexes[b])
+      return false;
+    if (indexes[a] != HttpHeaderNames::kCount)
+      return true;
+    const StringPtr& field = fields_[a];
+    return field.size_ == fields_[b].size_ &&
+           StringEqualNoCaseN(field.str_, fields_[b].str_, field.size_);
+  }
+
+
+  // Builds the headers object with the same property names, in the same
+  // order, and with duplicates combined by the same rules as
+  // IncomingMessage.prototype._addHeaderLine(). Known header names are the
+  // interned lowercase strings, so that messages with the same headers get
+  // objects of the same shape. Duplicates are found and joined here, so every
+  // property is set exactly once.
+  Local<Object> CreateHeadersObject(HttpHeaderNames* names,
+                                    const HttpHeaderNames::Index* indexes,
+                                    const Local<Value>* values) {
+    Isolate* isolate = env()->isolate();
+    Local<Context> context = env()->context();
+    Local<Object> object = Object::New(isolate);
+    bool is_duplicate[arraysize(fields_)] = {};
+    std::string buffer;
+
+    for (size_t i = 0; i < num_values_; i++) {
+      if (is_duplicate[i])
+        continue;
+
+      size_t count = 1;
+      for (size_t j = i + 1; j < num_values_; j++) {
+        if (!is_duplicate[j] && IsSameHeader(indexes, i, j)) {
+          is_duplicate[j] = true;
+          count++;
+        }
+      }
+
+      Local<String> name;
+      if (indexes[i] != HttpHeaderNames::kCount) {
+        name = names->LowercaseName(indexes[i]);
+      } else {
+        buffer.resize(fields_[i].size_);
+        for (size_t k = 0; k < buffer.size(); k++)
+          buffer[k] = ToLower(fields_[i].str_[k]);
+        name = OneByteString(isolate, buffer.data(), buffer.size());
+      }
+
+      Local<Value> value = values[i];
+      const HttpHeaderNames::Duplicates duplicates =
+          HttpHeaderNames::GetDuplicates(indexes[i]);
+      if (duplicates == HttpHeaderNames::kArray) {
+        Local<Array> array = Array::New(isolate, static_cast<int>(count));
+        for (size_t j = i, n = 0; n < count; j++) {
+          if (j == i || (is_duplicate[j] && IsSameHeader(indexes, i, j)))
+            array->Set(context, n++, values[j]).FromJust();
+        }
+        value = array;
+      } else if (count > 1 && duplicates != HttpHeaderNames::kDropDuplicates) {
+        const char* separator =
+            duplicates == HttpHeaderNames::kJoinWithSemicolon ? "; " : ", ";
+        buffer.clear();
+        values_[i].AppendTo(&buffer);
+        for (size_t j = i + 1, n = 1; n < count; j++) {
+          if (is_duplicate[j] && IsSameHeader(indexes, i, j)) {
+            buffer.append(separator, 2);
+            values_[j].AppendTo(&buffer);
+            n++;
+          }
+        }
+        value = OneByteString(isolate, buffer.data(), buffer.size());
+      }
+
+      object->Set(context, name, value).FromJust();
+    }
+
+    return object;
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(env()->isolate());
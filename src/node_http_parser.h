@@ -0,0 +1,113 @@
+#ifndef SRC_NODE_HTTP_PARSER_H_
+#define SRC_NODE_HTTP_PARSER_H_
+
+#if defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#include "node_persistent.h"
+#include "util.h"
+#include "v8.h"
+
+#include <stddef.h>
+
+namespace node {
+
+// Header names that are common across messages, with the key that
+// matchKnownFields() in lib/_http_incoming.js returns for them. The first
+// byte of the key says how duplicates are combined, the same way as in
+// IncomingMessage.prototype._addHeaderLine(), so the keys have to be kept in
+// sync with it.
+#define HTTP_KNOWN_HEADERS(V)                                                 \
+  V(CONTENT_TYPE, "Content-Type", "content-type")                             \
+  V(CONTENT_LENGTH, "Content-Length", "content-length")                       \
+  V(USER_AGENT, "User-Agent", "user-agent")                                   \
+  V(REFERER, "Referer", "referer")                                            \
+  V(HOST, "Host", "host")                                                     \
+  V(AUTHORIZATION, "Authorization", "authorization")                          \
+  V(PROXY_AUTHORIZATION, "Proxy-Authorization", "proxy-authorization")        \
+  V(IF_MODIFIED_SINCE, "If-Modified-Since", "if-modified-since")              \
+  V(IF_UNMODIFIED_SINCE, "If-Unmodified-Since", "if-unmodified-since")        \
+  V(FROM, "From", "from")                                                     \
+  V(LOCATION, "Location", "location")                                         \
+  V(MAX_FORWARDS, "Max-Forwards", "max-forwards")                             \
+  V(RETRY_AFTER, "Retry-After", "retry-after")                                \
+  V(ETAG, "ETag", "etag")                                                     \
+  V(LAST_MODIFIED, "Last-Modified", "last-modified")                          \
+  V(SERVER, "Server", "server")                                               \
+  V(AGE, "Age", "age")                                                        \
+  V(EXPIRES, "Expires", "expires")                                            \
+  V(SET_COOKIE, "Set-Cookie", "\x01")                                         \
+  V(COOKIE, "Cookie", "\x02" "cookie")                                        \
+  V(TRANSFER_ENCODING, "Transfer-Encoding", "\0" "transfer-encoding")         \
+  V(DATE, "Date", "\0" "date")                                                \
+  V(CONNECTION, "Connection", "\0" "connection")                              \
+  V(CACHE_CONTROL, "Cache-Control", "\0" "cache-control")                     \
+  V(VARY, "Vary", "\0" "vary")                                                \
+  V(CONTENT_ENCODING, "Content-Encoding", "\0" "content-encoding")            \
+  V(ORIGIN, "Origin", "\0" "origin")                                          \
+  V(UPGRADE, "Upgrade", "\0" "upgrade")                                       \
+  V(EXPECT, "Expect", "\0" "expect")                                          \
+  V(IF_MATCH, "If-Match", "\0" "if-match")                                    \
+  V(IF_NONE_MATCH, "If-None-Match", "\0" "if-none-match")                     \
+  V(ACCEPT, "Accept", "\0" "accept")                                          \
+  V(ACCEPT_ENCODING, "Accept-Encoding", "\0" "accept-encoding")               \
+  V(ACCEPT_LANGUAGE, "Accept-Language", "\0" "accept-language")               \
+  V(X_FORWARDED_FOR, "X-Forwarded-For", "\0" "x-forwarded-for")               \
+  V(X_FORWARDED_HOST, "X-Forwarded-Host", "\0" "x-forwarded-host")            \
+  V(X_FORWARDED_PROTO, "X-Forwarded-Proto", "\0" "x-forwarded-proto")
+
+// Per-Environment intern table of the known header names. The HTTP parser
+// binding hands out these strings instead of creating new ones for every
+// message, both for the names as received (when they are spelled like the
+// canonical or the lowercase name) and for the property names of the headers
+// object it builds.
+class HttpHeaderNames {
+ public:
+  enum Index {
+#define V(id, name, key) k##id,
+    HTTP_KNOWN_HEADERS(V)
+#undef V
+    kCount
+  };
+
+  // How the values of a header that is received more than once end up in the
+  // headers object.
+  enum Duplicates {
+    kDropDuplicates,     // Only the first value is kept.
+    kJoinWithComma,      // The values are joined with ', '.
+    kJoinWithSemicolon,  // The values are joined with '; '.
+    kArray               // The values are kept in an array.
+  };
+
+  explicit HttpHeaderNames(v8::Isolate* isolate);
+
+  // Returns the index of the known header `name` is, ignoring case, or
+  // kCount if it isn't one.
+  static Index Find(const char* name, size_t length);
+
+  // Returns `name` as a string, interned if it is spelled like the canonical
+  // or the lowercase name of the known header `index`.
+  v8::Local<v8::String> ToString(Index index,
+                                 const char* name,
+                                 size_t length) const;
+
+  // Returns how duplicates of the header `index` are combined. Headers that
+  // aren't known ones (kCount) are joined with ', '.
+  static Duplicates GetDuplicates(Index index);
+
+  inline v8::Local<v8::String> LowercaseName(Index index) const {
+    return PersistentToLocal(isolate_, lowercase_names_[index]);
+  }
+
+ private:
+  v8::Isolate* isolate_;
+  Persistent<v8::String> names_[kCount];
+  Persistent<v8::String> lowercase_names_[kCount];
+
+  DISALLOW_COPY_AND_ASSIGN(HttpHeaderNames);
+};
+
+}  // namespace node
+
+#endif  // defined(NODE_WANT_INTERNALS) && NODE_WANT_INTERNALS
+
+#endif  // SRC_NODE_HTTP_PARSER_H_
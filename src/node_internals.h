@@ -196,6 +196,13 @@ extern bool config_expose_internals;
 // it to stderr.
 extern std::string config_warning_file;  // NOLINT(runtime/string)
 
+#ifdef NODE_ENGINE_CHAKRACORE
+// Set in node.cc by ParseArgs when --chakra-bytecode-cache= is used.
+// Used in node_config.cc to set a constant on process.binding('config')
+// that is used by lib/internal/bytecode_cache.js
+extern std::string config_chakra_bytecode_cache;  // NOLINT(runtime/string)
+#endif
+
 // Set in node.cc by ParseArgs when --pending-deprecation or
 // NODE_PENDING_DEPRECATION is used
 extern bool config_pending_deprecation;
@@ -82,6 +82,29 @@ class DeserializerContext : public BaseObject,
   ValueDeserializer deserializer_;
 };
 
+#ifdef NODE_ENGINE_CHAKRACORE
+// Bytes returned by one JSONReader::read() call.
+static const size_t kJSONReaderChunkSize = 16 * 1024;  // 16kb
+
+// Reads the UTF-8 text of JSON.stringify(value, undefined, space) a chunk at
+// a time. Only the chunk being read is ever in memory, so a caller that
+// reads the next chunk once the last one has been consumed needs memory
+// bounded by the chunk size, whatever the size of the text.
+class JSONReaderContext : public BaseObject {
+ public:
+  JSONReaderContext(Environment* env,
+                    Local<Object> wrap,
+                    v8::JSON::Utf8Reader* reader);
+
+  ~JSONReaderContext() {}
+
+  static void New(const FunctionCallbackInfo<Value>& args);
+  static void Read(const FunctionCallbackInfo<Value>& args);
+ private:
+  std::unique_ptr<v8::JSON::Utf8Reader> reader_;
+};
+#endif  // NODE_ENGINE_CHAKRACORE
+
 SerializerContext::SerializerContext(Environment* env, Local<Object> wrap)
   : BaseObject(env, wrap),
     serializer_(env->isolate(), this) {
@@ -424,6 +447,58 @@ void DeserializerContext::ReadRawBytes(
   args.GetReturnValue().Set(offset);
 }
 
+#ifdef NODE_ENGINE_CHAKRACORE
+JSONReaderContext::JSONReaderContext(Environment* env,
+                                     Local<Object> wrap,
+                                     v8::JSON::Utf8Reader* reader)
+  : BaseObject(env, wrap),
+    reader_(reader) {
+  MakeWeak<JSONReaderContext>(this);
+}
+
+void JSONReaderContext::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  // Any toJSON() method or getter runs here, so nothing has been read yet if
+  // one of them throws.
+  v8::JSON::Utf8Reader* reader;
+  if (!v8::JSON::NewUtf8Reader(env->context(), args[0], args[1])
+           .To(&reader)) {
+    return;  // Exception pending.
+  }
+
+  // A null reader means that JSON.stringify() would return undefined, and
+  // read() returns undefined right away.
+  new JSONReaderContext(env, args.This(), reader);
+}
+
+void JSONReaderContext::Read(const FunctionCallbackInfo<Value>& args) {
+  JSONReaderContext* ctx;
+  ASSIGN_OR_RETURN_UNWRAP(&ctx, args.Holder());
+
+  if (!ctx->reader_)
+    return;
+
+  char* data = node::Malloc(kJSONReaderChunkSize);
+  size_t length = ctx->reader_->Read(data, kJSONReaderChunkSize);
+  if (length == 0) {
+    // Let go of the serialized value as soon as it has been read.
+    free(data);
+    ctx->reader_.reset();
+    return;
+  }
+
+  if (length < kJSONReaderChunkSize)
+    data = node::Realloc(data, length);
+
+  auto buf = Buffer::New(ctx->env(), data, length);
+
+  if (!buf.IsEmpty()) {
+    args.GetReturnValue().Set(buf.ToLocalChecked());
+  }
+}
+#endif  // NODE_ENGINE_CHAKRACORE
+
 void InitializeSerdesBindings(Local<Object> target,
                               Local<Value> unused,
                               Local<Context> context) {
@@ -478,6 +553,22 @@ void InitializeSerdesBindings(Local<Object> target,
   target->Set(env->context(),
               deserializerString,
               des->GetFunction(env->context()).ToLocalChecked()).FromJust();
+
+#ifdef NODE_ENGINE_CHAKRACORE
+  Local<FunctionTemplate> json =
+      env->NewFunctionTemplate(JSONReaderContext::New);
+
+  json->InstanceTemplate()->SetInternalFieldCount(1);
+
+  env->SetProtoMethod(json, "read", JSONReaderContext::Read);
+
+  Local<String> jsonReaderString =
+      FIXED_ONE_BYTE_STRING(env->isolate(), "JSONReader");
+  json->SetClassName(jsonReaderString);
+  target->Set(env->context(),
+              jsonReaderString,
+              json->GetFunction(env->context()).ToLocalChecked()).FromJust();
+#endif  // NODE_ENGINE_CHAKRACORE
 }
 
 }  // anonymous namespace
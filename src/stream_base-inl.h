@@ -129,6 +129,10 @@ inline StreamBase::StreamBase(Environment* env) : env_(env) {
   PushStreamListener(&default_listener_);
 }
 
+inline StreamBase::~StreamBase() {
+  free(writev_scratch_);
+}
+
 inline Environment* StreamBase::stream_env() const {
   return env_;
 }
@@ -72,6 +72,23 @@ inline void SetWriteResultPropertiesOnWrapObject(
       Boolean::New(env->isolate(), res.async)).FromJust();
 }
 
+// Returns whether `data` can be written as-is for a string with one-byte
+// contents in the given encoding.
+static bool CanWriteOneByteDirectly(const char* data,
+                                    size_t length,
+                                    enum encoding encoding) {
+  if (encoding == LATIN1)
+    return true;
+  if (encoding != UTF8 && encoding != ASCII)
+    return false;
+  for (size_t i = 0; i < length; i++) {
+    if (static_cast<unsigned char>(data[i]) >= 0x80)
+      return false;
+  }
+  return true;
+}
+
+
 int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
 
@@ -93,26 +110,70 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   size_t storage_size = 0;
   uint32_t bytes = 0;
   size_t offset;
+  bool has_external = false;
+
+  // String chunks that need to be encoded into the storage, and their
+  // encodings. Buffer chunks and strings that are written from their
+  // external backing store directly are filled in right away.
+  MaybeStackBuffer<Local<String>, 16> strings(all_buffers ? 0 : count);
+  MaybeStackBuffer<enum encoding, 16> encodings(all_buffers ? 0 : count);
 
   if (!all_buffers) {
     // Determine storage size first
     for (size_t i = 0; i < count; i++) {
       Local<Value> chunk = chunks->Get(i * 2);
+      strings[i] = Local<String>();
 
-      if (Buffer::HasInstance(chunk))
-        continue;
+      if (Buffer::HasInstance(chunk)) {
         // Buffer chunk, no additional storage required
+        bufs[i].base = Buffer::Data(chunk);
+        bufs[i].len = Buffer::Length(chunk);
+        bytes += bufs[i].len;
+        continue;
+      }
 
       // String chunk
+      bool is_string = chunk->IsString();
       Local<String> string = chunk->ToString(env->context()).ToLocalChecked();
       enum encoding encoding = ParseEncoding(env->isolate(),
                                              chunks->Get(i * 2 + 1));
+
+      // External one-byte strings (and two-byte ones written as UCS-2 on
+      // little-endian machines) already have their bytes in the right
+      // format, write them without copying. The chunks array keeps them
+      // alive until the write is done.
+      if (is_string && string->IsExternalOneByte()) {
+        const String::ExternalOneByteStringResource* resource =
+            string->GetExternalOneByteStringResource();
+        if (CanWriteOneByteDirectly(resource->data(),
+                                    resource->length(),
+                                    encoding)) {
+          bufs[i].base = const_cast<char*>(resource->data());
+          bufs[i].len = resource->length();
+          bytes += bufs[i].len;
+          has_external = true;
+          continue;
+        }
+      } else if (is_string && encoding == UCS2 && IsLittleEndian() &&
+                 string->IsExternal()) {
+        const String::ExternalStringResource* resource =
+            string->GetExternalStringResource();
+        bufs[i].base = reinterpret_cast<char*>(
+            const_cast<uint16_t*>(resource->data()));
+        bufs[i].len = resource->length() * sizeof(uint16_t);
+        bytes += bufs[i].len;
+        has_external = true;
+        continue;
+      }
+
       size_t chunk_size;
       if (encoding == UTF8 && string->Length() > 65535)
         chunk_size = StringBytes::Size(env->isolate(), string, encoding);
       else
         chunk_size = StringBytes::StorageSize(env->isolate(), string, encoding);
 
+      strings[i] = string;
+      encodings[i] = encoding;
       storage_size += chunk_size;
     }
 
@@ -127,36 +188,41 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
     }
   }
 
+  // Small writes reuse the storage of the last write that completed
+  // synchronously.
   std::unique_ptr<char[], Free> storage;
-  if (storage_size > 0)
-    storage = std::unique_ptr<char[], Free>(Malloc(storage_size));
+  if (storage_size > 0) {
+    if (storage_size <= writev_scratch_size_) {
+      storage = std::unique_ptr<char[], Free>(writev_scratch_);
+      storage_size = writev_scratch_size_;
+      writev_scratch_ = nullptr;
+      writev_scratch_size_ = 0;
+    } else {
+      // The scratch is too small, it is replaced by this storage if the
+      // write completes synchronously.
+      free(writev_scratch_);
+      writev_scratch_ = nullptr;
+      writev_scratch_size_ = 0;
+      storage = std::unique_ptr<char[], Free>(Malloc(storage_size));
+    }
+  }
 
   offset = 0;
-  if (!all_buffers) {
+  if (storage_size > 0) {
     for (size_t i = 0; i < count; i++) {
-      Local<Value> chunk = chunks->Get(i * 2);
-
-      // Write buffer
-      if (Buffer::HasInstance(chunk)) {
-        bufs[i].base = Buffer::Data(chunk);
-        bufs[i].len = Buffer::Length(chunk);
-        bytes += bufs[i].len;
+      if (strings[i].IsEmpty())
         continue;
-      }
 
       // Write string
       CHECK_LE(offset, storage_size);
       char* str_storage = storage.get() + offset;
       size_t str_size = storage_size - offset;
 
-      Local<String> string = chunk->ToString(env->context()).ToLocalChecked();
-      enum encoding encoding = ParseEncoding(env->isolate(),
-                                             chunks->Get(i * 2 + 1));
       str_size = StringBytes::Write(env->isolate(),
                                     str_storage,
                                     str_size,
-                                    string,
-                                    encoding);
+                                    strings[i],
+                                    encodings[i]);
       bufs[i].base = str_storage;
       bufs[i].len = str_size;
       offset += str_size;
@@ -166,8 +232,17 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
 
   StreamWriteResult res = Write(*bufs, count, nullptr, req_wrap_obj);
   SetWriteResultPropertiesOnWrapObject(env, req_wrap_obj, res, bytes);
-  if (res.wrap != nullptr && storage) {
-    res.wrap->SetAllocatedStorage(storage.release(), storage_size);
+  if (res.wrap != nullptr) {
+    if (storage)
+      res.wrap->SetAllocatedStorage(storage.release(), storage_size);
+    if (has_external) {
+      req_wrap_obj->Set(env->context(), env->buffer_string(), chunks)
+          .FromJust();
+    }
+  } else if (storage && storage_size <= kMaxWritevScratchSize) {
+    // Nothing refers to the storage anymore, keep it for the next write.
+    writev_scratch_ = storage.release();
+    writev_scratch_size_ = storage_size;
   }
   return res.err;
 }
@@ -361,6 +436,15 @@ uv_buf_t StreamListener::OnStreamAlloc(size_t suggested_size) {
 }
 
 
+uv_buf_t EmitToJSStreamListener::OnStreamAlloc(size_t suggested_size) {
+  CHECK_NE(stream_, nullptr);
+  Environment* env = static_cast<StreamBase*>(stream_)->stream_env();
+  if (env->stream_read_buffer() == nullptr)
+    env->set_stream_read_buffer(Malloc(kReadBufferSize));
+  return uv_buf_init(env->stream_read_buffer(), kReadBufferSize);
+}
+
+
 void EmitToJSStreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   CHECK_NE(stream_, nullptr);
   StreamBase* stream = static_cast<StreamBase*>(stream_);
@@ -369,15 +453,27 @@ void EmitToJSStreamListener::OnStreamRead(ssize_t nread, const uv_buf_t& buf) {
   Context::Scope context_scope(env->context());
 
   if (nread <= 0)  {
-    free(buf.base);
     if (nread < 0)
       stream->CallJSOnreadMethod(nread, Local<Object>());
     return;
   }
 
   CHECK_LE(static_cast<size_t>(nread), buf.len);
-
-  Local<Object> obj = Buffer::New(env, buf.base, nread).ToLocalChecked();
+  CHECK_EQ(buf.base, env->stream_read_buffer());
+
+  // Small reads are copied out, so that the Buffer does not keep the whole
+  // read buffer alive and the read buffer can be used again right away.
+  // Larger reads take over the read buffer, shrunk to fit, and the next read
+  // allocates a new one. Either way the Buffer's ArrayBuffer only contains
+  // this read.
+  Local<Object> obj;
+  if (static_cast<size_t>(nread) <= kMaxCopySize) {
+    obj = Buffer::Copy(env, buf.base, nread).ToLocalChecked();
+  } else {
+    env->set_stream_read_buffer(nullptr);
+    char* data = Realloc(buf.base, nread);
+    obj = Buffer::New(env, data, nread).ToLocalChecked();
+  }
   stream->CallJSOnreadMethod(nread, obj);
 }
 
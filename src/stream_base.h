@@ -157,9 +157,17 @@ class ReportWritesToJSStreamListener : public StreamListener {
 
 // A default emitter that just pushes data chunks as Buffer instances to
 // JS land via the handle’s .ondata method.
+// Reads go into a buffer that is shared by all streams of an Environment.
 class EmitToJSStreamListener : public ReportWritesToJSStreamListener {
  public:
+  uv_buf_t OnStreamAlloc(size_t suggested_size) override;
   void OnStreamRead(ssize_t nread, const uv_buf_t& buf) override;
+
+ private:
+  static const size_t kReadBufferSize = 64 * 1024;
+  // Reads up to this size are copied out of the read buffer, like the
+  // Buffer pool's size.
+  static const size_t kMaxCopySize = 8 * 1024;
 };
 
 
@@ -238,6 +246,8 @@ class StreamBase : public StreamResource {
                                 v8::Local<v8::FunctionTemplate> target,
                                 int flags = kFlagNone);
 
+  ~StreamBase() override;
+
   virtual bool IsAlive() = 0;
   virtual bool IsClosing() = 0;
   virtual bool IsIPCPipe();
@@ -303,8 +313,13 @@ class StreamBase : public StreamResource {
   static void JSMethod(const v8::FunctionCallbackInfo<v8::Value>& args);
 
  private:
+  // Largest string storage that is kept around for the next Writev() call.
+  static const size_t kMaxWritevScratchSize = 64 * 1024;
+
   Environment* env_;
   EmitToJSStreamListener default_listener_;
+  char* writev_scratch_ = nullptr;
+  size_t writev_scratch_size_ = 0;
 
   // These are called by the respective {Write,Shutdown}Wrap class.
   void AfterShutdown(ShutdownWrap* req, int status);
@@ -122,8 +122,8 @@ class ExternString: public ResourceType {
                                                                    data,
                                                                    length);
     // CHAKRA-TODO: Revert this change. Currently chakrashim
-    // String::NewExternal deletes h_str immediately. Avoid accessing h_str
-    // after passing it to String::NewExternal.
+    // String::NewExternalTwoByte deletes h_str immediately. Avoid accessing
+    // h_str after passing it to String::NewExternal.
     size_t byte_length = h_str->byte_length();
     MaybeLocal<Value> str = NewExternal(isolate, h_str);
     isolate->AdjustAmountOfExternalAllocatedMemory(byte_length);
@@ -665,6 +665,11 @@ MaybeLocal<Value> StringBytes::Encode(Isolate* isolate,
       }
 
     case UTF8:
+      // Large ASCII text is the same in Latin-1, and is kept as an external
+      // string rather than being decoded.
+      if (buflen >= EXTERN_APEX && !contains_non_ascii(buf, buflen))
+        return ExternOneByteString::NewFromCopy(isolate, buf, buflen, error);
+
       val = String::NewFromUtf8(isolate,
                                 buf,
                                 v8::NewStringType::kNormal,
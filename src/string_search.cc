@@ -1,5 +1,17 @@
 #include "string_search.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// Intrinsics of any instruction set can be used in any function.
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
 namespace node {
 namespace stringsearch {
 
@@ -7,5 +19,205 @@ int StringSearchBase::kBadCharShiftTable[kUC16AlphabetSize];
 int StringSearchBase::kGoodSuffixShiftTable[kBMMaxShift + 1];
 int StringSearchBase::kSuffixTable[kBMMaxShift + 1];
 
+#ifdef NODE_STRING_SEARCH_SIMD
+
+namespace {
+
+bool IsAvx2Supported() {
+#ifdef _MSC_VER
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7)
+    return false;
+
+  // The OS must save the AVX registers (OSXSAVE, and XMM and YMM state in
+  // XCR0).
+  __cpuid(info, 1);
+  const int osxsave_and_avx = (1 << 27) | (1 << 28);
+  if ((info[2] & osxsave_and_avx) != osxsave_and_avx ||
+      (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#else
+  // Also checks that the OS saves the AVX registers.
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+// SSE2 is part of the x64 baseline.
+const SimdLevel kSupportedSimdLevel =
+    IsAvx2Supported() ? SimdLevel::kAvx2 : SimdLevel::kSse2;
+
+inline size_t CountTrailingZeros(uint32_t value) {
+#ifdef _MSC_VER
+  unsigned long index;  // NOLINT(runtime/int)
+  _BitScanForward(&index, value);
+  return index;
+#else
+  return __builtin_ctz(value);
+#endif
+}
+
+template <typename Char>
+inline size_t FindFirstAndLastScalar(const Char* subject,
+                                     size_t index,
+                                     size_t limit,
+                                     Char first,
+                                     Char last,
+                                     size_t last_offset) {
+  for (; index < limit; index++) {
+    if (subject[index] == first && subject[index + last_offset] == last)
+      return index;
+  }
+  return limit;
+}
+
+// The kernels compare a block of candidate positions against the first
+// character of the pattern, and the block `last_offset` characters further
+// on against its last character. Both loads stay within the subject because
+// the last candidate position is `limit - 1`.
+
+size_t FindFirstAndLastSse2(const uint8_t* subject,
+                            size_t index,
+                            size_t limit,
+                            uint8_t first,
+                            uint8_t last,
+                            size_t last_offset) {
+  const __m128i first_block = _mm_set1_epi8(static_cast<char>(first));
+  const __m128i last_block = _mm_set1_epi8(static_cast<char>(last));
+  for (; index + 16 <= limit; index += 16) {
+    const __m128i starts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index));
+    const __m128i ends = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index + last_offset));
+    const uint32_t mask = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(starts, first_block),
+                      _mm_cmpeq_epi8(ends, last_block)));
+    if (mask != 0)
+      return index + CountTrailingZeros(mask);
+  }
+  return FindFirstAndLastScalar(subject, index, limit, first, last,
+                                last_offset);
+}
+
+size_t FindFirstAndLastSse2(const uint16_t* subject,
+                            size_t index,
+                            size_t limit,
+                            uint16_t first,
+                            uint16_t last,
+                            size_t last_offset) {
+  const __m128i first_block = _mm_set1_epi16(static_cast<int16_t>(first));
+  const __m128i last_block = _mm_set1_epi16(static_cast<int16_t>(last));
+  for (; index + 8 <= limit; index += 8) {
+    const __m128i starts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index));
+    const __m128i ends = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + index + last_offset));
+    // Two mask bits per character.
+    const uint32_t mask = _mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi16(starts, first_block),
+                      _mm_cmpeq_epi16(ends, last_block)));
+    if (mask != 0)
+      return index + CountTrailingZeros(mask) / 2;
+  }
+  return FindFirstAndLastScalar(subject, index, limit, first, last,
+                                last_offset);
+}
+
+TARGET_AVX2
+size_t FindFirstAndLastAvx2(const uint8_t* subject,
+                            size_t index,
+                            size_t limit,
+                            uint8_t first,
+                            uint8_t last,
+                            size_t last_offset) {
+  const __m256i first_block = _mm256_set1_epi8(static_cast<char>(first));
+  const __m256i last_block = _mm256_set1_epi8(static_cast<char>(last));
+  for (; index + 32 <= limit; index += 32) {
+    const __m256i starts = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index));
+    const __m256i ends = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index + last_offset));
+    const uint32_t mask = _mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(starts, first_block),
+                         _mm256_cmpeq_epi8(ends, last_block)));
+    if (mask != 0)
+      return index + CountTrailingZeros(mask);
+  }
+  return FindFirstAndLastScalar(subject, index, limit, first, last,
+                                last_offset);
+}
+
+TARGET_AVX2
+size_t FindFirstAndLastAvx2(const uint16_t* subject,
+                            size_t index,
+                            size_t limit,
+                            uint16_t first,
+                            uint16_t last,
+                            size_t last_offset) {
+  const __m256i first_block = _mm256_set1_epi16(static_cast<int16_t>(first));
+  const __m256i last_block = _mm256_set1_epi16(static_cast<int16_t>(last));
+  for (; index + 16 <= limit; index += 16) {
+    const __m256i starts = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index));
+    const __m256i ends = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(subject + index + last_offset));
+    // Two mask bits per character.
+    const uint32_t mask = _mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi16(starts, first_block),
+                         _mm256_cmpeq_epi16(ends, last_block)));
+    if (mask != 0)
+      return index + CountTrailingZeros(mask) / 2;
+  }
+  return FindFirstAndLastScalar(subject, index, limit, first, last,
+                                last_offset);
+}
+
+}  // anonymous namespace
+
+SimdLevel simd_level = kSupportedSimdLevel;
+
+void SetSimdLevel(SimdLevel level) {
+  simd_level = level < kSupportedSimdLevel ? level : kSupportedSimdLevel;
+}
+
+size_t FindFirstAndLastCharacter(const uint8_t* subject,
+                                 size_t index,
+                                 size_t limit,
+                                 uint8_t first,
+                                 uint8_t last,
+                                 size_t last_offset) {
+  if (simd_level == SimdLevel::kAvx2)
+    return FindFirstAndLastAvx2(subject, index, limit, first, last,
+                                last_offset);
+  return FindFirstAndLastSse2(subject, index, limit, first, last,
+                              last_offset);
+}
+
+size_t FindFirstAndLastCharacter(const uint16_t* subject,
+                                 size_t index,
+                                 size_t limit,
+                                 uint16_t first,
+                                 uint16_t last,
+                                 size_t last_offset) {
+  if (simd_level == SimdLevel::kAvx2)
+    return FindFirstAndLastAvx2(subject, index, limit, first, last,
+                                last_offset);
+  return FindFirstAndLastSse2(subject, index, limit, first, last,
+                              last_offset);
+}
+
+#else
+
+SimdLevel simd_level = SimdLevel::kScalar;
+
+void SetSimdLevel(SimdLevel level) {}
+
+#endif  // NODE_STRING_SEARCH_SIMD
+
 }  // namespace stringsearch
 }  // namespace node
@@ -23,6 +23,38 @@ T Max(T a, T b) {
 
 static const uint32_t kMaxOneByteCharCodeU = 0xff;
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define NODE_STRING_SEARCH_SIMD 1
+#endif
+
+// Instruction set used to filter match candidates in forward searches.
+// kScalar only searches for the first character of the pattern, with memchr.
+enum class SimdLevel { kScalar, kSse2, kAvx2 };
+
+// Defaults to the best level the CPU supports.
+extern SimdLevel simd_level;
+
+// Lowers the level (for testing); it can't be raised above what is supported.
+void SetSimdLevel(SimdLevel level);
+
+#ifdef NODE_STRING_SEARCH_SIMD
+// Returns the first position in [index, limit) at which `subject` holds
+// `first`, and `last` is found `last_offset` characters later, or `limit` if
+// there is none. `limit + last_offset` must not exceed the subject length.
+size_t FindFirstAndLastCharacter(const uint8_t* subject,
+                                 size_t index,
+                                 size_t limit,
+                                 uint8_t first,
+                                 uint8_t last,
+                                 size_t last_offset);
+size_t FindFirstAndLastCharacter(const uint16_t* subject,
+                                 size_t index,
+                                 size_t limit,
+                                 uint16_t first,
+                                 uint16_t last,
+                                 size_t last_offset);
+#endif
+
 template <typename T>
 class Vector {
  public:
@@ -313,6 +345,37 @@ inline size_t FindFirstCharacter(Vector<const uint8_t> pattern,
   return subject.forward() ? raw_pos : (subj_len - raw_pos - 1);
 }
 
+// memchr() is fastest at skipping over a first character that is rare. Once
+// this many candidates it found have turned out not to match, forward
+// searches also check the last character of the pattern, with SIMD
+// instructions, so that most false candidates are never visited.
+static const size_t kFalseCandidatesBeforeFiltering = 8;
+
+// Finds the next position at which the first character of the pattern
+// matches, and, depending on `false_candidates`, the last character too.
+// Does not check the characters in between.
+template <typename Char>
+inline size_t FindCandidate(Vector<const Char> pattern,
+                            Vector<const Char> subject,
+                            size_t index,
+                            size_t false_candidates) {
+#ifdef NODE_STRING_SEARCH_SIMD
+  if (false_candidates >= kFalseCandidatesBeforeFiltering &&
+      subject.forward() && simd_level != SimdLevel::kScalar) {
+    const size_t last_offset = pattern.length() - 1;
+    const size_t max_n = subject.length() - last_offset;
+    const size_t pos = FindFirstAndLastCharacter(subject.start(),
+                                                 index,
+                                                 max_n,
+                                                 pattern[0],
+                                                 pattern[last_offset],
+                                                 last_offset);
+    return pos == max_n ? subject.length() : pos;
+  }
+#endif
+  return FindFirstCharacter(pattern, subject, index);
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -340,8 +403,9 @@ size_t StringSearch<Char>::LinearSearch(
   CHECK_GT(pattern.length(), 1);
   const size_t pattern_length = pattern.length();
   const size_t n = subject.length() - pattern_length;
+  size_t false_candidates = 0;
   for (size_t i = index; i <= n; i++) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindCandidate(pattern, subject, i, false_candidates);
     if (i == subject.length())
       return subject.length();
     CHECK_LE(i, n);
@@ -356,6 +420,7 @@ size_t StringSearch<Char>::LinearSearch(
     if (matches) {
       return i;
     }
+    false_candidates++;
   }
   return subject.length();
 }
@@ -584,13 +649,14 @@ size_t StringSearch<Char>::InitialSearch(
   // done enough work we decide it's probably worth switching to a better
   // algorithm.
   int64_t badness = -10 - (pattern_length << 2);
+  size_t false_candidates = 0;
 
   // We know our pattern is at least 2 characters, we cache the first so
   // the common case of the first character not matching is faster.
   for (size_t i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindCandidate(pattern, subject, i, false_candidates);
       if (i == subject.length())
         return subject.length();
       CHECK_LE(i, n);
@@ -605,6 +671,7 @@ size_t StringSearch<Char>::InitialSearch(
         return i;
       }
       badness += j;
+      false_candidates++;
     } else {
       search->PopulateBoyerMooreHorspoolTable();
       search->strategy_ = &BoyerMooreHorspoolSearch;
@@ -0,0 +1,96 @@
+#include "string_search.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using node::SearchString;
+using node::stringsearch::SetSimdLevel;
+using node::stringsearch::SimdLevel;
+
+namespace {
+
+// Deterministic, so that failures can be reproduced.
+class Random {
+ public:
+  explicit Random(uint32_t seed) : state_(seed) {}
+  size_t operator()(size_t bound) {
+    state_ = state_ * 1103515245 + 12345;
+    return (state_ >> 16) % bound;
+  }
+
+ private:
+  uint32_t state_;
+};
+
+template <typename Char>
+size_t NaiveSearch(const std::vector<Char>& haystack,
+                   const std::vector<Char>& needle,
+                   size_t start_index,
+                   bool is_forward) {
+  const size_t diff = haystack.size() - needle.size();
+  const size_t size = needle.size() * sizeof(Char);
+  if (is_forward) {
+    for (size_t i = start_index; i <= diff; i++) {
+      if (memcmp(&haystack[i], &needle[0], size) == 0)
+        return i;
+    }
+  } else {
+    for (size_t i = (start_index < diff ? start_index : diff) + 1; i-- > 0;) {
+      if (memcmp(&haystack[i], &needle[0], size) == 0)
+        return i;
+    }
+  }
+  return haystack.size();
+}
+
+// Small alphabets make for many partial matches, which exercises the
+// filtering of candidates as well as the Boyer-Moore(-Horspool) fallbacks.
+template <typename Char>
+void CompareWithNaiveSearch(int alphabet_size) {
+  Random random(alphabet_size);
+  for (int i = 0; i < 5000; i++) {
+    std::vector<Char> haystack(1 + random(300));
+    std::vector<Char> needle(1 + random(i % 10 == 0 ? 40 : 12));
+    if (needle.size() > haystack.size())
+      continue;
+
+    // Both bytes of two-byte characters vary.
+    for (Char& c : haystack)
+      c = static_cast<Char>(random(alphabet_size) * 0x0101);
+    for (Char& c : needle)
+      c = static_cast<Char>(random(alphabet_size) * 0x0101);
+    if (random(2) == 0) {
+      memcpy(&haystack[random(haystack.size() - needle.size() + 1)],
+             &needle[0],
+             needle.size() * sizeof(Char));
+    }
+
+    const bool is_forward = random(2) == 0;
+    const size_t start_index =
+        random(haystack.size() - needle.size() + 1);
+    EXPECT_EQ(NaiveSearch(haystack, needle, start_index, is_forward),
+              SearchString(&haystack[0], haystack.size(),
+                           &needle[0], needle.size(),
+                           start_index, is_forward));
+  }
+}
+
+}  // anonymous namespace
+
+TEST(StringSearchTest, MatchesNaiveSearchAtEverySimdLevel) {
+  for (SimdLevel level : { SimdLevel::kAvx2,
+                           SimdLevel::kSse2,
+                           SimdLevel::kScalar }) {
+    SetSimdLevel(level);
+    for (int alphabet_size : { 2, 4, 26 }) {
+      CompareWithNaiveSearch<uint8_t>(alphabet_size);
+      CompareWithNaiveSearch<uint16_t>(alphabet_size);
+    }
+  }
+  SetSimdLevel(SimdLevel::kAvx2);
+}
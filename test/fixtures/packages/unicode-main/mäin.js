@@ -0,0 +1,2 @@
+'use strict';
+exports.ok = 'ok';
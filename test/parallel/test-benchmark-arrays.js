@@ -4,4 +4,4 @@ require('../common');
 
 const runBenchmark = require('../common/benchmark');
 
-runBenchmark('arrays', ['n=1', 'type=Array']);
+runBenchmark('arrays', ['n=1', 'size=1e1', 'type=Array']);
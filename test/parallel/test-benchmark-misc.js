@@ -6,9 +6,15 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('misc', [
   'concat=0',
+  'encoding=utf8',
+  'files=1',
   'method=',
   'millions=.000001',
   'n=1',
+  'percentile=50',
+  'retained=1',
+  'rounds=1',
+  'size=64',
   'type=extend',
   'val=magyarország.icom.museum'
 ], { NODEJS_BENCHMARK_ZERO_ALLOWED: 1 });
@@ -5,6 +5,8 @@ require('../common');
 const runBenchmark = require('../common/benchmark');
 
 runBenchmark('module', [
+  'n=1',
+  'modules=1',
   'thousands=.001',
   'useCache=true',
   'fullPath=true'
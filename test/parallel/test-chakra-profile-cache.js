@@ -0,0 +1,151 @@
+'use strict';
+const common = require('../common');
+if (!common.isChakraEngine)
+  common.skip('--chakra-profile-cache requires ChakraCore');
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const spawnSync = require('child_process').spawnSync;
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+// Layout of the profile files, see ProfileCache::FileHeader
+const kMagic = 20180117;
+const kFormatVersion = 1;
+const kHeaderLength = 48;
+
+const scriptFile = path.join(tmpdir.path, 'profiled.js');
+const otherScriptFile = path.join(tmpdir.path, 'other.js');
+const baseScriptFile = path.join(tmpdir.path, 'base.js');
+
+const scriptSource = `'use strict';
+function first() {
+  var sum = 0;
+  for (var i = 0; i < 1000; i++)
+    sum += i;
+  return sum;
+}
+function second() {
+  var product = 1;
+  for (var i = 1; i < 10; i++)
+    product *= i;
+  return product;
+}
+console.log(process.argv[2] === 'first' ? first() : second());
+`;
+fs.writeFileSync(scriptFile, scriptSource);
+fs.writeFileSync(otherScriptFile, `// A different source\n${scriptSource}`);
+// Loads the same parts of node as the script, without any functions
+fs.writeFileSync(baseScriptFile,
+                 "console.log(process.argv[2] === 'first' ? 499500 : 362880);");
+
+function run(cacheDir, file, mode) {
+  const child = spawnSync(process.execPath,
+                          [`--chakra-profile-cache=${cacheDir}`, file, mode]);
+  assert.strictEqual(child.status, 0, String(child.stderr));
+  assert.strictEqual(child.stdout.toString().trim(),
+                     mode === 'first' ? '499500' : '362880');
+}
+
+// node's own scripts have profile files too, so find the file of the script
+// by leaving out the ones a run of the base script leaves behind.
+const baseDir = path.join(tmpdir.path, 'base');
+run(baseDir, baseScriptFile, 'first');
+const baseFiles = fs.readdirSync(baseDir);
+
+function getProfileFile(cacheDir) {
+  const files = fs.readdirSync(cacheDir);
+  assert.deepStrictEqual(files.filter((file) => !file.endsWith('.profile')),
+                         []);
+  const scriptFiles = files.filter((file) => !baseFiles.includes(file));
+  assert.strictEqual(scriptFiles.length, 1);
+  return path.join(cacheDir, scriptFiles[0]);
+}
+
+function hex(value) {
+  return `0000000${value.toString(16)}`.slice(-8);
+}
+
+// Checks the file and returns the bit vector of the functions that have been
+// executed with it.
+function readExecutedFunctions(file) {
+  const data = fs.readFileSync(file);
+  assert(data.length > kHeaderLength);
+  assert.strictEqual(data.readUInt32LE(0), kMagic);
+  assert.strictEqual(data.readUInt32LE(4), kFormatVersion);
+  const pointerSize = data.readUInt32LE(16);
+  assert(pointerSize === 4 || pointerSize === 8);
+  assert.strictEqual(
+    path.basename(file),
+    `${hex(data.readUInt32LE(28))}${hex(data.readUInt32LE(24))}.profile`);
+  assert.strictEqual(data.readUInt32LE(36), 0);
+  assert.strictEqual(data.length, kHeaderLength + data.readUInt32LE(32));
+
+  // The payload starts with the bit vector of hot functions, followed by the
+  // serialized BVFixed of executed functions.
+  const functionCount = data.readUInt32LE(kHeaderLength);
+  const vectorLength =
+    Math.ceil(functionCount / (pointerSize * 8)) * pointerSize;
+  const executed = kHeaderLength + 4 + vectorLength;
+  assert.strictEqual(data.readUInt32LE(executed), functionCount);
+  return data.slice(executed + pointerSize,
+                    executed + pointerSize + vectorLength);
+}
+
+function or(a, b) {
+  assert.strictEqual(a.length, b.length);
+  const result = Buffer.alloc(a.length);
+  for (let i = 0; i < a.length; i++)
+    result[i] = a[i] | b[i];
+  return result;
+}
+
+// The first run writes the profile file.
+const firstDir = path.join(tmpdir.path, 'first');
+run(firstDir, scriptFile, 'first');
+const profileFile = getProfileFile(firstDir);
+const firstProfile = fs.readFileSync(profileFile);
+const firstExecuted = readExecutedFunctions(profileFile);
+
+const secondDir = path.join(tmpdir.path, 'second');
+run(secondDir, scriptFile, 'second');
+const secondExecuted = readExecutedFunctions(getProfileFile(secondDir));
+assert.notDeepStrictEqual(or(firstExecuted, secondExecuted), secondExecuted);
+
+// A later run reuses the file, so the functions executed by both runs are
+// saved.
+run(firstDir, scriptFile, 'second');
+assert.strictEqual(getProfileFile(firstDir), profileFile);
+assert.deepStrictEqual(readExecutedFunctions(profileFile),
+                       or(firstExecuted, secondExecuted));
+
+// Files that don't match the script or the engine are ignored and replaced.
+const otherDir = path.join(tmpdir.path, 'other');
+run(otherDir, otherScriptFile, 'first');
+const otherProfile = fs.readFileSync(getProfileFile(otherDir));
+
+function testRejected(data) {
+  fs.writeFileSync(profileFile, data);
+  run(firstDir, scriptFile, 'second');
+  assert.strictEqual(getProfileFile(firstDir), profileFile);
+  assert.deepStrictEqual(readExecutedFunctions(profileFile), secondExecuted);
+}
+
+// Corrupted
+const corrupted = Buffer.from(firstProfile);
+corrupted[corrupted.length - 1] ^= 1;
+testRejected(corrupted);
+
+// Truncated
+testRejected(firstProfile.slice(0, firstProfile.length - 1));
+testRejected(firstProfile.slice(0, kHeaderLength));
+
+// Different source
+testRejected(otherProfile);
+
+// Different build
+const otherBuild = Buffer.from(firstProfile);
+otherBuild.writeUInt32LE(otherBuild.readUInt32LE(8) ^ 1, 8);
+testRejected(otherBuild);
@@ -23,6 +23,12 @@ if (!common.isChakraEngine) {
   // ChakraCore does not yet support trace events
   expect('--trace-events-enabled', 'B\n');
 }
+if (common.isChakraEngine) {
+  expect('--chakra-bytecode-cache=_', 'B\n');
+  expect('--chakra-profile-cache=_', 'B\n');
+  expect('--chakra-recycler-huge-pages', 'B\n');
+  expect('--chakra-idle-reset-pages', 'B\n');
+}
 expect('--track-heap-objects', 'B\n');
 expect('--throw-deprecation', 'B\n');
 expect('--zero-fill-buffers', 'B\n');
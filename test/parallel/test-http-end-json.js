@@ -0,0 +1,100 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+
+// response.endJSON(value, space, callback) sends the same bytes as
+// response.end(JSON.stringify(value, null, space), callback). On ChakraCore a
+// large body is written a chunk at a time instead of as one string.
+const small = {
+  text: 'café \u{1f600} "quoted" \\ \n\t\u0001',
+  lone: '\ud800',
+  list: [1, -2.5, 1e21, null, true, false, {}, []],
+  nested: { toJSON() { return { replaced: 'yes' }; } }
+};
+
+const large = [];
+for (let i = 0; i < 20000; i++)
+  large.push({ id: i, name: `item ${i} é\u{1f600}`, tags: ['a', 'b'] });
+
+const cases = {
+  '/small': {
+    value: small,
+    space: undefined,
+    expected: JSON.stringify(small)
+  },
+  '/space': {
+    value: small,
+    space: 2,
+    expected: JSON.stringify(small, null, 2)
+  },
+  '/large': {
+    value: large,
+    space: '\t',
+    expected: JSON.stringify(large, null, '\t')
+  },
+  '/undefined': {
+    value: undefined,
+    space: undefined,
+    expected: ''
+  }
+};
+
+const server = http.createServer(common.mustCall((req, res) => {
+  if (req.url === '/throws') {
+    assert.throws(() => {
+      res.endJSON({ a: 1, b: { toJSON() { throw new Error('toJSON'); } } });
+    }, /^Error: toJSON$/);
+    // Nothing has been sent, so the response can still be used.
+    assert.strictEqual(res.headersSent, false);
+    res.end('fallback');
+    return;
+  }
+
+  const { value, space } = cases[req.url];
+  let writes = 0;
+  const write = res.write;
+  res.write = function() {
+    writes++;
+    return write.apply(this, arguments);
+  };
+  res.on('finish', common.mustCall(() => {
+    if (req.url === '/large' && common.isChakraEngine)
+      assert(writes > 1, `${writes} writes`);
+  }));
+  assert.strictEqual(res.endJSON(value, space, common.mustCall()), res);
+}, Object.keys(cases).length + 1));
+
+function get(path, callback) {
+  http.get({ port: server.address().port, path }, common.mustCall((res) => {
+    const chunks = [];
+    res.on('data', (chunk) => chunks.push(chunk));
+    res.on('end', common.mustCall(() => {
+      callback(res, Buffer.concat(chunks));
+    }));
+  }));
+}
+
+server.listen(0, common.mustCall(() => {
+  let pending = Object.keys(cases).length + 1;
+  function done() {
+    if (--pending === 0)
+      server.close();
+  }
+
+  for (const path of Object.keys(cases)) {
+    get(path, (res, body) => {
+      const expected = Buffer.from(cases[path].expected);
+      assert.strictEqual(body.length, expected.length);
+      assert(body.equals(expected), path);
+      if (path !== '/large')
+        assert.strictEqual(res.headers['content-length'], `${expected.length}`);
+      done();
+    });
+  }
+
+  get('/throws', (res, body) => {
+    assert.strictEqual(body.toString(), 'fallback');
+    done();
+  });
+}));
@@ -0,0 +1,178 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const http = require('http');
+const net = require('net');
+
+// The HTTP parser binding builds req.headers itself. It has to produce the
+// same object as IncomingMessage.prototype._addHeaderLine() would from
+// req.rawHeaders, and the JS path has to be used when the binding's object
+// can't be: when maxHeadersCount cuts the headers short, and when
+// _addHeaderLine() is overridden.
+const addHeaderLine = http.IncomingMessage.prototype._addHeaderLine;
+
+function addHeaderLines(rawHeaders, n) {
+  const dest = {};
+  for (let i = 0; i < n; i += 2)
+    addHeaderLine.call({}, rawHeaders[i], rawHeaders[i + 1], dest);
+  return dest;
+}
+
+function assertHeaders(actual, expected, message) {
+  assert.deepStrictEqual(actual, expected, message);
+  assert.deepStrictEqual(Object.keys(actual), Object.keys(expected), message);
+}
+
+const tests = [
+  {
+    name: 'duplicates are joined',
+    headers: [
+      'X-Custom: a',
+      'x-custom: b',
+      'X-CUSTOM: c',
+      'Accept: text/html',
+      'accept: */*',
+      'Cookie: a=1',
+      'cookie: b=2',
+      'COOKIE: c=3',
+      'X-Latin: café',
+      'x-latin: naïve'
+    ],
+    check(req) {
+      assert.strictEqual(req.headers['x-custom'], 'a, b, c');
+      assert.strictEqual(req.headers.accept, 'text/html, */*');
+      assert.strictEqual(req.headers.cookie, 'a=1; b=2; c=3');
+      assert.strictEqual(req.headers['x-latin'], 'café, naïve');
+    }
+  },
+  {
+    name: 'set-cookie is an array',
+    headers: [
+      'Set-Cookie: a=1',
+      'Date: Thu, 01 Jan 1970 00:00:00 GMT',
+      'set-cookie: b=2',
+      'SET-COOKIE: c=3'
+    ],
+    check(req) {
+      assert.deepStrictEqual(req.headers['set-cookie'], ['a=1', 'b=2', 'c=3']);
+    }
+  },
+  {
+    name: 'duplicates of single-value headers are dropped',
+    headers: [
+      'Content-Type: text/plain',
+      'content-type: text/html',
+      'User-Agent: first',
+      'user-agent: second',
+      'Referer: http://a/',
+      'Referer: http://b/',
+      'Authorization: first',
+      'AUTHORIZATION: second',
+      'From: a@example.com',
+      'from: b@example.com',
+      'ETag: "a"',
+      'etag: "b"',
+      'Age: 1',
+      'age: 2',
+      'Server: first',
+      'server: second',
+      'Host: second'
+    ],
+    check(req) {
+      assert.strictEqual(req.headers.host, 'example.com');
+      assert.strictEqual(req.headers['content-type'], 'text/plain');
+      assert.strictEqual(req.headers['user-agent'], 'first');
+      assert.strictEqual(req.headers.referer, 'http://a/');
+      assert.strictEqual(req.headers.authorization, 'first');
+      assert.strictEqual(req.headers.from, 'a@example.com');
+      assert.strictEqual(req.headers.etag, '"a"');
+      assert.strictEqual(req.headers.age, '1');
+      assert.strictEqual(req.headers.server, 'first');
+    }
+  },
+  {
+    name: 'maxHeadersCount cuts the headers short',
+    maxHeadersCount: 4,
+    headers: [
+      'X-Custom: a',
+      'Cookie: a=1',
+      'Set-Cookie: a=1',
+      'x-custom: b',
+      'Cookie: b=2',
+      'Set-Cookie: b=2'
+    ],
+    check(req) {
+      assert.strictEqual(req.rawHeaders.length, 16);
+      assertHeaders(req.headers, {
+        'host': 'example.com',
+        'x-custom': 'a',
+        'cookie': 'a=1',
+        'set-cookie': ['a=1']
+      });
+    }
+  },
+  {
+    name: '_addHeaderLine() is overridden',
+    options: {
+      IncomingMessage: class extends http.IncomingMessage {
+        _addHeaderLine(field, value, dest) {
+          this.addedHeaderLines = (this.addedHeaderLines || 0) + 1;
+          super._addHeaderLine(field, `<${value}>`, dest);
+        }
+      }
+    },
+    headers: [
+      'X-Custom: a',
+      'x-custom: b',
+      'Cookie: a=1',
+      'Set-Cookie: a=1'
+    ],
+    expected(req) {
+      const dest = {};
+      for (let i = 0; i < req.rawHeaders.length; i += 2) {
+        addHeaderLine.call({}, req.rawHeaders[i], `<${req.rawHeaders[i + 1]}>`,
+                           dest);
+      }
+      return dest;
+    },
+    check(req) {
+      assert.strictEqual(req.addedHeaderLines, req.rawHeaders.length / 2);
+      assert.strictEqual(req.headers['x-custom'], '<a>, <b>');
+      assert.strictEqual(req.headers.cookie, '<a=1>');
+      assert.deepStrictEqual(req.headers['set-cookie'], ['<a=1>']);
+    }
+  }
+];
+
+function runTest(test, callback) {
+  const server = http.createServer(test.options || {}, common.mustCall(
+    (req, res) => {
+      const n = test.maxHeadersCount ?
+        test.maxHeadersCount * 2 : req.rawHeaders.length;
+      const expected = test.expected ?
+        test.expected(req) : addHeaderLines(req.rawHeaders, n);
+      assertHeaders(req.headers, expected, test.name);
+      test.check(req);
+      res.end();
+    }));
+  if (test.maxHeadersCount)
+    server.maxHeadersCount = test.maxHeadersCount;
+
+  server.listen(0, common.mustCall(() => {
+    const client = net.connect(server.address().port, common.mustCall(() => {
+      const request = ['GET / HTTP/1.1', 'Host: example.com']
+        .concat(test.headers, 'Connection: close', '', '')
+        .join('\r\n');
+      client.end(request, 'latin1');
+    }));
+    client.resume();
+    client.on('end', common.mustCall(() => {
+      server.close(callback);
+    }));
+  }));
+}
+
+(function next(i) {
+  if (i < tests.length)
+    runTest(tests[i], common.mustCall(() => next(i + 1)));
+})(0);
@@ -0,0 +1,131 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const fs = require('fs');
+const http = require('http');
+const net = require('net');
+const path = require('path');
+
+// The HTTP parser binding combines duplicate headers using its table of known
+// headers, HTTP_KNOWN_HEADERS in src/node_http_parser.h, while the JS path
+// uses matchKnownFields() in lib/_http_incoming.js. Check that both agree on
+// every header in either of them.
+const root = path.join(__dirname, '..', '..');
+const addHeaderLine = http.IncomingMessage.prototype._addHeaderLine;
+
+// Parses the entries of HTTP_KNOWN_HEADERS, e.g.
+//   V(COOKIE, "Cookie", "\x02" "cookie")
+function readKnownHeaders() {
+  const source = fs.readFileSync(
+    path.join(root, 'src', 'node_http_parser.h'), 'latin1');
+  const table = source.slice(source.indexOf('#define HTTP_KNOWN_HEADERS(V)'));
+  const entries = table.slice(0, table.search(/[^\\]\n\n/) + 1);
+  const re = /V\((\w+), "([^"]+)", ((?:"[^"]*"\s*)+)\)/g;
+  const headers = [];
+  let match;
+  while ((match = re.exec(entries)) !== null) {
+    const key = match[3].match(/"[^"]*"/g)
+      .map((literal) => literal.slice(1, -1)
+        .replace(/\\x([0-9a-fA-F]{2})/g,
+                 (_, hex) => String.fromCharCode(parseInt(hex, 16)))
+        .replace(/\\0/g, '\0'))
+      .join('');
+    headers.push({ id: match[1], name: match[2], key });
+  }
+  return headers;
+}
+
+// Returns the names of the headers that matchKnownFields() knows about.
+function readMatchKnownFields() {
+  const source = fs.readFileSync(
+    path.join(root, 'lib', '_http_incoming.js'), 'latin1');
+  const start = source.indexOf('function matchKnownFields(field) {');
+  const body = source.slice(start, source.indexOf('\n}\n', start));
+  const names = new Set();
+  const re = /case '([^']+)':/g;
+  let match;
+  while ((match = re.exec(body)) !== null)
+    names.add(match[1].toLowerCase());
+  return names;
+}
+
+// Adds `name` twice to a headers object the way the JS path does, and
+// returns the resulting object.
+function addTwice(name) {
+  const dest = {};
+  addHeaderLine.call({}, name, 'a', dest);
+  addHeaderLine.call({}, name, 'b', dest);
+  return dest;
+}
+
+function mixedCase(name) {
+  return name.split('').map((c, i) => {
+    return i % 2 ? c.toLowerCase() : c.toUpperCase();
+  }).join('');
+}
+
+const knownHeaders = readKnownHeaders();
+assert(knownHeaders.length > 0);
+
+// The table and matchKnownFields() contain the same headers.
+assert.deepStrictEqual(
+  knownHeaders.map((header) => header.name.toLowerCase()).sort(),
+  Array.from(readMatchKnownFields()).sort());
+
+// Every table entry is classified like matchKnownFields() does it, however
+// the name is spelled.
+for (const { id, name, key } of knownHeaders) {
+  const lowercase = name.toLowerCase();
+  let expected;
+  switch (key.charCodeAt(0)) {
+    case 0:
+      assert.strictEqual(key.slice(1), lowercase, id);
+      expected = { [lowercase]: 'a, b' };
+      break;
+    case 1:
+      assert.strictEqual(key, '\x01', id);
+      expected = { [lowercase]: ['a', 'b'] };
+      break;
+    case 2:
+      assert.strictEqual(key.slice(1), lowercase, id);
+      expected = { [lowercase]: 'a; b' };
+      break;
+    default:
+      assert.strictEqual(key, lowercase, id);
+      expected = { [lowercase]: 'a' };
+  }
+
+  for (const spelling of [name, lowercase, name.toUpperCase(), mixedCase(name)])
+    assert.deepStrictEqual(addTwice(spelling), expected, `${id}: ${spelling}`);
+}
+
+// The binding builds the same headers object from all of them. Headers that
+// change how the message is parsed are sent only once.
+const singleHeaders = [
+  'content-length', 'transfer-encoding', 'connection', 'upgrade', 'expect'
+];
+const lines = [];
+for (const { name } of knownHeaders) {
+  if (singleHeaders.includes(name.toLowerCase()))
+    continue;
+  lines.push(`${name}: a`, `${mixedCase(name)}: b`);
+}
+
+const server = http.createServer(common.mustCall((req, res) => {
+  const expected = {};
+  for (let i = 0; i < req.rawHeaders.length; i += 2)
+    addHeaderLine.call({}, req.rawHeaders[i], req.rawHeaders[i + 1], expected);
+  assert.deepStrictEqual(req.headers, expected);
+  assert.deepStrictEqual(Object.keys(req.headers), Object.keys(expected));
+  res.end();
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = net.connect(server.address().port, common.mustCall(() => {
+    client.end(['GET / HTTP/1.1']
+      .concat(lines, 'Connection: close', '', '')
+      .join('\r\n'));
+  }));
+  client.resume();
+  client.on('end', common.mustCall(() => server.close()));
+}));
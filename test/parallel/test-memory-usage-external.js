@@ -0,0 +1,32 @@
+// Flags: --expose-gc
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+
+// The storage of a Buffer is reported as external memory while the Buffer is
+// alive, and no longer after it has been collected.
+const kSize = 64 * 1024 * 1024;
+
+global.gc();
+const before = process.memoryUsage().external;
+
+let buffer = Buffer.alloc(kSize, 1);
+const allocated = process.memoryUsage().external;
+assert(allocated - before >= kSize,
+       `external grew by ${allocated - before} bytes, expected ${kSize}`);
+assert.strictEqual(buffer[kSize - 1], 1);
+
+buffer = null;
+
+// The storage may only be freed after the collection has finalized the
+// Buffer, so give it a few turns of the event loop.
+let attempts = 10;
+(function check() {
+  global.gc();
+  const freed = process.memoryUsage().external;
+  if (allocated - freed >= kSize)
+    return;
+  assert(--attempts > 0,
+         `external shrank by ${allocated - freed} bytes, expected ${kSize}`);
+  setImmediate(common.mustCall(check));
+})();
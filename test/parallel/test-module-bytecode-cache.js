@@ -0,0 +1,51 @@
+'use strict';
+const common = require('../common');
+if (!common.isChakraEngine)
+  common.skip('--chakra-bytecode-cache requires ChakraCore');
+
+const assert = require('assert');
+const fs = require('fs');
+const path = require('path');
+const spawnSync = require('child_process').spawnSync;
+
+const tmpdir = require('../common/tmpdir');
+tmpdir.refresh();
+
+const cacheDir = path.join(tmpdir.path, 'cache');
+const moduleFile = path.join(tmpdir.path, 'cached-module.js');
+
+function run() {
+  const child = spawnSync(process.execPath, [
+    `--chakra-bytecode-cache=${cacheDir}`,
+    '-p',
+    `require(${JSON.stringify(moduleFile)}).value()`
+  ]);
+  assert.strictEqual(child.status, 0, String(child.stderr));
+  return child.stdout.toString().trim();
+}
+
+// The first run compiles the module and populates the cache.
+fs.writeFileSync(moduleFile, 'exports.value = function() { return "a"; };');
+assert.strictEqual(run(), 'a');
+const cacheFiles = fs.readdirSync(cacheDir);
+assert.strictEqual(cacheFiles.length, 1);
+
+// The second run loads the module from the cache.
+assert.strictEqual(run(), 'a');
+assert.deepStrictEqual(fs.readdirSync(cacheDir), cacheFiles);
+
+// Changing the module invalidates its cache entry.
+fs.writeFileSync(moduleFile, 'exports.value = function() { return "b"; };');
+const future = new Date(Date.now() + 10000);
+fs.utimesSync(moduleFile, future, future);
+assert.strictEqual(run(), 'b');
+assert.strictEqual(run(), 'b');
+
+// An edit that keeps both the length of the module and its mtime, as with
+// deploys that normalize mtimes, is caught by the engine's source hash.
+const mtime = fs.statSync(moduleFile).mtime;
+fs.writeFileSync(moduleFile, 'exports.value = function() { return "c"; };');
+fs.utimesSync(moduleFile, mtime, mtime);
+assert.strictEqual(run(), 'c');
+assert.strictEqual(run(), 'c');
+assert.deepStrictEqual(fs.readdirSync(cacheDir), cacheFiles);
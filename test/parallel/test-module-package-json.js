@@ -0,0 +1,18 @@
+'use strict';
+
+require('../common');
+const fixtures = require('../common/fixtures');
+const assert = require('assert');
+const path = require('path');
+
+// The "main" field is read from UTF-8 text, after skipping a BOM.
+assert.strictEqual(require(fixtures.path('packages/unicode-main')).ok, 'ok');
+
+// Malformed package.json files report their path.
+const invalid = fixtures.path('packages/invalid-json');
+const jsonPath = path.join(invalid, 'package.json');
+assert.throws(() => require(invalid), (err) => {
+  return err instanceof SyntaxError &&
+         err.path === jsonPath &&
+         err.message.startsWith(`Error parsing ${jsonPath}: `);
+});
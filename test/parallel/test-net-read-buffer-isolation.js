@@ -0,0 +1,61 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Reads of all streams go into one shared read buffer before they are emitted
+// as Buffers (see benchmark/net/net-small-reads.js). A Buffer that is kept
+// after the 'data' event must not change when later reads reuse that read
+// buffer, and its memory must not expose bytes read from another socket.
+const sizes = [1, 16, 512, 4096, 8192, 8193, 20000, 65536];
+const clients = ['a', 'b', 'c'];
+const expectedLength = sizes.reduce((total, size) => total + size, 0);
+
+const server = net.createServer(common.mustCall((socket) => {
+  const retained = [];
+  let marker;
+  let received = 0;
+
+  socket.on('data', (chunk) => {
+    if (marker === undefined)
+      marker = chunk[0];
+    // The whole ArrayBuffer behind the chunk, not just the chunk's view of
+    // it, may only contain this socket's bytes.
+    const memory = Buffer.from(chunk.buffer);
+    assert(memory.every((byte) => byte === marker),
+           `read from '${String.fromCharCode(marker)}' exposes other data`);
+    retained.push({ chunk, copy: Buffer.from(chunk) });
+    received += chunk.length;
+  });
+
+  socket.on('end', common.mustCall(() => {
+    assert.strictEqual(received, expectedLength);
+    for (const { chunk, copy } of retained)
+      assert(chunk.equals(copy));
+    socket.end();
+  }));
+}, clients.length));
+
+server.listen(0, common.mustCall(() => {
+  let pending = clients.length;
+  for (const fill of clients) {
+    const client = net.connect(server.address().port, common.mustCall(() => {
+      writeNext(client, fill, 0);
+    }));
+    client.resume();
+    client.on('end', common.mustCall(() => {
+      if (--pending === 0)
+        server.close();
+    }));
+  }
+}));
+
+// Interleave the writes of all clients, one write per tick, so that reads of
+// different sockets follow each other into the read buffer.
+function writeNext(client, fill, i) {
+  if (i === sizes.length)
+    return client.end();
+  client.write(Buffer.alloc(sizes[i], fill), common.mustCall(() => {
+    setImmediate(writeNext, client, fill, i + 1);
+  }));
+}
@@ -0,0 +1,44 @@
+'use strict';
+const common = require('../common');
+const assert = require('assert');
+const net = require('net');
+
+// Corked string writes go through Writev(), which keeps the storage of a
+// write that completed synchronously for the next one. Writes of growing size
+// keep outgrowing that storage, which then has to be replaced (and freed),
+// and writes of shrinking size reuse it. Either way the data must arrive
+// intact, and nothing may leak when run under a leak checker.
+const sizes = [];
+for (let size = 1; size <= 64 * 1024; size *= 2)
+  sizes.push(size);
+const rounds = sizes.concat(sizes.slice().reverse());
+
+let expected = '';
+const server = net.createServer(common.mustCall((socket) => {
+  let received = '';
+  socket.setEncoding('latin1');
+  socket.on('data', (chunk) => received += chunk);
+  socket.on('end', common.mustCall(() => {
+    assert.strictEqual(received.length, expected.length);
+    assert.strictEqual(received, expected);
+    server.close();
+  }));
+}));
+
+server.listen(0, common.mustCall(() => {
+  const client = net.connect(server.address().port, common.mustCall(() => {
+    rounds.forEach((size, i) => {
+      const ascii = String.fromCharCode(97 + i % 26).repeat(size);
+      const hex = 'ab'.repeat(size);
+
+      client.cork();
+      client.write(ascii, 'latin1');
+      client.write(Buffer.from('|'));
+      client.write(hex, 'hex');
+      client.uncork();
+
+      expected += `${ascii}|${Buffer.from(hex, 'hex').toString('latin1')}`;
+    });
+    client.end();
+  }));
+}));
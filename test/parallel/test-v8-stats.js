@@ -19,13 +19,15 @@ keys.forEach(function(key) {
   assert.strictEqual(typeof s[key], 'number');
 });
 
-// chakra doesn't expose heapSpace names, so skip
-// the test for getHeapSpaceStatistics
-if (common.isChakraEngine) {
-  return;
-}
-
-const expectedHeapSpaces = [
+const expectedHeapSpaces = common.isChakraEngine ? [
+  'small_normal_space',
+  'small_leaf_space',
+  'small_finalizable_space',
+  'medium_normal_space',
+  'medium_leaf_space',
+  'medium_finalizable_space',
+  'large_object_space'
+] : [
   'new_space',
   'old_space',
   'code_space',
@@ -1,5 +1,5 @@
 'use strict';
-require('../common');
+const common = require('../common');
 const assert = require('assert');
 const vm = require('vm');
 const spawnSync = require('child_process').spawnSync;
@@ -83,6 +83,50 @@ function testRejectSlice() {
 }
 testRejectSlice();
 
+function testRejectSameLength() {
+  const source = getSource('length_a');
+  const other = getSource('length_b');
+  assert.strictEqual(other.length, source.length);
+
+  const data = produce(source);
+
+  // ChakraCore matches the cached data against a hash of the whole source, so
+  // a different source of the same length is rejected too.
+  const script = new vm.Script(other, {
+    cachedData: data
+  });
+  if (common.isChakraEngine)
+    assert(script.cachedDataRejected);
+  if (script.cachedDataRejected)
+    assert.strictEqual(script.runInThisContext()(), 'length_b');
+}
+testRejectSameLength();
+
+function testRejectProduce() {
+  const source = getSource('reproduce');
+
+  const data = produce(getSource('reproduce_1'));
+
+  // It should produce new code cache when the supplied one is rejected
+  const script = new vm.Script(source, {
+    cachedData: data,
+    produceCachedData: true
+  });
+  assert(script.cachedDataRejected);
+  assert.strictEqual(typeof script.cachedDataProduced, 'boolean');
+  if (!script.cachedDataProduced)
+    return;
+
+  const consumed = new vm.Script(source, {
+    cachedData: script.cachedData,
+    produceCachedData: true
+  });
+  assert(!consumed.cachedDataRejected);
+  assert.strictEqual(consumed.cachedDataProduced, undefined);
+  assert.strictEqual(consumed.runInThisContext()(), 'reproduce');
+}
+testRejectProduce();
+
 // It should throw on non-Buffer cachedData
 assert.throws(() => {
   new vm.Script('function abc() {}', {
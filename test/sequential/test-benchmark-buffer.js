@@ -18,6 +18,7 @@ runBenchmark('buffers',
                'n=1',
                'pieces=1',
                'pieceSize=1',
+               'repeat=1',
                'search=@',
                'size=1',
                'source=array',
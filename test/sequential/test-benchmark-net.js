@@ -10,6 +10,7 @@ const runBenchmark = require('../common/benchmark');
 
 runBenchmark('net',
              [
+               'connections=1',
                'dur=0',
                'len=1024',
                'type=buf'